@@ -63,6 +63,102 @@
 #include <wx/richtext/richtextctrl.h>
 #include <wx/srchctrl.h>
 
+// Properties read by the components, resolved once per class
+constexpr PropertyKey PROP_ALIGN( "align" );
+constexpr PropertyKey PROP_ALIGNMENT( "alignment" );
+constexpr PropertyKey PROP_AUTOSIZE_COLS( "autosize_cols" );
+constexpr PropertyKey PROP_AUTOSIZE_ROWS( "autosize_rows" );
+constexpr PropertyKey PROP_BACKSPACE_UNINDENTS( "backspace_unindents" );
+constexpr PropertyKey PROP_BITMAP( "bitmap" );
+constexpr PropertyKey PROP_CANCEL_BUTTON( "cancel_button" );
+constexpr PropertyKey PROP_CELL_BG( "cell_bg" );
+constexpr PropertyKey PROP_CELL_FONT( "cell_font" );
+constexpr PropertyKey PROP_CELL_HORIZ_ALIGNMENT( "cell_horiz_alignment" );
+constexpr PropertyKey PROP_CELL_TEXT( "cell_text" );
+constexpr PropertyKey PROP_CELL_VERT_ALIGNMENT( "cell_vert_alignment" );
+constexpr PropertyKey PROP_CHOICES( "choices" );
+constexpr PropertyKey PROP_CLASS( "class" );
+constexpr PropertyKey PROP_COLOUR( "colour" );
+constexpr PropertyKey PROP_COLS( "cols" );
+constexpr PropertyKey PROP_COLUMN_SIZES( "column_sizes" );
+constexpr PropertyKey PROP_COL_LABEL_HORIZ_ALIGNMENT( "col_label_horiz_alignment" );
+constexpr PropertyKey PROP_COL_LABEL_SIZE( "col_label_size" );
+constexpr PropertyKey PROP_COL_LABEL_VALUES( "col_label_values" );
+constexpr PropertyKey PROP_COL_LABEL_VERT_ALIGNMENT( "col_label_vert_alignment" );
+constexpr PropertyKey PROP_DEFAULTFILTER( "defaultfilter" );
+constexpr PropertyKey PROP_DEFAULTFOLDER( "defaultfolder" );
+constexpr PropertyKey PROP_DIGITS( "digits" );
+constexpr PropertyKey PROP_DRAG_COL_MOVE( "drag_col_move" );
+constexpr PropertyKey PROP_DRAG_COL_SIZE( "drag_col_size" );
+constexpr PropertyKey PROP_DRAG_GRID_SIZE( "drag_grid_size" );
+constexpr PropertyKey PROP_DRAG_ROW_SIZE( "drag_row_size" );
+constexpr PropertyKey PROP_EDITING( "editing" );
+constexpr PropertyKey PROP_ELLIPSIZE( "ellipsize" );
+constexpr PropertyKey PROP_EXTRA_STYLE( "extra_style" );
+constexpr PropertyKey PROP_FILE( "file" );
+constexpr PropertyKey PROP_FILTER( "filter" );
+constexpr PropertyKey PROP_FLAG( "flag" );
+constexpr PropertyKey PROP_FLAGS( "flags" );
+constexpr PropertyKey PROP_FOLDING( "folding" );
+constexpr PropertyKey PROP_FONT( "font" );
+constexpr PropertyKey PROP_GRID_LINES( "grid_lines" );
+constexpr PropertyKey PROP_GRID_LINE_COLOR( "grid_line_color" );
+constexpr PropertyKey PROP_HELP( "help" );
+constexpr PropertyKey PROP_HOVER_COLOR( "hover_color" );
+constexpr PropertyKey PROP_ID( "id" );
+constexpr PropertyKey PROP_INC( "inc" );
+constexpr PropertyKey PROP_INCLUDE_ADVANCED( "include_advanced" );
+constexpr PropertyKey PROP_INDENTATION_GUIDES( "indentation_guides" );
+constexpr PropertyKey PROP_INITIAL( "initial" );
+constexpr PropertyKey PROP_LABEL( "label" );
+constexpr PropertyKey PROP_LABEL_BG( "label_bg" );
+constexpr PropertyKey PROP_LABEL_FONT( "label_font" );
+constexpr PropertyKey PROP_LABEL_TEXT( "label_text" );
+constexpr PropertyKey PROP_LINE_NUMBERS( "line_numbers" );
+constexpr PropertyKey PROP_MARGIN_HEIGHT( "margin_height" );
+constexpr PropertyKey PROP_MARGIN_WIDTH( "margin_width" );
+constexpr PropertyKey PROP_MAX( "max" );
+constexpr PropertyKey PROP_MAX_POINT_SIZE( "max_point_size" );
+constexpr PropertyKey PROP_MESSAGE( "message" );
+constexpr PropertyKey PROP_MIN( "min" );
+constexpr PropertyKey PROP_MODE( "mode" );
+constexpr PropertyKey PROP_MODEL_COLUMN( "model_column" );
+constexpr PropertyKey PROP_NAME( "name" );
+constexpr PropertyKey PROP_NORMAL_COLOR( "normal_color" );
+constexpr PropertyKey PROP_PAGESIZE( "pagesize" );
+constexpr PropertyKey PROP_PLAY( "play" );
+constexpr PropertyKey PROP_PLAYBACK_RATE( "playback_rate" );
+constexpr PropertyKey PROP_PLAYER_CONTROLS( "player_controls" );
+constexpr PropertyKey PROP_POS( "pos" );
+constexpr PropertyKey PROP_RANGE( "range" );
+constexpr PropertyKey PROP_ROWS( "rows" );
+constexpr PropertyKey PROP_ROW_LABEL_HORIZ_ALIGNMENT( "row_label_horiz_alignment" );
+constexpr PropertyKey PROP_ROW_LABEL_SIZE( "row_label_size" );
+constexpr PropertyKey PROP_ROW_LABEL_VALUES( "row_label_values" );
+constexpr PropertyKey PROP_ROW_LABEL_VERT_ALIGNMENT( "row_label_vert_alignment" );
+constexpr PropertyKey PROP_ROW_SIZES( "row_sizes" );
+constexpr PropertyKey PROP_SEARCH_BUTTON( "search_button" );
+constexpr PropertyKey PROP_SELECT( "select" );
+constexpr PropertyKey PROP_SHOW_HEADER( "show_header" );
+constexpr PropertyKey PROP_SHOW_HIDDEN( "show_hidden" );
+constexpr PropertyKey PROP_SIZE( "size" );
+constexpr PropertyKey PROP_STYLE( "style" );
+constexpr PropertyKey PROP_TAB_INDENTS( "tab_indents" );
+constexpr PropertyKey PROP_TAB_WIDTH( "tab_width" );
+constexpr PropertyKey PROP_THEME( "theme" );
+constexpr PropertyKey PROP_THUMBSIZE( "thumbsize" );
+constexpr PropertyKey PROP_TYPE( "type" );
+constexpr PropertyKey PROP_URL( "url" );
+constexpr PropertyKey PROP_USE_TABS( "use_tabs" );
+constexpr PropertyKey PROP_VALUE( "value" );
+constexpr PropertyKey PROP_VIEW_EOL( "view_eol" );
+constexpr PropertyKey PROP_VIEW_WHITESPACE( "view_whitespace" );
+constexpr PropertyKey PROP_VISITED_COLOR( "visited_color" );
+constexpr PropertyKey PROP_VOLUME( "volume" );
+constexpr PropertyKey PROP_WIDTH( "width" );
+constexpr PropertyKey PROP_WILDCARD( "wildcard" );
+constexpr PropertyKey PROP_WINDOW_STYLE( "window_style" );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -155,22 +251,22 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxCalendarCtrl((wxWindow *)parent, wxID_ANY,
 			wxDefaultDateTime,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxCalendarCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("wxCalendarCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxCalendarCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxCalendarCtrl"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -180,21 +276,21 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxDatePickerCtrl((wxWindow *)parent, wxID_ANY,
 			wxDefaultDateTime,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxDatePickerCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxDatePickerCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxDatePickerCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxDatePickerCtrl"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -204,21 +300,21 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxTimePickerCtrl( ( wxWindow * )parent, wxID_ANY,
 									 wxDefaultDateTime,
-									 obj->GetPropertyAsPoint( _( "pos" ) ),
-									 obj->GetPropertyAsSize( _( "size" ) ),
-									 obj->GetPropertyAsInteger( _( "style" ) ) | obj->GetPropertyAsInteger( _( "window_style" ) ) );
+									 obj->GetPropertyAsPointByKey( PROP_POS ),
+									 obj->GetPropertyAsSizeByKey( PROP_SIZE ),
+									 obj->GetPropertyAsIntegerByKey( PROP_STYLE ) | obj->GetPropertyAsIntegerByKey( PROP_WINDOW_STYLE ) );
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc( obj, _( "wxTimePickerCtrl" ), obj->GetPropertyAsString( _( "name" ) ) );
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc( writer, obj, _( "wxTimePickerCtrl" ), obj->GetPropertyAsStringByKey( PROP_NAME ) );
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter( xrcObj, _( "wxTimePickerCtrl" ) );
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter( writer, xrcObj, _( "wxTimePickerCtrl" ) );
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -232,9 +328,9 @@ public:
 		wxRichTextCtrl* richText = new wxRichTextCtrl( 	(wxWindow*)parent,
 															wxID_ANY,
 															wxEmptyString,
-															obj->GetPropertyAsPoint(_("pos")),
-															obj->GetPropertyAsSize(_("size")),
-															obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+															obj->GetPropertyAsPointByKey(PROP_POS),
+															obj->GetPropertyAsSizeByKey(PROP_SIZE),
+															obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		wxFont textFont = wxFont(12, wxFONTFAMILY_ROMAN, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL);
 		wxFont boldFont = wxFont(12, wxFONTFAMILY_ROMAN, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_BOLD);
@@ -369,16 +465,16 @@ public:
 		return richText;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("unknown"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		//xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxRichTextCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxRichTextCtrl"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -387,9 +483,9 @@ class HtmlWindowComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxHtmlWindow *hw = new wxHtmlWindow((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		wxString dummy_page(
 			wxT("<b>wxHtmlWindow</b><br />")
@@ -400,17 +496,17 @@ public:
 		return hw;
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxHtmlWindow"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("wxHtmlWindow"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxHtmlWindow"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxHtmlWindow"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -421,12 +517,12 @@ class ToggleButtonComponent : public ComponentBase, public wxEvtHandler
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxToggleButton* window = new wxToggleButton((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByKey(PROP_LABEL),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		window->SetValue( ( obj->GetPropertyAsInteger(_("value")) != 0 ) );
+		window->SetValue( ( obj->GetPropertyAsIntegerByKey(PROP_VALUE) != 0 ) );
 		window->Connect( wxEVT_COMMAND_TOGGLEBUTTON_CLICKED, wxCommandEventHandler( ToggleButtonComponent::OnToggle ), NULL, this );
 		return window;
 	}
@@ -452,20 +548,20 @@ public:
 		ComponentBase::Cleanup( obj );
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxToggleButton"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxToggleButton"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("value"),_("checked"), XRC_TYPE_BOOL);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxToggleButton"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxToggleButton"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("checked"),_("value"), XRC_TYPE_BOOL);
-		return filter.GetXfbObject();
+		return true;
 	}
 
 };
@@ -474,11 +570,11 @@ class TreeCtrlComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		int style = obj->GetPropertyAsInteger(_("style"));
+		int style = obj->GetPropertyAsIntegerByKey(PROP_STYLE);
 		wxTreeCtrl *tc = new wxTreeCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			style | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			style | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		// dummy nodes
 		wxTreeItemId root = tc->AddRoot(wxT("root node"));
@@ -496,16 +592,16 @@ public:
 		return tc;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxTreeCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxTreeCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxTreeCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxTreeCtrl"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -514,35 +610,35 @@ class ScrollBarComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxScrollBar *sb = new wxScrollBar((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
-
-		sb->SetScrollbar(obj->GetPropertyAsInteger(_T("value")),
-			obj->GetPropertyAsInteger(_T("thumbsize")),
-			obj->GetPropertyAsInteger(_T("range")),
-			obj->GetPropertyAsInteger(_T("pagesize")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
+
+		sb->SetScrollbar(obj->GetPropertyAsIntegerByKey(PROP_VALUE),
+			obj->GetPropertyAsIntegerByKey(PROP_THUMBSIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_RANGE),
+			obj->GetPropertyAsIntegerByKey(PROP_PAGESIZE));
 		return sb;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxScrollBar"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxScrollBar"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("thumbsize"), _("thumbsize"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("pagesize"), _("pagesize"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxScrollBar"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxScrollBar"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("thumbsize"), _("thumbsize"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("pagesize"), _("pagesize"), XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -550,16 +646,16 @@ class SpinCtrlComponent : public ComponentBase, public wxEvtHandler
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		int max = obj->GetPropertyAsInteger(_("max"));
-		int min = obj->GetPropertyAsInteger(_("min"));
+		int max = obj->GetPropertyAsIntegerByKey(PROP_MAX);
+		int min = obj->GetPropertyAsIntegerByKey(PROP_MIN);
 		wxSpinCtrl* window = new wxSpinCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")),
+			obj->GetPropertyAsStringByKey(PROP_VALUE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE),
 			min < max ? min : max,
 			max,
-			obj->GetPropertyAsInteger(_("initial")));
+			obj->GetPropertyAsIntegerByKey(PROP_INITIAL));
 
 		window->Connect( wxEVT_COMMAND_SPINCTRL_UPDATED, wxSpinEventHandler( SpinCtrlComponent::OnSpin ), NULL, this );
 		return window;
@@ -586,24 +682,24 @@ public:
 		ComponentBase::Cleanup( obj );
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSpinCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxSpinCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("initial"),_("value"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("min"),_("min"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("max"),_("max"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSpinCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxSpinCtrl"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("value"),_("value"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("value"),_("initial"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("min"),_("min"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("max"),_("max"), XRC_TYPE_INTEGER);
 
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -612,16 +708,16 @@ class SpinCtrlDoubleComponent : public ComponentBase, public wxEvtHandler
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxSpinCtrlDouble* window = new wxSpinCtrlDouble((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")),
-			obj->GetPropertyAsFloat(_("min")),
-			obj->GetPropertyAsFloat(_("max")),
-			obj->GetPropertyAsFloat(_("initial")),
-			obj->GetPropertyAsFloat(_("inc")));
+			obj->GetPropertyAsStringByKey(PROP_VALUE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE),
+			obj->GetPropertyAsFloatByKey(PROP_MIN),
+			obj->GetPropertyAsFloatByKey(PROP_MAX),
+			obj->GetPropertyAsFloatByKey(PROP_INITIAL),
+			obj->GetPropertyAsFloatByKey(PROP_INC));
 
-		window->SetDigits(obj->GetPropertyAsInteger(_("digits")));
+		window->SetDigits(obj->GetPropertyAsIntegerByKey(PROP_DIGITS));
 
 		window->Connect( wxEVT_COMMAND_SPINCTRLDOUBLE_UPDATED, wxSpinEventHandler( SpinCtrlDoubleComponent::OnSpin ), NULL, this );
 		return window;
@@ -648,15 +744,15 @@ public:
 		ComponentBase::Cleanup( obj );
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSpinCtrlDouble"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxSpinCtrlDouble"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("initial"),_("value"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("min"),_("min"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("max"),_("max"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("inc"),_("inc"), XRC_TYPE_FLOAT);
 		xrc.AddProperty(_("digits"), _("digits"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
@@ -678,21 +774,21 @@ class SpinButtonComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxSpinButton((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSpinButton"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxSpinButton"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSpinButton"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxSpinButton"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -700,29 +796,29 @@ class CheckListBoxComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxArrayString choices (obj->GetPropertyAsArrayString(_("choices")));
+		wxArrayString choices (obj->GetPropertyAsArrayStringByKey(PROP_CHOICES));
 		wxCheckListBox *cl =
 			new wxCheckListBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			choices,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		return cl;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxCheckListBox"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxCheckListBox"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxCheckListBox"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxCheckListBox"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("content"), _("choices"), XRC_TYPE_STRINGLIST);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -731,84 +827,84 @@ class GridComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxGrid *grid = new wxGrid((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		grid->CreateGrid(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")));
+			obj->GetPropertyAsIntegerByKey(PROP_ROWS),
+			obj->GetPropertyAsIntegerByKey(PROP_COLS));
 
-		grid->EnableDragColMove( obj->GetPropertyAsInteger( _("drag_col_move") ) != 0 );
-		grid->EnableDragColSize( obj->GetPropertyAsInteger( _("drag_col_size") ) != 0 );
-		grid->EnableDragGridSize( obj->GetPropertyAsInteger( _("drag_grid_size") ) != 0 );
-		grid->EnableDragRowSize( obj->GetPropertyAsInteger( _("drag_row_size") ) != 0 );
-		grid->EnableEditing( obj->GetPropertyAsInteger( _("editing") ) != 0 );
-		grid->EnableGridLines( obj->GetPropertyAsInteger( _("grid_lines") ) != 0 );
-		if ( !obj->IsNull( _("grid_line_color") ) )
+		grid->EnableDragColMove( obj->GetPropertyAsIntegerByKey( PROP_DRAG_COL_MOVE ) != 0 );
+		grid->EnableDragColSize( obj->GetPropertyAsIntegerByKey( PROP_DRAG_COL_SIZE ) != 0 );
+		grid->EnableDragGridSize( obj->GetPropertyAsIntegerByKey( PROP_DRAG_GRID_SIZE ) != 0 );
+		grid->EnableDragRowSize( obj->GetPropertyAsIntegerByKey( PROP_DRAG_ROW_SIZE ) != 0 );
+		grid->EnableEditing( obj->GetPropertyAsIntegerByKey( PROP_EDITING ) != 0 );
+		grid->EnableGridLines( obj->GetPropertyAsIntegerByKey( PROP_GRID_LINES ) != 0 );
+		if ( !obj->IsNullByKey( PROP_GRID_LINE_COLOR ) )
 		{
-			grid->SetGridLineColour( obj->GetPropertyAsColour( _("grid_line_color") ) );
+			grid->SetGridLineColour( obj->GetPropertyAsColourByKey( PROP_GRID_LINE_COLOR ) );
 		}
-		grid->SetMargins( obj->GetPropertyAsInteger( _("margin_width") ), obj->GetPropertyAsInteger( _("margin_height") ) );
+		grid->SetMargins( obj->GetPropertyAsIntegerByKey( PROP_MARGIN_WIDTH ), obj->GetPropertyAsIntegerByKey( PROP_MARGIN_HEIGHT ) );
 
 		// Label Properties
-		grid->SetColLabelAlignment( obj->GetPropertyAsInteger( _("col_label_horiz_alignment") ), obj->GetPropertyAsInteger( _("col_label_vert_alignment") ) );
-		grid->SetColLabelSize( obj->GetPropertyAsInteger( _("col_label_size") ) );
+		grid->SetColLabelAlignment( obj->GetPropertyAsIntegerByKey( PROP_COL_LABEL_HORIZ_ALIGNMENT ), obj->GetPropertyAsIntegerByKey( PROP_COL_LABEL_VERT_ALIGNMENT ) );
+		grid->SetColLabelSize( obj->GetPropertyAsIntegerByKey( PROP_COL_LABEL_SIZE ) );
 
-		wxArrayString columnLabels = obj->GetPropertyAsArrayString( _("col_label_values") );
+		wxArrayString columnLabels = obj->GetPropertyAsArrayStringByKey( PROP_COL_LABEL_VALUES );
 		for ( int i = 0; i < (int)columnLabels.size() && i < grid->GetNumberCols(); ++i )
 		{
 			grid->SetColLabelValue( i, columnLabels[i] );
 		}
 
-		wxArrayInt columnSizes = obj->GetPropertyAsArrayInt( _("column_sizes") );
+		wxArrayInt columnSizes = obj->GetPropertyAsArrayIntByKey( PROP_COLUMN_SIZES );
 		for ( int i = 0; i < (int)columnSizes.size() && i < grid->GetNumberCols(); ++i )
 		{
 			grid->SetColSize( i, columnSizes[i] );
 		}
 
-		grid->SetRowLabelAlignment( obj->GetPropertyAsInteger( _("row_label_horiz_alignment") ), obj->GetPropertyAsInteger( _("row_label_vert_alignment") ) );
-		grid->SetRowLabelSize( obj->GetPropertyAsInteger( _("row_label_size") ) );
+		grid->SetRowLabelAlignment( obj->GetPropertyAsIntegerByKey( PROP_ROW_LABEL_HORIZ_ALIGNMENT ), obj->GetPropertyAsIntegerByKey( PROP_ROW_LABEL_VERT_ALIGNMENT ) );
+		grid->SetRowLabelSize( obj->GetPropertyAsIntegerByKey( PROP_ROW_LABEL_SIZE ) );
 
-		wxArrayString rowLabels = obj->GetPropertyAsArrayString( _("row_label_values") );
+		wxArrayString rowLabels = obj->GetPropertyAsArrayStringByKey( PROP_ROW_LABEL_VALUES );
 		for ( int i = 0; i < (int)rowLabels.size() && i < grid->GetNumberRows(); ++i )
 		{
 			grid->SetRowLabelValue( i, rowLabels[i] );
 		}
 
-		wxArrayInt rowSizes = obj->GetPropertyAsArrayInt( _("row_sizes") );
+		wxArrayInt rowSizes = obj->GetPropertyAsArrayIntByKey( PROP_ROW_SIZES );
 		for ( int i = 0; i < (int)rowSizes.size() && i < grid->GetNumberRows(); ++i )
 		{
 			grid->SetRowSize( i, rowSizes[i] );
 		}
 
-		if ( !obj->IsNull( _("label_bg") ) )
+		if ( !obj->IsNullByKey( PROP_LABEL_BG ) )
 		{
-			grid->SetLabelBackgroundColour( obj->GetPropertyAsColour( _("label_bg") ) );
+			grid->SetLabelBackgroundColour( obj->GetPropertyAsColourByKey( PROP_LABEL_BG ) );
 		}
-		if ( !obj->IsNull( _("label_text") ) )
+		if ( !obj->IsNullByKey( PROP_LABEL_TEXT ) )
 		{
-			grid->SetLabelTextColour( obj->GetPropertyAsColour( _("label_text") ) );
+			grid->SetLabelTextColour( obj->GetPropertyAsColourByKey( PROP_LABEL_TEXT ) );
 		}
-		if ( !obj->IsNull( _("label_font") ) )
+		if ( !obj->IsNullByKey( PROP_LABEL_FONT ) )
 		{
-			grid->SetLabelFont( obj->GetPropertyAsFont( _("label_font") ) );
+			grid->SetLabelFont( obj->GetPropertyAsFontByKey( PROP_LABEL_FONT ) );
 		}
 
 		// Default Cell Properties
-		grid->SetDefaultCellAlignment( obj->GetPropertyAsInteger( _("cell_horiz_alignment") ), obj->GetPropertyAsInteger( _("cell_vert_alignment") ) );
+		grid->SetDefaultCellAlignment( obj->GetPropertyAsIntegerByKey( PROP_CELL_HORIZ_ALIGNMENT ), obj->GetPropertyAsIntegerByKey( PROP_CELL_VERT_ALIGNMENT ) );
 
-		if ( !obj->IsNull( _("cell_bg") ) )
+		if ( !obj->IsNullByKey( PROP_CELL_BG ) )
 		{
-			grid->SetDefaultCellBackgroundColour( obj->GetPropertyAsColour( _("cell_bg") ) );
+			grid->SetDefaultCellBackgroundColour( obj->GetPropertyAsColourByKey( PROP_CELL_BG ) );
 		}
-		if ( !obj->IsNull( _("cell_text") ) )
+		if ( !obj->IsNullByKey( PROP_CELL_TEXT ) )
 		{
-			grid->SetDefaultCellTextColour( obj->GetPropertyAsColour( _("cell_text") ) );
+			grid->SetDefaultCellTextColour( obj->GetPropertyAsColourByKey( PROP_CELL_TEXT ) );
 		}
-		if ( !obj->IsNull( _("cell_font") ) )
+		if ( !obj->IsNullByKey( PROP_CELL_FONT ) )
 		{
-			grid->SetDefaultCellFont( obj->GetPropertyAsFont( _("cell_font") ) );
+			grid->SetDefaultCellFont( obj->GetPropertyAsFontByKey( PROP_CELL_FONT ) );
 		}
 
 		// Example Cell Values
@@ -820,11 +916,11 @@ public:
 			}
 		}
 
-		if ( obj->GetPropertyAsInteger( _("autosize_rows") ) != 0 )
+		if ( obj->GetPropertyAsIntegerByKey( PROP_AUTOSIZE_ROWS ) != 0 )
 		{
 			grid->AutoSizeRows();
 		}
-		if ( obj->GetPropertyAsInteger( _("autosize_cols") ) != 0 )
+		if ( obj->GetPropertyAsIntegerByKey( PROP_AUTOSIZE_COLS ) != 0 )
 		{
 			grid->AutoSizeColumns();
 		}
@@ -843,16 +939,16 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGrid"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxGrid"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGrid"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxGrid"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -952,11 +1048,11 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxColourPickerCtrl* colourpicker = new wxColourPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsColour(_("colour")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsIntegerByKey(PROP_ID),
+			obj->GetPropertyAsColourByKey(PROP_COLOUR),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)
 			);
 
 		colourpicker->PushEventHandler( new ComponentEvtHandler( colourpicker, GetManager() ) );
@@ -972,18 +1068,18 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxColourPickerCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxColourPickerCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(_("colour"),_("value"),XRC_TYPE_COLOUR);
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxColourPickerCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxColourPickerCtrl"));
 		filter.AddProperty(_("value"),_("colour"),XRC_TYPE_COLOUR);
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -1003,16 +1099,16 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxFontPickerCtrl* picker = new wxFontPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsFont(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsIntegerByKey(PROP_ID),
+			obj->GetPropertyAsFontByKey(PROP_VALUE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)
 			);
 
-		if ( !obj->IsNull( _("max_point_size") ) )
+		if ( !obj->IsNullByKey( PROP_MAX_POINT_SIZE ) )
 		{
-			picker->SetMaxPointSize( obj->GetPropertyAsInteger( _("max_point_size") ) );
+			picker->SetMaxPointSize( obj->GetPropertyAsIntegerByKey( PROP_MAX_POINT_SIZE ) );
 		}
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -1028,21 +1124,21 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxFontPickerCtrl"), obj->GetPropertyAsString(_("name")));
-		if ( !obj->IsNull( _("value") ) )
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxFontPickerCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
+		if ( !obj->IsNullByKey( PROP_VALUE ) )
 		{
 			xrc.AddProperty(_("value"),_("value"),XRC_TYPE_FONT);
 		}
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxFontPickerCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxFontPickerCtrl"));
 		filter.AddProperty(_("value"),_("value"),XRC_TYPE_FONT);
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -1062,13 +1158,13 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxFilePickerCtrl* picker = new wxFilePickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsString(_("message")),
-			obj->GetPropertyAsString(_("wildcard")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsIntegerByKey(PROP_ID),
+			obj->GetPropertyAsStringByKey(PROP_VALUE),
+			obj->GetPropertyAsStringByKey(PROP_MESSAGE),
+			obj->GetPropertyAsStringByKey(PROP_WILDCARD),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)
 			);
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -1084,22 +1180,22 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxFilePickerCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxFilePickerCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("wildcard"),_("wildcard"),XRC_TYPE_TEXT);
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxFilePickerCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxFilePickerCtrl"));
 		filter.AddProperty(_("value"),_("value"),XRC_TYPE_FONT);
 		filter.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("wildcard"),_("wildcard"),XRC_TYPE_TEXT);
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -1118,12 +1214,12 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxDirPickerCtrl* picker = new wxDirPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsString(_("message")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsIntegerByKey(PROP_ID),
+			obj->GetPropertyAsStringByKey(PROP_VALUE),
+			obj->GetPropertyAsStringByKey(PROP_MESSAGE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)
 			);
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -1139,20 +1235,20 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxDirPickerCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxDirPickerCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxDirPickerCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxDirPickerCtrl"));
 		filter.AddProperty(_("value"),_("value"),XRC_TYPE_FONT);
 		filter.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -1171,39 +1267,39 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxHyperlinkCtrl* ctrl = new wxHyperlinkCtrl(
 			(wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsString(_("url")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsStringByKey(PROP_LABEL),
+			obj->GetPropertyAsStringByKey(PROP_URL),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)
 			);
 
-		if ( !obj->IsNull( _("hover_color") ) )
+		if ( !obj->IsNullByKey( PROP_HOVER_COLOR ) )
 		{
-			ctrl->SetHoverColour( obj->GetPropertyAsColour( _("hover_color") ) );
+			ctrl->SetHoverColour( obj->GetPropertyAsColourByKey( PROP_HOVER_COLOR ) );
 		}
-		if ( !obj->IsNull( _("normal_color") ) )
+		if ( !obj->IsNullByKey( PROP_NORMAL_COLOR ) )
 		{
-			ctrl->SetNormalColour( obj->GetPropertyAsColour( _("normal_color") ) );
+			ctrl->SetNormalColour( obj->GetPropertyAsColourByKey( PROP_NORMAL_COLOR ) );
 		}
-		if ( !obj->IsNull( _("visited_color") ) )
+		if ( !obj->IsNullByKey( PROP_VISITED_COLOR ) )
 		{
-			ctrl->SetVisitedColour( obj->GetPropertyAsColour( _("visited_color") ) );
+			ctrl->SetVisitedColour( obj->GetPropertyAsColourByKey( PROP_VISITED_COLOR ) );
 		}
 
 		return ctrl;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxHyperlinkCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxHyperlinkCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddPropertyValue(_("url"), obj->GetPropertyAsString(_("url")));
+		xrc.AddPropertyValue(_("url"), obj->GetPropertyAsStringByKey(PROP_URL));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxHyperlinkCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxHyperlinkCtrl"));
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 
 		try
@@ -1218,7 +1314,7 @@ public:
 		}
 
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -1229,15 +1325,15 @@ public:
 		wxGenericDirCtrl* ctrl = new wxGenericDirCtrl(
 			(wxWindow*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsString(_("defaultfolder")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")),
-			obj->GetPropertyAsString(_("filter")),
-			obj->GetPropertyAsInteger(_("defaultfilter"))
+			obj->GetPropertyAsStringByKey(PROP_DEFAULTFOLDER),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE),
+			obj->GetPropertyAsStringByKey(PROP_FILTER),
+			obj->GetPropertyAsIntegerByKey(PROP_DEFAULTFILTER)
 			);
 
-		ctrl->ShowHidden( obj->GetPropertyAsInteger( _("show_hidden") ) != 0 );
+		ctrl->ShowHidden( obj->GetPropertyAsIntegerByKey( PROP_SHOW_HIDDEN ) != 0 );
 		ctrl->GetTreeCtrl()->PushEventHandler( new GenericDirCtrlEvtHandler( ctrl, GetManager() ) );
 		return ctrl;
 	}
@@ -1251,22 +1347,22 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGenericDirCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxGenericDirCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(_("defaultfolder"),_("defaultfolder"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("filter"),_("filter"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("defaultfilter"),_("defaultfilter"),XRC_TYPE_INTEGER);
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGenericDirCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxGenericDirCtrl"));
 		filter.AddProperty(_("defaultfolder"),_("defaultfolder"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("filter"),_("filter"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("defaultfilter"),_("defaultfilter"),XRC_TYPE_INTEGER);
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -1283,9 +1379,9 @@ public:
 		return new wxPanel((wxWindow *)parent, wxID_ANY, wxDefaultPosition, wxDefaultSize, 0 );
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, obj->GetPropertyAsString(_("class")), obj->GetPropertyAsString(_("name")));
-		return xrc.GetXrcObject();
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, obj->GetPropertyAsStringByKey(PROP_CLASS), obj->GetPropertyAsStringByKey(PROP_NAME));
+		return true;
 	}
 };
 
@@ -1294,19 +1390,19 @@ class SearchCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxSearchCtrl* sc = new wxSearchCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByKey(PROP_VALUE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		if ( !obj->IsNull( _("search_button") ) )
+		if ( !obj->IsNullByKey( PROP_SEARCH_BUTTON ) )
 		{
-			sc->ShowSearchButton(obj->GetPropertyAsInteger(_("search_button")) != 0);
+			sc->ShowSearchButton(obj->GetPropertyAsIntegerByKey(PROP_SEARCH_BUTTON) != 0);
 		}
 
-		if ( !obj->IsNull( _("cancel_button") ) )
+		if ( !obj->IsNullByKey( PROP_CANCEL_BUTTON ) )
 		{
-			sc->ShowCancelButton(obj->GetPropertyAsInteger(_("cancel_button")) != 0);
+			sc->ShowCancelButton(obj->GetPropertyAsIntegerByKey(PROP_CANCEL_BUTTON) != 0);
 		}
 
 		sc->PushEventHandler( new ComponentEvtHandler( sc, GetManager() ) );
@@ -1323,18 +1419,18 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSearchCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxSearchCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSearchCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxSearchCtrl"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 
 };
@@ -1357,27 +1453,27 @@ class MediaCtrlComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxMediaCtrl* mc = new wxMediaCtrl((wxWindow *)parent, wxID_ANY, wxT(""),obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+		wxMediaCtrl* mc = new wxMediaCtrl((wxWindow *)parent, wxID_ANY, wxT(""),obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		if ( !obj->IsNull( _("file") ) )
+		if ( !obj->IsNullByKey( PROP_FILE ) )
 		{
-			if( mc->Load( obj->GetPropertyAsString( _("file") ) ) )
+			if( mc->Load( obj->GetPropertyAsStringByKey( PROP_FILE ) ) )
 			{
-				if (!obj->IsNull( _("playback_rate"))) mc->SetPlaybackRate(obj->GetPropertyAsFloat(_("playback_rate")));
-				if (!obj->IsNull( _("volume")) && (obj->GetPropertyAsFloat(_("volume"))>=0)&&(obj->GetPropertyAsFloat(_("volume"))<=1))
-						mc->SetPlaybackRate(obj->GetPropertyAsFloat(_("volume")));
-				if (!obj->IsNull(_("player_controls")))
+				if (!obj->IsNullByKey( PROP_PLAYBACK_RATE)) mc->SetPlaybackRate(obj->GetPropertyAsFloatByKey(PROP_PLAYBACK_RATE));
+				if (!obj->IsNullByKey( PROP_VOLUME) && (obj->GetPropertyAsFloatByKey(PROP_VOLUME)>=0)&&(obj->GetPropertyAsFloatByKey(PROP_VOLUME)<=1))
+						mc->SetPlaybackRate(obj->GetPropertyAsFloatByKey(PROP_VOLUME));
+				if (!obj->IsNullByKey(PROP_PLAYER_CONTROLS))
 				{
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("STEP") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("VOLUME") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_VOLUME);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("DEFAULT") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_DEFAULT);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("NONE") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_NONE);
+					if(  obj->GetPropertyAsStringByKey( PROP_PLAYER_CONTROLS ) == wxT("STEP") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
+					if(  obj->GetPropertyAsStringByKey( PROP_PLAYER_CONTROLS ) == wxT("VOLUME") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_VOLUME);
+					if(  obj->GetPropertyAsStringByKey( PROP_PLAYER_CONTROLS ) == wxT("DEFAULT") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_DEFAULT);
+					if(  obj->GetPropertyAsStringByKey( PROP_PLAYER_CONTROLS ) == wxT("NONE") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_NONE);
 
 				}
 
-				if ( !obj->IsNull( _("play") ) && ( obj->GetPropertyAsInteger( _("play") ) == 1 ) ) mc->Play();
+				if ( !obj->IsNullByKey( PROP_PLAY ) && ( obj->GetPropertyAsIntegerByKey( PROP_PLAY ) == 1 ) ) mc->Play();
 				else
 					mc->Stop();
 
@@ -1385,7 +1481,7 @@ public:
 			}
 		}
 
-		if(!obj->IsNull(_("style"))) mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
+		if(!obj->IsNullByKey(PROP_STYLE)) mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
 
 		mc->PushEventHandler( new ComponentEvtHandler( mc, GetManager() ) );
 
@@ -1401,16 +1497,16 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxMediaCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxMediaCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxMediaCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxMediaCtrl"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 #endif
@@ -1426,14 +1522,14 @@ class PropertyGridComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxPropertyGrid* pg = new wxPropertyGrid((wxWindow *)parent, wxID_ANY,
-												obj->GetPropertyAsPoint(wxT("pos")),
-												obj->GetPropertyAsSize(wxT("size")),
-												obj->GetPropertyAsInteger(wxT("style")) |
-												obj->GetPropertyAsInteger(wxT("window_style")) );
+												obj->GetPropertyAsPointByKey(PROP_POS),
+												obj->GetPropertyAsSizeByKey(PROP_SIZE),
+												obj->GetPropertyAsIntegerByKey(PROP_STYLE) |
+												obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE) );
 
-		if ( !obj->GetPropertyAsString(wxT("extra_style")).empty() )
+		if ( !obj->GetPropertyAsStringByKey(PROP_EXTRA_STYLE).empty() )
 		{
-			pg->SetExtraStyle( obj->GetPropertyAsInteger( wxT("extra_style") ) );
+			pg->SetExtraStyle( obj->GetPropertyAsIntegerByKey( PROP_EXTRA_STYLE ) );
 		}
 
 		return pg;
@@ -1459,22 +1555,22 @@ public:
 			IObject* childObj = GetManager()->GetIObject( child );
 			if (childObj->GetClassName() == _("propGridItem"))
 			{
-				if (childObj->GetPropertyAsString( _("type") ) == _("Category") )
+				if (childObj->GetPropertyAsStringByKey( PROP_TYPE ) == _("Category") )
 				{
-					pg->Append( new wxPropertyCategory( childObj->GetPropertyAsString( _("label") ), childObj->GetPropertyAsString( _("label") ) ) );
+					pg->Append( new wxPropertyCategory( childObj->GetPropertyAsStringByKey( PROP_LABEL ), childObj->GetPropertyAsStringByKey( PROP_LABEL ) ) );
 				}
 				else
 				{
-					wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (childObj->GetPropertyAsString( _("type") ) ) + wxT("Property") ), wxPGProperty );
+					wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (childObj->GetPropertyAsStringByKey( PROP_TYPE ) ) + wxT("Property") ), wxPGProperty );
 					if( prop )
 					{
-						prop->SetLabel( childObj->GetPropertyAsString( _("label") ) );
-						prop->SetName( childObj->GetPropertyAsString( _("label") ) );
+						prop->SetLabel( childObj->GetPropertyAsStringByKey( PROP_LABEL ) );
+						prop->SetName( childObj->GetPropertyAsStringByKey( PROP_LABEL ) );
 						pg->Append( prop );
 
-						if( childObj->GetPropertyAsString( _("help") ) != wxEmptyString )
+						if( childObj->GetPropertyAsStringByKey( PROP_HELP ) != wxEmptyString )
 						{
-							pg->SetPropertyHelpString( prop, childObj->GetPropertyAsString( _("help") ) );
+							pg->SetPropertyHelpString( prop, childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 						}
 					}
 				}
@@ -1488,17 +1584,17 @@ class PropertyGridManagerComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxPropertyGridManager* pgman = new wxPropertyGridManager((wxWindow *)parent, wxID_ANY,
-																obj->GetPropertyAsPoint(wxT("pos")),
-																obj->GetPropertyAsSize(wxT("size")),
-																obj->GetPropertyAsInteger(wxT("style")) |
-																obj->GetPropertyAsInteger(wxT("window_style")));
+																obj->GetPropertyAsPointByKey(PROP_POS),
+																obj->GetPropertyAsSizeByKey(PROP_SIZE),
+																obj->GetPropertyAsIntegerByKey(PROP_STYLE) |
+																obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		if ( !obj->GetPropertyAsString( wxT("extra_style") ).empty() )
+		if ( !obj->GetPropertyAsStringByKey( PROP_EXTRA_STYLE ).empty() )
 		{
-			pgman->SetExtraStyle( obj->GetPropertyAsInteger( wxT("extra_style") ) );
+			pgman->SetExtraStyle( obj->GetPropertyAsIntegerByKey( PROP_EXTRA_STYLE ) );
 		}
 
-		pgman->ShowHeader(obj->GetPropertyAsInteger(wxT("show_header")) != 0);
+		pgman->ShowHeader(obj->GetPropertyAsIntegerByKey(PROP_SHOW_HEADER) != 0);
 
 		// Adding a page sets target page to the one added, so
 		// we don't have to call SetTargetPage if we are filling
@@ -1563,7 +1659,7 @@ public:
 
 		pg2->AppendIn( carProp2, new wxIntProperty( _("Price ($)"), wxPG_LABEL, 300000 ) );
 
-		if ( obj->GetPropertyAsInteger( wxT("include_advanced") ) )
+		if ( obj->GetPropertyAsIntegerByKey( PROP_INCLUDE_ADVANCED ) )
 		{
 			pg2->Append( new wxPropertyCategory( _("Advanced Properties"), wxPG_LABEL ) );
 			// wxArrayStringProperty embeds a wxArrayString.
@@ -1612,29 +1708,29 @@ public:
 			IObject* childObj = GetManager()->GetIObject( child );
 			if (childObj->GetClassName() == _("propGridPage"))
 			{
-				wxPropertyGridPage *page = pgm->AddPage( childObj->GetPropertyAsString( _("label") ), childObj->GetPropertyAsBitmap( _("bitmap") ) );
+				wxPropertyGridPage *page = pgm->AddPage( childObj->GetPropertyAsStringByKey( PROP_LABEL ), childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ) );
 
 				for( size_t j = 0; j < childObj->GetChildCount(); ++j )
 				{
 					IObject* innerChildObj = childObj->GetChildPtr( j );
 					if (innerChildObj->GetClassName() == _("propGridItem"))
 					{
-						if (innerChildObj->GetPropertyAsString( _("type") ) == _("Category") )
+						if (innerChildObj->GetPropertyAsStringByKey( PROP_TYPE ) == _("Category") )
 						{
-							page->Append( new wxPropertyCategory( innerChildObj->GetPropertyAsString( _("label") ), innerChildObj->GetPropertyAsString( _("label") ) ) );
+							page->Append( new wxPropertyCategory( innerChildObj->GetPropertyAsStringByKey( PROP_LABEL ), innerChildObj->GetPropertyAsStringByKey( PROP_LABEL ) ) );
 						}
 						else
 						{
-							wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (innerChildObj->GetPropertyAsString( _("type") ) ) + wxT("Property") ), wxPGProperty );
+							wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (innerChildObj->GetPropertyAsStringByKey( PROP_TYPE ) ) + wxT("Property") ), wxPGProperty );
 							if( prop )
 							{
-								prop->SetLabel( innerChildObj->GetPropertyAsString( _("label") ) );
-								prop->SetName( innerChildObj->GetPropertyAsString( _("label") ) );
+								prop->SetLabel( innerChildObj->GetPropertyAsStringByKey( PROP_LABEL ) );
+								prop->SetName( innerChildObj->GetPropertyAsStringByKey( PROP_LABEL ) );
 								page->Append( prop );
 
-								if( innerChildObj->GetPropertyAsString( _("help") ) != wxEmptyString )
+								if( innerChildObj->GetPropertyAsStringByKey( PROP_HELP ) != wxEmptyString )
 								{
-									page->SetPropertyHelpString( prop, innerChildObj->GetPropertyAsString( _("help") ) );
+									page->SetPropertyHelpString( prop, innerChildObj->GetPropertyAsStringByKey( PROP_HELP ) );
 								}
 							}
 						}
@@ -1660,14 +1756,14 @@ class StyledTextComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxStyledTextCtrl* m_code = new wxStyledTextCtrl( 	(wxWindow *)parent, wxID_ANY,
-												obj->GetPropertyAsPoint(_("pos")),
-												obj->GetPropertyAsSize(_("size")),
-												obj->GetPropertyAsInteger(_("window_style")),
-												obj->GetPropertyAsString(_("name"))
+												obj->GetPropertyAsPointByKey(PROP_POS),
+												obj->GetPropertyAsSizeByKey(PROP_SIZE),
+												obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE),
+												obj->GetPropertyAsStringByKey(PROP_NAME)
 											);
 
 		// Line Numbers
-		if ( 0 != obj->GetPropertyAsInteger(_("line_numbers") ) )
+		if ( 0 != obj->GetPropertyAsIntegerByKey(PROP_LINE_NUMBERS ) )
 		{
 			m_code->SetMarginType( 0, wxSTC_MARGIN_NUMBER );
 			m_code->SetMarginWidth( 0, m_code->TextWidth (wxSTC_STYLE_LINENUMBER, wxT("_99999"))  );
@@ -1695,7 +1791,7 @@ public:
 		m_code->MarkerDefine (wxSTC_MARKNUM_FOLDERTAIL, wxSTC_MARK_EMPTY);
 
 		// folding
-		if ( 0 != obj->GetPropertyAsInteger(_("folding") ) )
+		if ( 0 != obj->GetPropertyAsIntegerByKey(PROP_FOLDING ) )
 		{
 			m_code->SetMarginType (1, wxSTC_MARGIN_SYMBOL);
 			m_code->SetMarginMask (1, wxSTC_MASK_FOLDERS);
@@ -1709,7 +1805,7 @@ public:
 		{
 			m_code->SetMarginWidth( 1, 0 );
 		}
-		m_code->SetIndentationGuides(obj->GetPropertyAsInteger(_("indentation_guides")));
+		m_code->SetIndentationGuides(obj->GetPropertyAsIntegerByKey(PROP_INDENTATION_GUIDES));
 
 		m_code->SetMarginWidth( 2, 0 );
 
@@ -1724,9 +1820,9 @@ public:
 							   while"));
 
 		wxFont font(10, wxFONTFAMILY_MODERN, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL);
-		if ( !obj->GetPropertyAsString(_("font")).empty() )
+		if ( !obj->GetPropertyAsStringByKey(PROP_FONT).empty() )
 		{
-			font = obj->GetPropertyAsFont(_("font"));
+			font = obj->GetPropertyAsFontByKey(PROP_FONT);
 		}
 
 		m_code->StyleSetFont(wxSTC_STYLE_DEFAULT, font );
@@ -1742,15 +1838,15 @@ public:
 		m_code->StyleSetForeground(wxSTC_C_COMMENTDOC, wxColour(0, 128, 0));
 		m_code->StyleSetForeground(wxSTC_C_COMMENTLINEDOC, wxColour(0, 128, 0));
 		m_code->StyleSetForeground(wxSTC_C_NUMBER, *wxBLUE );
-		m_code->SetUseTabs( ( 0 != obj->GetPropertyAsInteger( _("use_tabs") ) ) );
-		m_code->SetTabWidth( obj->GetPropertyAsInteger( _("tab_width") ) );
-		m_code->SetTabIndents( ( 0 != obj->GetPropertyAsInteger( _("tab_indents") ) ) );
-		m_code->SetBackSpaceUnIndents( ( 0 != obj->GetPropertyAsInteger( _("backspace_unindents") ) ) );
-		m_code->SetIndent( obj->GetPropertyAsInteger( _("tab_width") ) );
+		m_code->SetUseTabs( ( 0 != obj->GetPropertyAsIntegerByKey( PROP_USE_TABS ) ) );
+		m_code->SetTabWidth( obj->GetPropertyAsIntegerByKey( PROP_TAB_WIDTH ) );
+		m_code->SetTabIndents( ( 0 != obj->GetPropertyAsIntegerByKey( PROP_TAB_INDENTS ) ) );
+		m_code->SetBackSpaceUnIndents( ( 0 != obj->GetPropertyAsIntegerByKey( PROP_BACKSPACE_UNINDENTS ) ) );
+		m_code->SetIndent( obj->GetPropertyAsIntegerByKey( PROP_TAB_WIDTH ) );
 		m_code->SetSelBackground(true, wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHT));
 		m_code->SetSelForeground(true, wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHTTEXT));
-		m_code->SetViewEOL( ( 0 != obj->GetPropertyAsInteger( _("view_eol") ) ) );
-		m_code->SetViewWhiteSpace(obj->GetPropertyAsInteger(_("view_whitespace")));
+		m_code->SetViewEOL( ( 0 != obj->GetPropertyAsIntegerByKey( PROP_VIEW_EOL ) ) );
+		m_code->SetViewWhiteSpace(obj->GetPropertyAsIntegerByKey(PROP_VIEW_WHITESPACE));
 
 		m_code->SetCaretWidth(2);
 
@@ -1833,9 +1929,9 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxDataViewCtrl* dataViewCtrl = new wxDataViewCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 			wxObjectDataPtr<DataViewModel> model;
 			model = new DataViewModel;
@@ -1858,94 +1954,94 @@ public:
 			IObject* childObj = GetManager()->GetIObject( child );
 			if (childObj->GetClassName() == _("dataViewColumn"))
 			{
-				if (childObj->GetPropertyAsString( _("type")) == _("Text"))
+				if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("Text"))
 				{
 					auto* col = list->AppendTextColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						childObj->GetPropertyAsIntegerByKey(PROP_MODEL_COLUMN),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Toggle"))
+				else if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("Toggle"))
 				{
 					auto* col = list->AppendToggleColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						childObj->GetPropertyAsIntegerByKey(PROP_MODEL_COLUMN),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Progress"))
+				else if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("Progress"))
 				{
 					auto* col = list->AppendProgressColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						childObj->GetPropertyAsIntegerByKey(PROP_MODEL_COLUMN),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("IconText"))
+				else if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("IconText"))
 				{
 					auto* col = list->AppendIconTextColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						childObj->GetPropertyAsIntegerByKey(PROP_MODEL_COLUMN),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Date"))
+				else if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("Date"))
 				{
 					auto* col = list->AppendDateColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						childObj->GetPropertyAsIntegerByKey(PROP_MODEL_COLUMN),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Bitmap"))
+				else if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("Bitmap"))
 				{
 					auto* col = list->AppendBitmapColumn(
-						childObj->GetPropertyAsString(_("label")),
-						childObj->GetPropertyAsInteger(_("model_column")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						childObj->GetPropertyAsIntegerByKey(PROP_MODEL_COLUMN),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
 			}
@@ -1961,9 +2057,9 @@ public:
 	{
 		wxDataViewTreeCtrl* dataViewTreeCtrl = new wxDataViewTreeCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		return dataViewTreeCtrl;
 	}
@@ -1975,9 +2071,9 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxDataViewListCtrl* dataViewListCtrl = new wxDataViewListCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		return dataViewListCtrl;
 	}
@@ -1997,60 +2093,60 @@ public:
 			IObject* childObj = GetManager()->GetIObject( child );
 			if (childObj->GetClassName() == _("dataViewListColumn"))
 			{
-				if (childObj->GetPropertyAsString( _("type")) == _("Text"))
+				if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("Text"))
 				{
 					auto* col = list->AppendTextColumn(
-						childObj->GetPropertyAsString(_("label")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Toggle"))
+				else if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("Toggle"))
 				{
 					auto* col = list->AppendToggleColumn(
-						childObj->GetPropertyAsString(_("label")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Progress"))
+				else if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("Progress"))
 				{
 					auto* col = list->AppendProgressColumn(
-						childObj->GetPropertyAsString(_("label")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("IconText"))
+				else if (childObj->GetPropertyAsStringByKey( PROP_TYPE) == _("IconText"))
 				{
 					auto* col = list->AppendIconTextColumn(
-						childObj->GetPropertyAsString(_("label")),
-						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsInteger(_("mode"))),
-						childObj->GetPropertyAsInteger(_("width")),
-						static_cast<wxAlignment>(childObj->GetPropertyAsInteger(_("align"))),
-						childObj->GetPropertyAsInteger(_("flags"))
+						childObj->GetPropertyAsStringByKey(PROP_LABEL),
+						static_cast<wxDataViewCellMode>(childObj->GetPropertyAsIntegerByKey(PROP_MODE)),
+						childObj->GetPropertyAsIntegerByKey(PROP_WIDTH),
+						static_cast<wxAlignment>(childObj->GetPropertyAsIntegerByKey(PROP_ALIGN)),
+						childObj->GetPropertyAsIntegerByKey(PROP_FLAGS)
 					);
-					if (!childObj->IsNull(_("ellipsize")))
+					if (!childObj->IsNullByKey(PROP_ELLIPSIZE))
 					{
-						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsInteger(_("ellipsize"))));
+						col->GetRenderer()->EnableEllipsize(static_cast<wxEllipsizeMode>(childObj->GetPropertyAsIntegerByKey(PROP_ELLIPSIZE)));
 					}
 				}
 			}
@@ -2069,9 +2165,9 @@ class wxcoreTreeListCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxTreeListCtrl* treeListCtrl = new wxTreeListCtrl( (wxWindow *)parent, wxID_ANY,
-				obj->GetPropertyAsPoint(_("pos")),
-				obj->GetPropertyAsSize(_("size")),
-				obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+				obj->GetPropertyAsPointByKey(PROP_POS),
+				obj->GetPropertyAsSizeByKey(PROP_SIZE),
+				obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		return treeListCtrl;
 	}
@@ -2136,10 +2232,10 @@ public:
 			return;
 		}
 
-		treeList->AppendColumn( obj->GetPropertyAsString( _("name") ),
-			obj->GetPropertyAsInteger( _("width") ),
-			static_cast< wxAlignment >( obj->GetPropertyAsInteger( _("alignment") ) ),
-			obj->GetPropertyAsInteger( _("flag") ) );
+		treeList->AppendColumn( obj->GetPropertyAsStringByKey( PROP_NAME ),
+			obj->GetPropertyAsIntegerByKey( PROP_WIDTH ),
+			static_cast< wxAlignment >( obj->GetPropertyAsIntegerByKey( PROP_ALIGNMENT ) ),
+			obj->GetPropertyAsIntegerByKey( PROP_FLAG ) );
 	}
 
 	void OnSelected(wxObject*) override {
@@ -2151,15 +2247,15 @@ class RibbonBarComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonBar *rb = new wxRibbonBar((wxWindow*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))  );
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)  );
 
-		if( obj->GetPropertyAsString( _("theme"))  == _("Default"))
+		if( obj->GetPropertyAsStringByKey( PROP_THEME)  == _("Default"))
 				rb->SetArtProvider( new wxRibbonDefaultArtProvider );
-		else if( obj->GetPropertyAsString( _("theme"))  == _("Generic"))
+		else if( obj->GetPropertyAsStringByKey( PROP_THEME)  == _("Generic"))
 				rb->SetArtProvider( new wxRibbonAUIArtProvider );
-		else if( obj->GetPropertyAsString( _("theme"))  == _("MSW") )
+		else if( obj->GetPropertyAsStringByKey( PROP_THEME)  == _("MSW") )
 				rb->SetArtProvider( new wxRibbonMSWArtProvider );
 
 		rb->PushEventHandler( new ComponentEvtHandler( rb, GetManager() ) );
@@ -2210,9 +2306,9 @@ void ComponentEvtHandler::OnRibbonBarPageChanged( wxRibbonBarEvent& event )
 		IObject*  iChild = m_manager->GetIObject( wxChild );
 		if ( iChild )
 		{
-			if (int(i) == selPage && iChild->GetPropertyAsInteger(_("select")) == 0) {
+			if (int(i) == selPage && iChild->GetPropertyAsIntegerByKey(PROP_SELECT) == 0) {
 				m_manager->ModifyProperty( wxChild, _("select"), wxT("1"), false );
-			} else if (int(i) != selPage && iChild->GetPropertyAsInteger(_("select")) != 0) {
+			} else if (int(i) != selPage && iChild->GetPropertyAsIntegerByKey(PROP_SELECT) != 0) {
 				m_manager->ModifyProperty( wxChild, _("select"), wxT("0"), false );
 			}
 		}
@@ -2230,11 +2326,11 @@ class RibbonPageComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonPage *rbpage = new wxRibbonPage((wxRibbonBar*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsBitmap(_("bitmap")),
+			obj->GetPropertyAsStringByKey(PROP_LABEL),
+			obj->GetPropertyAsBitmapByKey(PROP_BITMAP),
 			0);
 
-		if (obj->GetPropertyAsInteger(_("select")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_SELECT) != 0) {
 			((wxRibbonBar*)parent)->SetActivePage(rbpage);
 		}
 
@@ -2260,11 +2356,11 @@ class RibbonPanelComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonPanel *rbp = new wxRibbonPanel((wxRibbonPage*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))  );
+			obj->GetPropertyAsStringByKey(PROP_LABEL),
+			obj->GetPropertyAsBitmapByKey(PROP_BITMAP),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)  );
 
 		//rbp->PushEventHandler( new ComponentEvtHandler( rbp, GetManager() ) );
 
@@ -2288,8 +2384,8 @@ class RibbonButtonBarComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonButtonBar *rbb = new wxRibbonButtonBar((wxRibbonPanel*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			0);
 
 		//rbb->PushEventHandler( new ComponentEvtHandler( rbb, GetManager() ) );
@@ -2324,27 +2420,27 @@ class RibbonButtonBarComponent : public ComponentBase
 			if (childObj->GetClassName() == wxT("ribbonButton"))
 			{
 				rb->AddButton(wxID_ANY,
-							childObj->GetPropertyAsString( _("label") ),
-							childObj->GetPropertyAsBitmap( _("bitmap") ),
-							childObj->GetPropertyAsString( _("help") ) );
+							childObj->GetPropertyAsStringByKey( PROP_LABEL ),
+							childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
+							childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 			} else if (childObj->GetClassName() == wxT("ribbonDropdownButton"))
 			{
 				rb->AddDropdownButton(wxID_ANY,
-									childObj->GetPropertyAsString( _("label") ),
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsStringByKey( PROP_LABEL ),
+									childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
+									childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 			} else if (childObj->GetClassName() == wxT("ribbonHybridButton"))
 			{
 				rb->AddHybridButton(wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsStringByKey( PROP_LABEL ),
+								childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
+								childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 			} else if (childObj->GetClassName() == wxT("ribbonToggleButton"))
 			{
 				rb->AddToggleButton(wxID_ANY,
-									childObj->GetPropertyAsString( _("label") ),
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsStringByKey( PROP_LABEL ),
+									childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
+									childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 			}
 		}
 	}
@@ -2360,8 +2456,8 @@ class RibbonToolBarComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonToolBar *rbb = new wxRibbonToolBar((wxRibbonPanel*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			0 );
 
 		//rbb->PushEventHandler( new ComponentEvtHandler( rbb, GetManager() ) );
@@ -2396,23 +2492,23 @@ class RibbonToolBarComponent : public ComponentBase
 			if (wxT("ribbonTool") == childObj->GetClassName() )
 			{
 				rb->AddTool(wxID_ANY,
-							childObj->GetPropertyAsBitmap( _("bitmap") ),
-							childObj->GetPropertyAsString( _("help") ) );
+							childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
+							childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 			} else if (wxT("ribbonDropdownTool") == childObj->GetClassName() )
 			{
 				rb->AddDropdownTool(wxID_ANY,
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
+									childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 			} else if (wxT("ribbonHybridTool") == childObj->GetClassName() )
 			{
 				rb->AddHybridTool(wxID_ANY,
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
+								childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 			} else if (wxT("ribbonToggleTool") == childObj->GetClassName() )
 			{
 				rb->AddToggleTool(wxID_ANY,
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
+								childObj->GetPropertyAsStringByKey( PROP_HELP ) );
 
 			}
 		}
@@ -2429,8 +2525,8 @@ class RibbonGalleryComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRibbonGallery *ribbonGallery = new wxRibbonGallery((wxRibbonPanel*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			0);
 
 		//ribbonGallery->PushEventHandler( new ComponentEvtHandler( ribbonGallery, GetManager() ) );
@@ -2464,7 +2560,7 @@ class RibbonGalleryComponent : public ComponentBase
 			IObject* childObj = GetManager()->GetIObject( child );
 			if ( wxT("ribbonGalleryItem") == childObj->GetClassName() )
 			{
-				rg->Append(childObj->GetPropertyAsBitmap( _("bitmap") ), wxID_ANY );
+				rg->Append(childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ), wxID_ANY );
 			}
 		}
 	}
@@ -36,6 +36,49 @@
 #include <wx/infobar.h>
 #endif
 
+// Properties read by the components, resolved once per class
+constexpr PropertyKey PROP_ANIMATION( "animation" );
+constexpr PropertyKey PROP_BITMAP( "bitmap" );
+constexpr PropertyKey PROP_BITMAPSIZE( "bitmapsize" );
+constexpr PropertyKey PROP_CHECKED( "checked" );
+constexpr PropertyKey PROP_CHOICES( "choices" );
+constexpr PropertyKey PROP_CONTEXT_MENU( "context_menu" );
+constexpr PropertyKey PROP_CURRENT( "current" );
+constexpr PropertyKey PROP_DEFAULT( "default" );
+constexpr PropertyKey PROP_DISABLED( "disabled" );
+constexpr PropertyKey PROP_DURATION( "duration" );
+constexpr PropertyKey PROP_ENABLED( "enabled" );
+constexpr PropertyKey PROP_FIELDS( "fields" );
+constexpr PropertyKey PROP_FOCUS( "focus" );
+constexpr PropertyKey PROP_HELP( "help" );
+constexpr PropertyKey PROP_HIDE_EFFECT( "hide_effect" );
+constexpr PropertyKey PROP_INACTIVE_BITMAP( "inactive_bitmap" );
+constexpr PropertyKey PROP_KIND( "kind" );
+constexpr PropertyKey PROP_LABEL( "label" );
+constexpr PropertyKey PROP_MAJORDIMENSION( "majorDimension" );
+constexpr PropertyKey PROP_MARGINS( "margins" );
+constexpr PropertyKey PROP_MARKUP( "markup" );
+constexpr PropertyKey PROP_MAXLENGTH( "maxlength" );
+constexpr PropertyKey PROP_MAXVALUE( "maxValue" );
+constexpr PropertyKey PROP_MINVALUE( "minValue" );
+constexpr PropertyKey PROP_NAME( "name" );
+constexpr PropertyKey PROP_PACKING( "packing" );
+constexpr PropertyKey PROP_PLAY( "play" );
+constexpr PropertyKey PROP_POS( "pos" );
+constexpr PropertyKey PROP_POSITION( "position" );
+constexpr PropertyKey PROP_PRESSED( "pressed" );
+constexpr PropertyKey PROP_RANGE( "range" );
+constexpr PropertyKey PROP_SELECTION( "selection" );
+constexpr PropertyKey PROP_SEPARATION( "separation" );
+constexpr PropertyKey PROP_SHORTCUT( "shortcut" );
+constexpr PropertyKey PROP_SHOW_EFFECT( "show_effect" );
+constexpr PropertyKey PROP_SIZE( "size" );
+constexpr PropertyKey PROP_STYLE( "style" );
+constexpr PropertyKey PROP_UNCHECKED_BITMAP( "unchecked_bitmap" );
+constexpr PropertyKey PROP_VALUE( "value" );
+constexpr PropertyKey PROP_WINDOW_STYLE( "window_style" );
+constexpr PropertyKey PROP_WRAP( "wrap" );
+
 ///////////////////////////////////////////////////////////////////////////////
 // Custom status bar class for windows to prevent the status bar gripper from
 // moving the entire wxFB window
@@ -180,87 +223,87 @@ class ButtonComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxString label = obj->GetPropertyAsString( _("label") );
+		wxString label = obj->GetPropertyAsStringByKey( PROP_LABEL );
 		wxButton* button = new wxButton((wxWindow*)parent, wxID_ANY,
 			label,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 #if wxCHECK_VERSION( 2, 9, 2 )
-		if (obj->GetPropertyAsInteger(_("markup")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_MARKUP) != 0) {
 			button->SetLabelMarkup(label);
 		}
 #endif
 
-		if ( obj->GetPropertyAsInteger( _("default") ) != 0 )
+		if ( obj->GetPropertyAsIntegerByKey( PROP_DEFAULT ) != 0 )
 		{
 			button->SetDefault();
 		}
 
-		if (!obj->IsNull(_("bitmap"))) {
-			button->SetBitmap(obj->GetPropertyAsBitmap(_("bitmap")));
+		if (!obj->IsNullByKey(PROP_BITMAP)) {
+			button->SetBitmap(obj->GetPropertyAsBitmapByKey(PROP_BITMAP));
 		}
 
-		if (!obj->IsNull(_("disabled"))) {
-			button->SetBitmapDisabled(obj->GetPropertyAsBitmap(_("disabled")));
+		if (!obj->IsNullByKey(PROP_DISABLED)) {
+			button->SetBitmapDisabled(obj->GetPropertyAsBitmapByKey(PROP_DISABLED));
 		}
 
-		if (!obj->IsNull(_("pressed"))) {
-			button->SetBitmapPressed(obj->GetPropertyAsBitmap(_("pressed")));
+		if (!obj->IsNullByKey(PROP_PRESSED)) {
+			button->SetBitmapPressed(obj->GetPropertyAsBitmapByKey(PROP_PRESSED));
 		}
 
-		if (!obj->IsNull(_("focus"))) {
-			button->SetBitmapFocus(obj->GetPropertyAsBitmap(_("focus")));
+		if (!obj->IsNullByKey(PROP_FOCUS)) {
+			button->SetBitmapFocus(obj->GetPropertyAsBitmapByKey(PROP_FOCUS));
 		}
 
-		if (!obj->IsNull(_("current"))) {
-			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(_("current")));
+		if (!obj->IsNullByKey(PROP_CURRENT)) {
+			button->SetBitmapCurrent(obj->GetPropertyAsBitmapByKey(PROP_CURRENT));
 		}
 
-		if (!obj->IsNull(_("position"))) {
+		if (!obj->IsNullByKey(PROP_POSITION)) {
 			button->SetBitmapPosition(
-			    static_cast<wxDirection>(obj->GetPropertyAsInteger(_("position"))));
+			    static_cast<wxDirection>(obj->GetPropertyAsIntegerByKey(PROP_POSITION)));
 		}
 
-		if (!obj->IsNull(_("margins"))) {
-			button->SetBitmapMargins(obj->GetPropertyAsSize(_("margins")));
+		if (!obj->IsNullByKey(PROP_MARGINS)) {
+			button->SetBitmapMargins(obj->GetPropertyAsSizeByKey(PROP_MARGINS));
 		}
 
 		return button;
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("wxButton"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
 		xrc.AddProperty(_("markup"), _("markup"), XRC_TYPE_BOOL);
 		xrc.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
-		if (!obj->IsNull(_("disabled"))) {
+		if (!obj->IsNullByKey(PROP_DISABLED)) {
 			xrc.AddProperty(_("disabled"), _("disabled"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("pressed"))) {
+		if (!obj->IsNullByKey(PROP_PRESSED)) {
 			xrc.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("focus"))) {
+		if (!obj->IsNullByKey(PROP_FOCUS)) {
 			xrc.AddProperty(_("focus"), _("focus"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("current"))) {
+		if (!obj->IsNullByKey(PROP_CURRENT)) {
 			xrc.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("position"))) {
+		if (!obj->IsNullByKey(PROP_POSITION)) {
 			xrc.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
 		}
-		if (!obj->IsNull(_("margins"))) {
+		if (!obj->IsNullByKey(PROP_MARGINS)) {
 			xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
 		}
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxButton"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxButton"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
@@ -272,7 +315,7 @@ public:
 		filter.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
 		filter.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -281,84 +324,84 @@ class BitmapButtonComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxBitmapButton* button = new wxBitmapButton((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsBitmapByKey(PROP_BITMAP),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 #if wxCHECK_VERSION( 2, 9, 2 )
 		// To stay in sync what the generator templates do apply the markup label here as well
-		if (obj->GetPropertyAsInteger(_("markup")) != 0) {
-			button->SetLabelMarkup(obj->GetPropertyAsString(_("label")));
+		if (obj->GetPropertyAsIntegerByKey(PROP_MARKUP) != 0) {
+			button->SetLabelMarkup(obj->GetPropertyAsStringByKey(PROP_LABEL));
 		}
 #endif
 
-		if ( obj->GetPropertyAsInteger( _("default") ) != 0 )
+		if ( obj->GetPropertyAsIntegerByKey( PROP_DEFAULT ) != 0 )
 		{
 			button->SetDefault();
 		}
 
-		if ( !obj->IsNull( _("disabled") ) )
+		if ( !obj->IsNullByKey( PROP_DISABLED ) )
 		{
-			button->SetBitmapDisabled( obj->GetPropertyAsBitmap( _("disabled") ) );
+			button->SetBitmapDisabled( obj->GetPropertyAsBitmapByKey( PROP_DISABLED ) );
 		}
 
-		if (!obj->IsNull(_("pressed"))) {
-			button->SetBitmapPressed(obj->GetPropertyAsBitmap(_("pressed")));
+		if (!obj->IsNullByKey(PROP_PRESSED)) {
+			button->SetBitmapPressed(obj->GetPropertyAsBitmapByKey(PROP_PRESSED));
 		}
 
-		if ( !obj->IsNull( _("focus") ) )
+		if ( !obj->IsNullByKey( PROP_FOCUS ) )
 		{
-			button->SetBitmapFocus( obj->GetPropertyAsBitmap( _("focus") ) );
+			button->SetBitmapFocus( obj->GetPropertyAsBitmapByKey( PROP_FOCUS ) );
 		}
 
-		if (!obj->IsNull(_("current"))) {
-			button->SetBitmapCurrent(obj->GetPropertyAsBitmap(_("current")));
+		if (!obj->IsNullByKey(PROP_CURRENT)) {
+			button->SetBitmapCurrent(obj->GetPropertyAsBitmapByKey(PROP_CURRENT));
 		}
 
-		if (!obj->IsNull(_("position"))) {
+		if (!obj->IsNullByKey(PROP_POSITION)) {
 			button->SetBitmapPosition(
-			    static_cast<wxDirection>(obj->GetPropertyAsInteger(_("position"))));
+			    static_cast<wxDirection>(obj->GetPropertyAsIntegerByKey(PROP_POSITION)));
 		}
 
-		if (!obj->IsNull(_("margins"))) {
-			button->SetBitmapMargins(obj->GetPropertyAsSize(_("margins")));
+		if (!obj->IsNullByKey(PROP_MARGINS)) {
+			button->SetBitmapMargins(obj->GetPropertyAsSizeByKey(PROP_MARGINS));
 		}
 
 		return button;
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxBitmapButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("wxBitmapButton"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		if ( !obj->IsNull( _("disabled") ) )
+		if ( !obj->IsNullByKey( PROP_DISABLED ) )
 		{
 			xrc.AddProperty(_("disabled"),_("disabled"),XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("pressed"))) {
+		if (!obj->IsNullByKey(PROP_PRESSED)) {
 			xrc.AddProperty(_("pressed"), _("pressed"), XRC_TYPE_BITMAP);
 		}
-		if ( !obj->IsNull( _("focus") ) )
+		if ( !obj->IsNullByKey( PROP_FOCUS ) )
 		{
 			xrc.AddProperty(_("focus"),_("focus"),XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("current"))) {
+		if (!obj->IsNullByKey(PROP_CURRENT)) {
 			xrc.AddProperty(_("current"), _("current"), XRC_TYPE_BITMAP);
 		}
-		if (!obj->IsNull(_("position"))) {
+		if (!obj->IsNullByKey(PROP_POSITION)) {
 			xrc.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
 		}
-		if (!obj->IsNull(_("margins"))) {
+		if (!obj->IsNullByKey(PROP_MARGINS)) {
 			xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
 		}
 		xrc.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxBitmapButton"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxBitmapButton"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
 		filter.AddProperty(_("disabled"),_("disabled"),XRC_TYPE_BITMAP);
@@ -368,7 +411,7 @@ public:
 		filter.AddProperty(_("position"), _("position"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
 		filter.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -378,14 +421,14 @@ class TextCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxTextCtrl* tc = new wxTextCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByKey(PROP_VALUE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		if ( !obj->IsNull( _("maxlength") ) )
+		if ( !obj->IsNullByKey( PROP_MAXLENGTH ) )
 		{
-			tc->SetMaxLength( obj->GetPropertyAsInteger( _("maxlength") ) );
+			tc->SetMaxLength( obj->GetPropertyAsIntegerByKey( PROP_MAXLENGTH ) );
 		}
 
 		tc->PushEventHandler( new ComponentEvtHandler( tc, GetManager() ) );
@@ -402,22 +445,22 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxTextCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("wxTextCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-		if (!obj->IsNull(_("maxlength")))
+		if (!obj->IsNullByKey(PROP_MAXLENGTH))
 			xrc.AddProperty(_("maxlength"), _("maxlength"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxTextCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxTextCtrl"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("maxlength"), _("maxlength"), XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 
 };
@@ -447,17 +490,17 @@ class StaticTextComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxString label = obj->GetPropertyAsString( _("label") );
+		wxString label = obj->GetPropertyAsStringByKey( PROP_LABEL );
 		wxStaticText* st = new wxStaticText((wxWindow *)parent, wxID_ANY,
 			label,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		st->Wrap( obj->GetPropertyAsInteger( _("wrap") ) );
+		st->Wrap( obj->GetPropertyAsIntegerByKey( PROP_WRAP ) );
 
 #if wxCHECK_VERSION( 2, 9, 2 )
-		if (obj->GetPropertyAsInteger(_("markup")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_MARKUP) != 0) {
 			st->SetLabelMarkup(label);
 		}
 #endif
@@ -465,22 +508,22 @@ public:
 		return st;
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		wxString name = obj->GetPropertyAsString(_("name"));
-		ObjectToXrcFilter xrc(obj, _("wxStaticText"), name);
+		wxString name = obj->GetPropertyAsStringByKey(PROP_NAME);
+		ObjectToXrcFilter xrc(writer, obj, _("wxStaticText"), name);
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("wrap"),_("wrap"),XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStaticText"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxStaticText"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("wrap"),_("wrap"),XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -489,19 +532,19 @@ class ComboBoxComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxComboBox *combo = new wxComboBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsStringByKey(PROP_VALUE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByKey(PROP_CHOICES);
 		for (unsigned int i=0; i<choices.GetCount(); i++)
 			combo->Append(choices[i]);
 
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsIntegerByKey(PROP_SELECTION);
 		if( sel > -1 && sel < (int) choices.GetCount() ) combo->SetSelection(sel);
 
 		combo->PushEventHandler( new ComponentEvtHandler( combo, GetManager() ) );
@@ -518,21 +561,21 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxComboBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("wxComboBox"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("choices"),_("content"),XRC_TYPE_STRINGLIST);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxComboBox"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxComboBox"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("content"),_("choices"),XRC_TYPE_STRINGLIST);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -541,22 +584,22 @@ class BitmapComboBoxComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxBitmapComboBox *bcombo = new wxBitmapComboBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsStringByKey(PROP_VALUE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByKey(PROP_CHOICES);
 		for (unsigned int i=0; i<choices.GetCount(); i++)
 		{
 			wxImage img(choices[i].BeforeFirst(wxChar(58)));
 			bcombo->Append(choices[i].AfterFirst(wxChar(58)), wxBitmap(img));
 		}
 
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsIntegerByKey(PROP_SELECTION);
 		if( sel > -1 && sel < (int) choices.GetCount() ) bcombo->SetSelection(sel);
 
 		bcombo->PushEventHandler( new ComponentEvtHandler( bcombo, GetManager() ) );
@@ -573,20 +616,20 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxBitmapComboBox"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxBitmapComboBox"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("choices"),_("content"),XRC_TYPE_STRINGLIST);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxBitmapComboBox"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxBitmapComboBox"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("content"),_("choices"),XRC_TYPE_STRINGLIST);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -595,11 +638,11 @@ class CheckBoxComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxCheckBox *res = new wxCheckBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")) | obj->GetPropertyAsInteger(_T("style")));
-		res->SetValue(obj->GetPropertyAsInteger(_T("checked")) != 0);
+			obj->GetPropertyAsStringByKey(PROP_LABEL),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_STYLE));
+		res->SetValue(obj->GetPropertyAsIntegerByKey(PROP_CHECKED) != 0);
 
 		res->PushEventHandler( new ComponentEvtHandler( res, GetManager() ) );
 
@@ -615,20 +658,20 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxCheckBox"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxCheckBox"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("checked"),_("checked"),XRC_TYPE_BOOL);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxCheckBox"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxCheckBox"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("checked"),_("checked"),XRC_TYPE_BOOL);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -649,24 +692,24 @@ class StaticBitmapComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxStaticBitmap((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsBitmapByKey(PROP_BITMAP),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStaticBitmap"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxStaticBitmap"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty( _("bitmap"), _("bitmap"), XRC_TYPE_BITMAP );
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStaticBitmap"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxStaticBitmap"));
 		filter.AddWindowProperties();
 	filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -679,21 +722,21 @@ class StaticLineComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxStaticLine((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStaticLine"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxStaticLine"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStaticLine"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxStaticLine"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -702,9 +745,9 @@ class ListCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxListCtrl *lc = new wxListCtrl((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			(obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))) & ~wxLC_VIRTUAL);
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			(obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)) & ~wxLC_VIRTUAL);
 
 
 		// Refilling
@@ -737,16 +780,16 @@ public:
 		return lc;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxListCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxListCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxListCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxListCtrl"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -755,33 +798,33 @@ class ListBoxComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxListBox *listbox = new wxListBox((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByKey(PROP_CHOICES);
 		for (unsigned int i=0; i<choices.Count(); i++)
 			listbox->Append(choices[i]);
 
 		return listbox;
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxListBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("wxListBox"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxListBox"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxListBox"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("content"),_("choices"), XRC_TYPE_STRINGLIST);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -789,7 +832,7 @@ class RadioBoxComponent : public ComponentBase, public wxEvtHandler
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByKey(PROP_CHOICES);
 		int count = choices.Count();
 		if ( 0 == count )
 		{
@@ -797,7 +840,7 @@ public:
 			count = 1;
 		}
 
-		int majorDim = obj->GetPropertyAsInteger(_("majorDimension"));
+		int majorDim = obj->GetPropertyAsIntegerByKey(PROP_MAJORDIMENSION);
 		if (majorDim < 1)
 		{
 			wxLogWarning(_("majorDimension must be greater than zero."));
@@ -805,14 +848,14 @@ public:
 		}
 
 		wxRadioBox *radiobox = new wxRadioBox((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsStringByKey(PROP_LABEL),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			choices,
 			majorDim,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		int selection = obj->GetPropertyAsInteger( _("selection") );
+		int selection = obj->GetPropertyAsIntegerByKey( PROP_SELECTION );
 		if ( selection < count )
 		{
 			radiobox->SetSelection( selection );
@@ -846,24 +889,24 @@ public:
 		ComponentBase::Cleanup( obj );
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxRadioBox"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxRadioBox"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER );
 		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
 		xrc.AddProperty(_("majorDimension"), _("dimension"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxRadioBox"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxRadioBox"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER );
 		filter.AddProperty(_("content"),_("choices"), XRC_TYPE_STRINGLIST);
 		filter.AddProperty(_("dimension"), _("majorDimension"), XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -872,29 +915,29 @@ class RadioButtonComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxRadioButton *rb = new wxRadioButton((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByKey(PROP_LABEL),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		rb->SetValue( ( obj->GetPropertyAsInteger(_("value")) != 0 ) );
+		rb->SetValue( ( obj->GetPropertyAsIntegerByKey(PROP_VALUE) != 0 ) );
 		return rb;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxRadioButton"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxRadioButton"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("value"),_("value"), XRC_TYPE_BOOL);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxRadioButton"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxRadioButton"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("value"),_("value"), XRC_TYPE_BOOL);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -903,8 +946,8 @@ class StatusBarComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxStatusBar *sb = new wxIndependentStatusBar((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
-		sb->SetFieldsCount(obj->GetPropertyAsInteger(_("fields")));
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
+		sb->SetFieldsCount(obj->GetPropertyAsIntegerByKey(PROP_FIELDS));
 
 		#ifndef __WXMSW__
 		sb->PushEventHandler( new wxLeftDownRedirect( sb, GetManager() ) );
@@ -923,18 +966,18 @@ public:
 	}
 	#endif
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStatusBar"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxStatusBar"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("fields"),_("fields"),XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStatusBar"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxStatusBar"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("fields"),_("fields"),XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -942,53 +985,53 @@ class MenuBarComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
-		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsInteger(_("style")) |
-			obj->GetPropertyAsInteger(_("window_style")));
+		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsIntegerByKey(PROP_STYLE) |
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 		return mb;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxMenuBar"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxMenuBar"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxMenuBar"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxMenuBar"));
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
 class MenuComponent : public ComponentBase
 {
 public:
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxMenu"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxMenu"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxMenu"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxMenu"));
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
 class SubMenuComponent : public ComponentBase
 {
  public:
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-	ObjectToXrcFilter xrc(obj, _("wxMenu"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+	ObjectToXrcFilter xrc(writer, obj, _("wxMenu"), obj->GetPropertyAsStringByKey(PROP_NAME));
 	xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-	return xrc.GetXrcObject();
+	return true;
   }
 
-  ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-	XrcToXfbFilter filter(xrcObj, _("submenu"));
+  bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+	XrcToXfbFilter filter(writer, xrcObj, _("submenu"));
 	filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-	return filter.GetXfbObject();
+	return true;
   }
 };
 
@@ -996,29 +1039,29 @@ class MenuItemComponent : public ComponentBase
 {
 public:
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxMenuItem"), obj->GetPropertyAsString(_("name")));
-		wxString shortcut = obj->GetPropertyAsString(_("shortcut"));
+		ObjectToXrcFilter xrc(writer, obj, _("wxMenuItem"), obj->GetPropertyAsStringByKey(PROP_NAME));
+		wxString shortcut = obj->GetPropertyAsStringByKey(PROP_SHORTCUT);
 		wxString label;
 		if (shortcut.IsEmpty())
-			label = obj->GetPropertyAsString(_("label"));
+			label = obj->GetPropertyAsStringByKey(PROP_LABEL);
 		else
-			label = obj->GetPropertyAsString(_("label")) + wxT("\t") + shortcut;
+			label = obj->GetPropertyAsStringByKey(PROP_LABEL) + wxT("\t") + shortcut;
 
 		xrc.AddPropertyValue(_("label"), label, true);
 		xrc.AddProperty(_("help"),_("help"),XRC_TYPE_TEXT);
 
-		if (!obj->IsNull(_("bitmap")))
+		if (!obj->IsNullByKey(PROP_BITMAP))
 		  xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
 
-		int kind = obj->GetPropertyAsInteger(_("kind"));
+		int kind = obj->GetPropertyAsIntegerByKey(PROP_KIND);
 
-		if (obj->GetPropertyAsInteger(_("checked")) != 0 &&
+		if (obj->GetPropertyAsIntegerByKey(PROP_CHECKED) != 0 &&
 		    (kind == wxITEM_RADIO || kind == wxITEM_CHECK)) {
 			xrc.AddProperty(_("checked"), _("checked"), XRC_TYPE_BOOL);
 		}
-		if (obj->GetPropertyAsInteger(_("enabled")) == 0)
+		if (obj->GetPropertyAsIntegerByKey(PROP_ENABLED) == 0)
 			xrc.AddProperty(_("enabled"), _("enabled"), XRC_TYPE_BOOL);
 
 		switch (kind)
@@ -1027,11 +1070,11 @@ public:
 		case wxITEM_RADIO: xrc.AddPropertyValue(_("radio"), _("1")); break;
 		}
 
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxMenuItem"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxMenuItem"));
 
 		try
 		{
@@ -1055,21 +1098,21 @@ public:
 
 		filter.AddProperty(_("help"),_("help"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
 class SeparatorComponent : public ComponentBase
 {
 public:
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("separator"));
-		return xrc.GetXrcObject();
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("separator"));
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("separator"));
-		return filter.GetXfbObject();
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("separator"));
+		return true;
 	}
 };
 
@@ -1078,21 +1121,21 @@ class ToolBarComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxToolBar *tb = new wxToolBar((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
 
-		if (!obj->IsNull(_("bitmapsize")))
-			tb->SetToolBitmapSize(obj->GetPropertyAsSize(_("bitmapsize")));
-		if (!obj->IsNull(_("margins")))
+		if (!obj->IsNullByKey(PROP_BITMAPSIZE))
+			tb->SetToolBitmapSize(obj->GetPropertyAsSizeByKey(PROP_BITMAPSIZE));
+		if (!obj->IsNullByKey(PROP_MARGINS))
 		{
-			wxSize margins(obj->GetPropertyAsSize(_("margins")));
+			wxSize margins(obj->GetPropertyAsSizeByKey(PROP_MARGINS));
 			tb->SetMargins(margins.GetWidth(), margins.GetHeight());
 		}
-		if (!obj->IsNull(_("packing")))
-			tb->SetToolPacking(obj->GetPropertyAsInteger(_("packing")));
-		if (!obj->IsNull(_("separation")))
-			tb->SetToolSeparation(obj->GetPropertyAsInteger(_("separation")));
+		if (!obj->IsNullByKey(PROP_PACKING))
+			tb->SetToolPacking(obj->GetPropertyAsIntegerByKey(PROP_PACKING));
+		if (!obj->IsNullByKey(PROP_SEPARATION))
+			tb->SetToolSeparation(obj->GetPropertyAsIntegerByKey(PROP_SEPARATION));
 
 		tb->PushEventHandler( new ComponentEvtHandler( tb, GetManager() ) );
 
@@ -1124,11 +1167,11 @@ public:
 			if ( wxT("tool") == childObj->GetClassName() )
 			{
 				tb->AddTool( 	wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
+								childObj->GetPropertyAsStringByKey( PROP_LABEL ),
+								childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
 								wxNullBitmap,
-								(wxItemKind)childObj->GetPropertyAsInteger( _("kind") ),
-								childObj->GetPropertyAsString( _("help") ),
+								(wxItemKind)childObj->GetPropertyAsIntegerByKey( PROP_KIND ),
+								childObj->GetPropertyAsStringByKey( PROP_HELP ),
 								wxEmptyString,
 								child
 							);
@@ -1150,24 +1193,24 @@ public:
 		tb->Realize();
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxToolBar"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxToolBar"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("packing"), _("packing"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("separation"), _("separation"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxToolBar"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxToolBar"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
 		filter.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
 		filter.AddProperty(_("packing"), _("packing"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("separation"), _("separation"), XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -1180,7 +1223,7 @@ wxMenu* AuiToolBar::GetMenuFromObject(IObject *menu)
 		IObject *menuItem = menu->GetChildPtr( j );
 		if ( menuItem->GetObjectTypeName() == wxT("submenu") )
 		{
-			menuWidget->Append( lastMenuId++, menuItem->GetPropertyAsString( wxT("label") ), GetMenuFromObject( menuItem ) );
+			menuWidget->Append( lastMenuId++, menuItem->GetPropertyAsStringByKey( PROP_LABEL ), GetMenuFromObject( menuItem ) );
 		}
 		else if ( menuItem->GetClassName() == wxT("separator") )
 		{
@@ -1188,8 +1231,8 @@ wxMenu* AuiToolBar::GetMenuFromObject(IObject *menu)
 		}
 		else
 		{
-			wxString label = menuItem->GetPropertyAsString( wxT("label") );
-			wxString shortcut = menuItem->GetPropertyAsString( wxT("shortcut") );
+			wxString label = menuItem->GetPropertyAsStringByKey( PROP_LABEL );
+			wxString shortcut = menuItem->GetPropertyAsStringByKey( PROP_SHORTCUT );
 			if ( !shortcut.IsEmpty() )
 			{
 				label = label + wxChar('\t') + shortcut;
@@ -1198,29 +1241,29 @@ wxMenu* AuiToolBar::GetMenuFromObject(IObject *menu)
 			wxMenuItem *item = new wxMenuItem( 	menuWidget,
 												lastMenuId++,
 												label,
-												menuItem->GetPropertyAsString( wxT("help") ),
-												( wxItemKind ) menuItem->GetPropertyAsInteger( wxT("kind") )
+												menuItem->GetPropertyAsStringByKey( PROP_HELP ),
+												( wxItemKind ) menuItem->GetPropertyAsIntegerByKey( PROP_KIND )
 											);
 
-			if ( !menuItem->IsNull( wxT("bitmap") ) )
+			if ( !menuItem->IsNullByKey( PROP_BITMAP ) )
 			{
 				wxBitmap unchecked = wxNullBitmap;
-				if ( !menuItem->IsNull( wxT("unchecked_bitmap") ) )
+				if ( !menuItem->IsNullByKey( PROP_UNCHECKED_BITMAP ) )
 				{
-					unchecked = menuItem->GetPropertyAsBitmap( wxT("unchecked_bitmap") );
+					unchecked = menuItem->GetPropertyAsBitmapByKey( PROP_UNCHECKED_BITMAP );
 				}
 				#ifdef __WXMSW__
-					item->SetBitmaps( menuItem->GetPropertyAsBitmap( wxT("bitmap") ), unchecked );
+					item->SetBitmaps( menuItem->GetPropertyAsBitmapByKey( PROP_BITMAP ), unchecked );
 				#elif defined( __WXGTK__ )
-					item->SetBitmap( menuItem->GetPropertyAsBitmap( wxT("bitmap") ) );
+					item->SetBitmap( menuItem->GetPropertyAsBitmapByKey( PROP_BITMAP ) );
 				#endif
 			}
 			else
 			{
-				if ( !menuItem->IsNull( wxT("unchecked_bitmap") ) )
+				if ( !menuItem->IsNullByKey( PROP_UNCHECKED_BITMAP ) )
 				{
 					#ifdef __WXMSW__
-						item->SetBitmaps( wxNullBitmap,  menuItem->GetPropertyAsBitmap( wxT("unchecked_bitmap") ) );
+						item->SetBitmaps( wxNullBitmap,  menuItem->GetPropertyAsBitmapByKey( PROP_UNCHECKED_BITMAP ) );
 					#endif
 				}
 			}
@@ -1228,11 +1271,11 @@ wxMenu* AuiToolBar::GetMenuFromObject(IObject *menu)
 			menuWidget->Append( item );
 
 			if (item->GetKind() == wxITEM_CHECK &&
-			    menuItem->GetPropertyAsInteger(wxT("checked")) != 0) {
+			    menuItem->GetPropertyAsIntegerByKey(PROP_CHECKED) != 0) {
 				item->Check( true );
 			}
 
-			item->Enable( ( menuItem->GetPropertyAsInteger( wxT("enabled") ) != 0 ) );
+			item->Enable( ( menuItem->GetPropertyAsIntegerByKey( PROP_ENABLED ) != 0 ) );
 		}
 	}
 
@@ -1299,21 +1342,21 @@ class AuiToolBarComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		AuiToolBar *tb = new AuiToolBar((wxWindow*)parent, GetManager(), wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) );// | obj->GetPropertyAsInteger(_("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) );// | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
 
-		if (!obj->IsNull(_("bitmapsize")))
-			tb->SetToolBitmapSize(obj->GetPropertyAsSize(_("bitmapsize")));
-		if (!obj->IsNull(_("margins")))
+		if (!obj->IsNullByKey(PROP_BITMAPSIZE))
+			tb->SetToolBitmapSize(obj->GetPropertyAsSizeByKey(PROP_BITMAPSIZE));
+		if (!obj->IsNullByKey(PROP_MARGINS))
 		{
-			wxSize margins(obj->GetPropertyAsSize(_("margins")));
+			wxSize margins(obj->GetPropertyAsSizeByKey(PROP_MARGINS));
 			tb->SetMargins(margins.GetWidth(), margins.GetHeight());
 		}
-		if (!obj->IsNull(_("packing")))
-			tb->SetToolPacking(obj->GetPropertyAsInteger(_("packing")));
-		if (!obj->IsNull(_("separation")))
-			tb->SetToolSeparation(obj->GetPropertyAsInteger(_("separation")));
+		if (!obj->IsNullByKey(PROP_PACKING))
+			tb->SetToolPacking(obj->GetPropertyAsIntegerByKey(PROP_PACKING));
+		if (!obj->IsNullByKey(PROP_SEPARATION))
+			tb->SetToolSeparation(obj->GetPropertyAsIntegerByKey(PROP_SEPARATION));
 
 		return tb;
 	}
@@ -1333,19 +1376,19 @@ public:
 			if ( wxT("tool") == childObj->GetClassName() )
 			{
 				tb->AddTool( 	wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
+								childObj->GetPropertyAsStringByKey( PROP_LABEL ),
+								childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
 								wxNullBitmap,
-								(wxItemKind)childObj->GetPropertyAsInteger( _("kind") ),
-								childObj->GetPropertyAsString( _("help") ),
+								(wxItemKind)childObj->GetPropertyAsIntegerByKey( PROP_KIND ),
+								childObj->GetPropertyAsStringByKey( PROP_HELP ),
 								wxEmptyString,
 								child
 							);
 				wxAuiToolBarItem* itm = tb->FindToolByIndex( i );
 				itm->SetUserData( (long) child );
-				if ( childObj->GetPropertyAsInteger(_("context_menu") ) == 1 && !itm->HasDropDown() )
+				if ( childObj->GetPropertyAsIntegerByKey(PROP_CONTEXT_MENU ) == 1 && !itm->HasDropDown() )
 					tb->SetToolDropDown( itm->GetId(), true );
-				else if ( childObj->GetPropertyAsInteger(_("context_menu") ) == 0 && itm->HasDropDown() )
+				else if ( childObj->GetPropertyAsIntegerByKey(PROP_CONTEXT_MENU ) == 0 && itm->HasDropDown() )
 					tb->SetToolDropDown( itm->GetId(), false );
 			}
 			else if ( wxT("toolSeparator") == childObj->GetClassName() )
@@ -1364,15 +1407,15 @@ public:
 		tb->Realize();
 	}
 /*
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("wxAuiToolBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("wxAuiToolBar"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("packing"), _("packing"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("separation"), _("separation"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
 	ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj )
@@ -1410,15 +1453,15 @@ class ToolComponent : public ComponentBase
 {
 public:
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("tool"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("tool"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("tooltip"), _("tooltip"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("statusbar"), _("longhelp"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
 
-		wxItemKind kind = (wxItemKind)obj->GetPropertyAsInteger(_("kind"));
+		wxItemKind kind = (wxItemKind)obj->GetPropertyAsIntegerByKey(PROP_KIND);
 		if ( wxITEM_CHECK == kind )
 		{
 			xrc.AddPropertyValue( wxT("toggle"), wxT("1") );
@@ -1427,11 +1470,11 @@ public:
 		{
 			xrc.AddPropertyValue( wxT("radio"), wxT("1") );
 		}
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("tool"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("tool"));
 		filter.AddProperty(_("longhelp"), _("statusbar"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("tooltip"), _("tooltip"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
@@ -1464,21 +1507,21 @@ public:
 			filter.AddPropertyValue( _("kind"), wxT("wxITEM_NORMAL") );
 		}
 
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
 class ToolSeparatorComponent : public ComponentBase
 {
 public:
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc( obj, _("separator") );
-		return xrc.GetXrcObject();
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc( writer, obj, _("separator") );
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter( xrcObj, _("toolSeparator") );
-		return filter.GetXfbObject();
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter( writer, xrcObj, _("toolSeparator") );
+		return true;
 	}
 };
 
@@ -1486,19 +1529,19 @@ class ChoiceComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByKey(PROP_CHOICES);
 		wxString *strings = new wxString[choices.GetCount()];
 		for (unsigned int i=0; i < choices.GetCount(); i++)
 			strings[i] = choices[i];
 
 		wxChoice *choice = new wxChoice((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
 			(int)choices.Count(),
 			strings,
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsIntegerByKey(PROP_SELECTION);
 		if( sel < (int) choices.GetCount() ) choice->SetSelection(sel);
 
 		delete []strings;
@@ -1517,20 +1560,20 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxChoice"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxChoice"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxChoice"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxChoice"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("content"),_("choices"), XRC_TYPE_STRINGLIST);
-		return filter.GetXfbObject();
+		return true;
 	}
 
 };
@@ -1564,30 +1607,30 @@ class SliderComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxSlider((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsInteger(_("value")),
-			obj->GetPropertyAsInteger(_("minValue")),
-			obj->GetPropertyAsInteger(_("maxValue")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByKey(PROP_VALUE),
+			obj->GetPropertyAsIntegerByKey(PROP_MINVALUE),
+			obj->GetPropertyAsIntegerByKey(PROP_MAXVALUE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSlider"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxSlider"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
 		xrc.AddProperty( _("minValue"), _("min"), XRC_TYPE_INTEGER);
 		xrc.AddProperty( _("maxValue"), _("max"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSlider"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxSlider"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("min"), _("minValue"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("max"), _("maxValue"), XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 
 };
@@ -1597,28 +1640,28 @@ class GaugeComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxGauge *gauge = new wxGauge((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsInteger(_("range")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
-		gauge->SetValue(obj->GetPropertyAsInteger(_("value")));
+			obj->GetPropertyAsIntegerByKey(PROP_RANGE),
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
+		gauge->SetValue(obj->GetPropertyAsIntegerByKey(PROP_VALUE));
 		return gauge;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGauge"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxGauge"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGauge"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxGauge"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 
 };
@@ -1629,23 +1672,23 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxAnimationCtrl* ac = new wxAnimationCtrl((wxWindow *)parent, wxID_ANY,
 			wxNullAnimation,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		if ( !obj->IsNull( _("animation") ) )
+		if ( !obj->IsNullByKey( PROP_ANIMATION ) )
 		{
-			if( ac->LoadFile( obj->GetPropertyAsString( _("animation") ) ) )
+			if( ac->LoadFile( obj->GetPropertyAsStringByKey( PROP_ANIMATION ) ) )
 			{
-				if ( !obj->IsNull( _("play") ) && ( obj->GetPropertyAsInteger( _("play") ) == 1 ) ) ac->Play();
+				if ( !obj->IsNullByKey( PROP_PLAY ) && ( obj->GetPropertyAsIntegerByKey( PROP_PLAY ) == 1 ) ) ac->Play();
 				else
 					ac->Stop();
 			}
 		}
 
-		if ( !obj->IsNull( _("inactive_bitmap") ) )
+		if ( !obj->IsNullByKey( PROP_INACTIVE_BITMAP ) )
 		{
-			wxBitmap bmp = obj->GetPropertyAsBitmap( _("inactive_bitmap") );
+			wxBitmap bmp = obj->GetPropertyAsBitmapByKey( PROP_INACTIVE_BITMAP );
 			if( bmp.IsOk() ) ac->SetInactiveBitmap( bmp );
 			else
 				ac->SetInactiveBitmap( wxNullBitmap );
@@ -1665,18 +1708,18 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxAnimationCtrl"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxAnimationCtrl"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("animation"),_("animation"),XRC_TYPE_TEXT);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxAnimationCtrl"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxAnimationCtrl"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("animation"),_("animation"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -1687,9 +1730,9 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxInfoBar* ib = new wxInfoBar((wxWindow *)parent);
 
-		ib->SetShowHideEffects( (wxShowEffect)obj->GetPropertyAsInteger(_("show_effect")),
-								(wxShowEffect)obj->GetPropertyAsInteger(_("hide_effect")) );
-		ib->SetEffectDuration( obj->GetPropertyAsInteger(_("duration")) );
+		ib->SetShowHideEffects( (wxShowEffect)obj->GetPropertyAsIntegerByKey(PROP_SHOW_EFFECT),
+								(wxShowEffect)obj->GetPropertyAsIntegerByKey(PROP_HIDE_EFFECT) );
+		ib->SetEffectDuration( obj->GetPropertyAsIntegerByKey(PROP_DURATION) );
 		ib->ShowMessage( wxT("Message ..."), wxICON_INFORMATION );
 
 		ib->PushEventHandler( new ComponentEvtHandler( ib, GetManager() ) );
@@ -1706,14 +1749,14 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject *obj) override
+	bool WriteXrc(IObject *obj, IXrcWriter* writer) override
 	{
-		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(writer, obj, _("unknown"), obj->GetPropertyAsStringByKey(PROP_NAME));
 
-		/*ObjectToXrcFilter xrc(obj, _("wxInfoBar"), obj->GetPropertyAsString(_("name")));
+		/*ObjectToXrcFilter xrc(writer, obj, _("wxInfoBar"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();*/
 
-		return xrc.GetXrcObject();
+		return true;
 	}
 
 	/*ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj )
@@ -35,6 +35,26 @@
 #include <wx/listctrl.h>
 #endif
 
+// Properties read by the components, resolved once per class
+constexpr PropertyKey PROP_BITMAP( "bitmap" );
+constexpr PropertyKey PROP_BITMAPSIZE( "bitmapsize" );
+constexpr PropertyKey PROP_COLLAPSED( "collapsed" );
+constexpr PropertyKey PROP_LABEL( "label" );
+constexpr PropertyKey PROP_MIN_PANE_SIZE( "min_pane_size" );
+constexpr PropertyKey PROP_NAME( "name" );
+constexpr PropertyKey PROP_POS( "pos" );
+constexpr PropertyKey PROP_SASHGRAVITY( "sashgravity" );
+constexpr PropertyKey PROP_SASHPOS( "sashpos" );
+constexpr PropertyKey PROP_SCROLL_RATE_X( "scroll_rate_x" );
+constexpr PropertyKey PROP_SCROLL_RATE_Y( "scroll_rate_y" );
+constexpr PropertyKey PROP_SELECT( "select" );
+constexpr PropertyKey PROP_SIZE( "size" );
+constexpr PropertyKey PROP_SPLITMODE( "splitmode" );
+constexpr PropertyKey PROP_STYLE( "style" );
+constexpr PropertyKey PROP_TAB_CTRL_HEIGHT( "tab_ctrl_height" );
+constexpr PropertyKey PROP_UNIFORM_BITMAP_SIZE( "uniform_bitmap_size" );
+constexpr PropertyKey PROP_WINDOW_STYLE( "window_style" );
+
 /// Event handler for events generated by controls in this plugin
 class ComponentEvtHandler : public wxEvtHandler
 {
@@ -82,11 +102,11 @@ protected:
 			IObject*  iChild = m_manager->GetIObject( wxChild );
 			if ( iChild )
 			{
-				if ( (int)i == selPage && !iChild->GetPropertyAsInteger( _("select") ) )
+				if ( (int)i == selPage && !iChild->GetPropertyAsIntegerByKey( PROP_SELECT ) )
 				{
 					m_manager->ModifyProperty( wxChild, _("select"), wxT("1"), false );
 				}
-				else if ( (int)i != selPage && iChild->GetPropertyAsInteger( _("select") ) )
+				else if ( (int)i != selPage && iChild->GetPropertyAsIntegerByKey( PROP_SELECT ) )
 				{
 					m_manager->ModifyProperty( wxChild, _("select"), wxT("0"), false );
 				}
@@ -208,22 +228,22 @@ class PanelComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxPanel* panel = new wxPanel((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 		return panel;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxPanel"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxPanel"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxPanel"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxPanel"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 
 };
@@ -234,12 +254,12 @@ class CollapsiblePaneComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxCollapsiblePane* collpane = new wxCollapsiblePane( (wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString( _("label") ),
-			obj->GetPropertyAsPoint( _("pos") ),
-			obj->GetPropertyAsSize( _("size") ),
-			obj->GetPropertyAsInteger( _("style") ) | obj->GetPropertyAsInteger( _("window_style") ) );
+			obj->GetPropertyAsStringByKey( PROP_LABEL ),
+			obj->GetPropertyAsPointByKey( PROP_POS ),
+			obj->GetPropertyAsSizeByKey( PROP_SIZE ),
+			obj->GetPropertyAsIntegerByKey( PROP_STYLE ) | obj->GetPropertyAsIntegerByKey( PROP_WINDOW_STYLE ) );
 
-		collpane->Collapse(obj->GetPropertyAsInteger(_("collapsed")) != 0);
+		collpane->Collapse(obj->GetPropertyAsIntegerByKey(PROP_COLLAPSED) != 0);
 
 		collpane->PushEventHandler( new ComponentEvtHandler( collpane, GetManager() ) );
 
@@ -255,20 +275,20 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc( obj, _("wxCollapsiblePane"), obj->GetPropertyAsString( _("name") ) );
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc( writer, obj, _("wxCollapsiblePane"), obj->GetPropertyAsStringByKey( PROP_NAME ) );
 		xrc.AddWindowProperties();
 		xrc.AddProperty( _("label"), _("label"), XRC_TYPE_TEXT );
 		xrc.AddProperty( _("collapsed"), _("collapsed"), XRC_TYPE_BOOL );
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter( xrcObj, _("wxCollapsiblePane") );
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter( writer, xrcObj, _("wxCollapsiblePane") );
 		filter.AddWindowProperties();
 		filter.AddProperty( _("label"), _("label"), XRC_TYPE_TEXT );
 		filter.AddProperty( _("collapsed"), _("collapsed"), XRC_TYPE_BOOL );
-		return filter.GetXfbObject();
+		return true;
 	}
 
 };
@@ -292,20 +312,20 @@ class SplitterWindowComponent : public ComponentBase
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxCustomSplitterWindow *splitter =
 			new wxCustomSplitterWindow((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			(obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))) & ~wxSP_PERMIT_UNSPLIT );
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			(obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE)) & ~wxSP_PERMIT_UNSPLIT );
 
-		if ( !obj->IsNull( _("sashgravity") ) )
+		if ( !obj->IsNullByKey( PROP_SASHGRAVITY ) )
 		{
-			float gravity = obj->GetPropertyAsFloat( _("sashgravity") );
+			float gravity = obj->GetPropertyAsFloatByKey( PROP_SASHGRAVITY );
 			gravity = ( gravity < 0.0 ? 0.0 : gravity );
 			gravity = ( gravity > 1.0 ? 1.0 : gravity );
 			splitter->SetSashGravity( gravity );
 		}
-		if ( !obj->IsNull( _("min_pane_size") ) )
+		if ( !obj->IsNullByKey( PROP_MIN_PANE_SIZE ) )
 		{
-			int minPaneSize = obj->GetPropertyAsInteger( _("min_pane_size") );
+			int minPaneSize = obj->GetPropertyAsIntegerByKey( PROP_MIN_PANE_SIZE );
 			splitter->m_customMinPaneSize = minPaneSize;
 			minPaneSize = ( minPaneSize < 1 ? 1 : minPaneSize );
 			splitter->SetMinimumPaneSize( minPaneSize );
@@ -315,7 +335,7 @@ class SplitterWindowComponent : public ComponentBase
 		splitter->Initialize( new wxPanel( splitter ) );
 
 		// Used to ensure sash position is correct
-		splitter->m_initialSashPos = obj->GetPropertyAsInteger( _("sashpos") );
+		splitter->m_initialSashPos = obj->GetPropertyAsIntegerByKey( PROP_SASHPOS );
 		splitter->Connect( wxEVT_IDLE, wxIdleEventHandler( wxCustomSplitterWindow::OnIdle ) );
 
 		return splitter;
@@ -336,22 +356,22 @@ class SplitterWindowComponent : public ComponentBase
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxSplitterWindow"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxSplitterWindow"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("sashpos"),_("sashpos"),XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("sashgravity"),_("gravity"),XRC_TYPE_FLOAT);
 		xrc.AddProperty(_("min_pane_size"),_("minsize"),XRC_TYPE_INTEGER);
-		if (obj->GetPropertyAsString(_("splitmode")) == wxT("wxSPLIT_VERTICAL"))
+		if (obj->GetPropertyAsStringByKey(PROP_SPLITMODE) == wxT("wxSPLIT_VERTICAL"))
 			xrc.AddPropertyValue(_("orientation"),wxT("vertical"));
 		else
 			xrc.AddPropertyValue(_("orientation"),wxT("horizontal"));
 
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxSplitterWindow"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxSplitterWindow"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("sashpos"),_("sashpos"),XRC_TYPE_INTEGER);
 		filter.AddProperty(_("gravity"),_("sashgravity"),XRC_TYPE_FLOAT);
@@ -369,7 +389,7 @@ class SplitterWindowComponent : public ComponentBase
 		{
 		}
 
-		return filter.GetXfbObject();
+		return true;
 	}
 
 	void OnCreated(wxObject* wxobject, wxWindow* /*wxparent*/) override {
@@ -434,8 +454,8 @@ class SplitterWindowComponent : public ComponentBase
 					return;
 				}
 
-				int sashPos = obj->GetPropertyAsInteger(_("sashpos"));
-				int splitmode = obj->GetPropertyAsInteger(_("splitmode"));
+				int sashPos = obj->GetPropertyAsIntegerByKey(PROP_SASHPOS);
+				int splitmode = obj->GetPropertyAsIntegerByKey(PROP_SPLITMODE);
 
 				if ( firstChild )
 				{
@@ -475,10 +495,10 @@ void ComponentEvtHandler::OnSplitterSashChanged( wxSplitterEvent& )
 
 class SplitterItemComponent : public ComponentBase
 {
-	ticpp::Element* ExportToXrc(IObject* obj) override {
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
 		// A __dummyitem__ will be ignored...
-		ObjectToXrcFilter xrc(obj, _("__dummyitem__"),wxT(""));
-		return xrc.GetXrcObject();
+		ObjectToXrcFilter xrc(writer, obj, _("__dummyitem__"),wxT(""));
+		return true;
 	}
 };
 
@@ -487,27 +507,27 @@ class ScrolledWindowComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
         wxScrolledWindow *sw = new wxScrolledWindow((wxWindow *)parent, wxID_ANY,
-            obj->GetPropertyAsPoint(_("pos")),
-            obj->GetPropertyAsSize(_("size")),
-            obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+            obj->GetPropertyAsPointByKey(PROP_POS),
+            obj->GetPropertyAsSizeByKey(PROP_SIZE),
+            obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
         sw->SetScrollRate(
-            obj->GetPropertyAsInteger(_("scroll_rate_x")),
-            obj->GetPropertyAsInteger(_("scroll_rate_y")));
+            obj->GetPropertyAsIntegerByKey(PROP_SCROLL_RATE_X),
+            obj->GetPropertyAsIntegerByKey(PROP_SCROLL_RATE_Y));
         return sw;
     }
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-        ObjectToXrcFilter xrc(obj, _("wxScrolledWindow"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+        ObjectToXrcFilter xrc(writer, obj, _("wxScrolledWindow"), obj->GetPropertyAsStringByKey(PROP_NAME));
         xrc.AddWindowProperties();
 		xrc.AddPropertyValue( _("scrollrate"), wxString::Format( wxT("%d,%d"),
-				obj->GetPropertyAsInteger(_("scroll_rate_x")),
-				obj->GetPropertyAsInteger(_("scroll_rate_y")) ) );
-        return xrc.GetXrcObject();
+				obj->GetPropertyAsIntegerByKey(PROP_SCROLL_RATE_X),
+				obj->GetPropertyAsIntegerByKey(PROP_SCROLL_RATE_Y) ) );
+        return true;
     }
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-        XrcToXfbFilter filter(xrcObj, _("wxScrolledWindow"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+        XrcToXfbFilter filter(writer, xrcObj, _("wxScrolledWindow"));
         filter.AddWindowProperties();
 
 		ticpp::Element *scrollrate = xrcObj->FirstChildElement("scrollrate");
@@ -516,7 +536,7 @@ public:
 			filter.AddPropertyValue( _("scroll_rate_x"), value.BeforeFirst( wxT(',') ) );
 			filter.AddPropertyValue( _("scroll_rate_y"), value.AfterFirst( wxT(',') ) );
 		}
-        return filter.GetXfbObject();
+        return true;
     }
 };
 
@@ -525,9 +545,9 @@ class NotebookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxNotebook* book = new wxCustomNotebook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		BookUtils::AddImageList( obj, book );
 
@@ -545,16 +565,16 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxNotebook"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxNotebook"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxNotebook"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxNotebook"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -575,24 +595,24 @@ public:
 		BookUtils::OnSelected< wxNotebook >( wxobject, GetManager() );
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("notebookpage"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("notebookpage"));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("select"),_("selected"),XRC_TYPE_BOOL);
-		if ( !obj->IsNull( _("bitmap") ) )
+		if ( !obj->IsNullByKey( PROP_BITMAP ) )
 		{
 			xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
 		}
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("notebookpage"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("notebookpage"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("selected"),_("select"),XRC_TYPE_BOOL);
 		filter.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -601,9 +621,9 @@ class ListbookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxListbook* book = new wxListbook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		BookUtils::AddImageList( obj, book );
 
@@ -629,7 +649,7 @@ public:
 		{
 			// Small icon style if bitmapsize is not set
 			IObject* obj = GetManager()->GetIObject( wxobject );
-			if ( obj->GetPropertyAsString( _("bitmapsize") ).empty() )
+			if ( obj->GetPropertyAsStringByKey( PROP_BITMAPSIZE ).empty() )
 			{
 				wxListView* tmpListView = book->GetListView();
 				long flags = tmpListView->GetWindowStyleFlag();
@@ -640,16 +660,16 @@ public:
 	}
 #endif
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxListbook"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxListbook"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxListbook"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxListbook"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -670,19 +690,19 @@ public:
 		BookUtils::OnSelected<wxListbook>(wxobject, GetManager());
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("listbookpage"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("listbookpage"));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("select"),_("selected"),XRC_TYPE_BOOL);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("listbookpage"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("listbookpage"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("selected"),_("select"),XRC_TYPE_BOOL);
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -691,9 +711,9 @@ class ChoicebookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxChoicebook* book = new wxChoicebook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
 		book->PushEventHandler( new ComponentEvtHandler( book, GetManager() ) );
 
@@ -709,16 +729,16 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxChoicebook"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxChoicebook"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxChoicebook"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxChoicebook"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -739,19 +759,19 @@ public:
 		BookUtils::OnSelected< wxChoicebook >( wxobject, GetManager() );
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("choicebookpage"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("choicebookpage"));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("select"),_("selected"),XRC_TYPE_BOOL);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("choicebookpage"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("choicebookpage"));
 		filter.AddWindowProperties();
 		filter.AddProperty(_("selected"),_("select"),XRC_TYPE_BOOL);
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -760,12 +780,12 @@ class AuiNotebookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxAuiNotebook* book = new wxAuiNotebook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 
-		book->SetTabCtrlHeight( obj->GetPropertyAsInteger( _("tab_ctrl_height") ) );
-		book->SetUniformBitmapSize( obj->GetPropertyAsSize( _("uniform_bitmap_size") ) );
+		book->SetTabCtrlHeight( obj->GetPropertyAsIntegerByKey( PROP_TAB_CTRL_HEIGHT ) );
+		book->SetUniformBitmapSize( obj->GetPropertyAsSizeByKey( PROP_UNIFORM_BITMAP_SIZE ) );
 
 		book->PushEventHandler( new ComponentEvtHandler( book, GetManager() ) );
 
@@ -782,16 +802,16 @@ public:
 	}
 
 #if wxVERSION_NUMBER >= 2905
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxAuiNotebook"), obj->GetPropertyAsString(_("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxAuiNotebook"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxAuiNotebook"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxAuiNotebook"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 #endif
 };
@@ -834,10 +854,10 @@ public:
 
 		// Save selection
 		int selection = book->GetSelection();
-		const wxBitmap& bitmap = obj->IsNull( _("bitmap") ) ? wxNullBitmap : obj->GetPropertyAsBitmap( _("bitmap") );
-		book->AddPage( page, obj->GetPropertyAsString( _("label") ), false, bitmap );
+		const wxBitmap& bitmap = obj->IsNullByKey( PROP_BITMAP ) ? wxNullBitmap : obj->GetPropertyAsBitmapByKey( PROP_BITMAP );
+		book->AddPage( page, obj->GetPropertyAsStringByKey( PROP_LABEL ), false, bitmap );
 
-		if ( obj->GetPropertyAsString( _("select") ) == wxT("0") && selection >= 0 )
+		if ( obj->GetPropertyAsStringByKey( PROP_SELECT ) == wxT("0") && selection >= 0 )
 		{
 			book->SetSelection(selection);
 		}
@@ -852,12 +872,12 @@ public:
 	}
 
 #if wxVERSION_NUMBER >= 2905
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("notebookpage"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("notebookpage"));
 		xrc.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("selected"),_("selected"), XRC_TYPE_BOOL);
 		xrc.AddProperty(_("bitmap"),_("bitmap"), XRC_TYPE_BITMAP);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
 	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
@@ -876,9 +896,9 @@ class SimplebookComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		return new wxSimplebook((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 	}
 };
 
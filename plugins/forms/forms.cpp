@@ -31,6 +31,22 @@
 #include <forms/wizard.h>
 #include <wx/aui/aui.h>
 
+// Properties read by the components, resolved once per class
+constexpr PropertyKey PROP_BITMAP( "bitmap" );
+constexpr PropertyKey PROP_BITMAPSIZE( "bitmapsize" );
+constexpr PropertyKey PROP_CENTER( "center" );
+constexpr PropertyKey PROP_HELP( "help" );
+constexpr PropertyKey PROP_KIND( "kind" );
+constexpr PropertyKey PROP_LABEL( "label" );
+constexpr PropertyKey PROP_MARGINS( "margins" );
+constexpr PropertyKey PROP_NAME( "name" );
+constexpr PropertyKey PROP_PACKING( "packing" );
+constexpr PropertyKey PROP_POS( "pos" );
+constexpr PropertyKey PROP_SEPARATION( "separation" );
+constexpr PropertyKey PROP_SIZE( "size" );
+constexpr PropertyKey PROP_STYLE( "style" );
+constexpr PropertyKey PROP_WINDOW_STYLE( "window_style" );
+
 // Event handler for events generated by controls in this plugin
 class ComponentEvtHandler : public wxEvtHandler
 {
@@ -62,25 +78,25 @@ public:
 		return panel;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, wxT("wxFrame"), obj->GetPropertyAsString(wxT("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, wxT("wxFrame"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty( wxT("title"), wxT("title"), XRC_TYPE_TEXT);
-		if ( !obj->IsNull( wxT("center") ) )
+		if ( !obj->IsNullByKey( PROP_CENTER ) )
 		{
 			xrc.AddPropertyValue( wxT("centered"), wxT("1") );
 		}
 		xrc.AddProperty( wxT("aui_managed"), wxT("aui_managed"), XRC_TYPE_BOOL);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, wxT("Frame"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, wxT("Frame"));
 		filter.AddWindowProperties();
 		filter.AddProperty( wxT("title"), wxT("title"), XRC_TYPE_TEXT);
 		filter.AddProperty(wxT("centered"), wxT("center"), XRC_TYPE_BITLIST);
 		filter.AddProperty( wxT("aui_managed"), wxT("aui_managed"), XRC_TYPE_BOOL);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -92,16 +108,16 @@ public:
 		return panel;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, wxT("wxPanel"), obj->GetPropertyAsString(wxT("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, wxT("wxPanel"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, wxT("Panel"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, wxT("Panel"));
 		filter.AddWindowProperties();
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -113,23 +129,23 @@ public:
 		return panel;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, wxT("wxDialog"), obj->GetPropertyAsString(wxT("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, wxT("wxDialog"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty( wxT("title"), wxT("title"), XRC_TYPE_TEXT);
-		if ( !obj->IsNull( wxT("center") ) )
+		if ( !obj->IsNullByKey( PROP_CENTER ) )
 		{
 			xrc.AddPropertyValue( wxT("centered"), wxT("1") );
 		}
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, wxT("Dialog"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, wxT("Dialog"));
 		filter.AddWindowProperties();
 		filter.AddProperty( wxT("title"), wxT("title"), XRC_TYPE_TEXT);
 		filter.AddProperty(wxT("centered"), wxT("center"), XRC_TYPE_BITLIST);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -137,21 +153,21 @@ class MenuBarFormComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
-		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsInteger(wxT("style")) |
-			obj->GetPropertyAsInteger(wxT("window_style")));
+		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsIntegerByKey(PROP_STYLE) |
+			obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE));
 		return mb;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, wxT("wxMenuBar"), obj->GetPropertyAsString(wxT("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, wxT("wxMenuBar"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, wxT("MenuBar"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, wxT("MenuBar"));
 		filter.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -160,21 +176,21 @@ class ToolBarFormComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxToolBar *tb = new wxToolBar((wxWindow*)parent, wxID_ANY,
-			obj->GetPropertyAsPoint(wxT("pos")),
-			obj->GetPropertyAsSize(wxT("size")),
-			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
+			obj->GetPropertyAsPointByKey(PROP_POS),
+			obj->GetPropertyAsSizeByKey(PROP_SIZE),
+			obj->GetPropertyAsIntegerByKey(PROP_STYLE) | obj->GetPropertyAsIntegerByKey(PROP_WINDOW_STYLE) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
 
-		if (!obj->IsNull(wxT("bitmapsize")))
-			tb->SetToolBitmapSize(obj->GetPropertyAsSize(wxT("bitmapsize")));
-		if (!obj->IsNull(wxT("margins")))
+		if (!obj->IsNullByKey(PROP_BITMAPSIZE))
+			tb->SetToolBitmapSize(obj->GetPropertyAsSizeByKey(PROP_BITMAPSIZE));
+		if (!obj->IsNullByKey(PROP_MARGINS))
 		{
-			wxSize margins(obj->GetPropertyAsSize(wxT("margins")));
+			wxSize margins(obj->GetPropertyAsSizeByKey(PROP_MARGINS));
 			tb->SetMargins(margins.GetWidth(), margins.GetHeight());
 		}
-		if (!obj->IsNull(wxT("packing")))
-			tb->SetToolPacking(obj->GetPropertyAsInteger(wxT("packing")));
-		if (!obj->IsNull(wxT("separation")))
-			tb->SetToolSeparation(obj->GetPropertyAsInteger(wxT("separation")));
+		if (!obj->IsNullByKey(PROP_PACKING))
+			tb->SetToolPacking(obj->GetPropertyAsIntegerByKey(PROP_PACKING));
+		if (!obj->IsNullByKey(PROP_SEPARATION))
+			tb->SetToolSeparation(obj->GetPropertyAsIntegerByKey(PROP_SEPARATION));
 
 		tb->PushEventHandler(new ComponentEvtHandler(GetManager()));
 
@@ -206,11 +222,11 @@ public:
 			if ( wxT("tool") == childObj->GetClassName() )
 			{
 				tb->AddTool( 	wxID_ANY,
-								childObj->GetPropertyAsString( wxT("label") ),
-								childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+								childObj->GetPropertyAsStringByKey( PROP_LABEL ),
+								childObj->GetPropertyAsBitmapByKey( PROP_BITMAP ),
 								wxNullBitmap,
-								(wxItemKind)childObj->GetPropertyAsInteger( wxT("kind") ),
-								childObj->GetPropertyAsString( wxT("help") ),
+								(wxItemKind)childObj->GetPropertyAsIntegerByKey( PROP_KIND ),
+								childObj->GetPropertyAsStringByKey( PROP_HELP ),
 								wxEmptyString,
 								child
 							);
@@ -232,24 +248,24 @@ public:
 
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, wxT("wxToolBar"), obj->GetPropertyAsString(wxT("name")));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, wxT("wxToolBar"), obj->GetPropertyAsStringByKey(PROP_NAME));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(wxT("bitmapsize"), wxT("bitmapsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
 		xrc.AddProperty(wxT("packing"), wxT("packing"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(wxT("separation"), wxT("separation"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, wxT("ToolBar"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, wxT("ToolBar"));
 		filter.AddWindowProperties();
 		filter.AddProperty(wxT("bitmapsize"), wxT("bitmapsize"), XRC_TYPE_SIZE);
 		filter.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
 		filter.AddProperty(wxT("packing"), wxT("packing"), XRC_TYPE_INTEGER);
 		filter.AddProperty(wxT("separation"), wxT("separation"), XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -283,26 +299,26 @@ public:
         wxLogDebug( wxT("Wizard OnSelected") );
     }
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc( obj, wxT("wxWizard"), obj->GetPropertyAsString( wxT("name") ) );
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc( writer, obj, wxT("wxWizard"), obj->GetPropertyAsStringByKey( PROP_NAME ) );
 		xrc.AddWindowProperties();
 		xrc.AddProperty( wxT("title"), wxT("title"), XRC_TYPE_TEXT );
-		if ( !obj->IsNull( wxT("center") ) )
+		if ( !obj->IsNullByKey( PROP_CENTER ) )
 			xrc.AddPropertyValue( wxT("centered"), wxT("1") );
 
-		if ( !obj->IsNull( wxT("bitmap") ) )
+		if ( !obj->IsNullByKey( PROP_BITMAP ) )
 			xrc.AddProperty( wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP );
 
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter( xrcObj, wxT("Wizard") );
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter( writer, xrcObj, wxT("Wizard") );
 		filter.AddWindowProperties();
 		filter.AddProperty( wxT("title"),    wxT("title"),  XRC_TYPE_TEXT );
 		filter.AddProperty( wxT("centered"), wxT("center"), XRC_TYPE_BITLIST );
 		filter.AddProperty( wxT("bitmap"),   wxT("bitmap"), XRC_TYPE_BITMAP );
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -346,19 +362,19 @@ public:
 		}
 	}
 */
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-        ObjectToXrcFilter xrc( obj, wxT("wxWizardPageSimple"), obj->GetPropertyAsString( wxT("name") ) );
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+        ObjectToXrcFilter xrc( writer, obj, wxT("wxWizardPageSimple"), obj->GetPropertyAsStringByKey( PROP_NAME ) );
         xrc.AddWindowProperties();
-		if ( !obj->IsNull( wxT("bitmap") ) )
+		if ( !obj->IsNullByKey( PROP_BITMAP ) )
 			xrc.AddProperty( wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP );
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-        XrcToXfbFilter filter( xrcObj, wxT("WizardPageSimple") );
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+        XrcToXfbFilter filter( writer, xrcObj, wxT("WizardPageSimple") );
         filter.AddWindowProperties();
 		filter.AddProperty( wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP );
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -29,6 +29,38 @@
 #include <wx/wrapsizer.h>
 #include <xrcconv.h>
 
+// Properties read by the components, resolved once per class
+constexpr PropertyKey PROP_APPLY( "Apply" );
+constexpr PropertyKey PROP_BORDER( "border" );
+constexpr PropertyKey PROP_CANCEL( "Cancel" );
+constexpr PropertyKey PROP_COLS( "cols" );
+constexpr PropertyKey PROP_COLSPAN( "colspan" );
+constexpr PropertyKey PROP_COLUMN( "column" );
+constexpr PropertyKey PROP_CONTEXTHELP( "ContextHelp" );
+constexpr PropertyKey PROP_EMPTY_CELL_SIZE( "empty_cell_size" );
+constexpr PropertyKey PROP_FLAG( "flag" );
+constexpr PropertyKey PROP_FLAGS( "flags" );
+constexpr PropertyKey PROP_FLEXIBLE_DIRECTION( "flexible_direction" );
+constexpr PropertyKey PROP_GROWABLECOLS( "growablecols" );
+constexpr PropertyKey PROP_GROWABLEROWS( "growablerows" );
+constexpr PropertyKey PROP_HEIGHT( "height" );
+constexpr PropertyKey PROP_HELP( "Help" );
+constexpr PropertyKey PROP_HGAP( "hgap" );
+constexpr PropertyKey PROP_LABEL( "label" );
+constexpr PropertyKey PROP_MINIMUM_SIZE( "minimum_size" );
+constexpr PropertyKey PROP_NO( "No" );
+constexpr PropertyKey PROP_NON_FLEXIBLE_GROW_MODE( "non_flexible_grow_mode" );
+constexpr PropertyKey PROP_OK( "OK" );
+constexpr PropertyKey PROP_ORIENT( "orient" );
+constexpr PropertyKey PROP_PROPORTION( "proportion" );
+constexpr PropertyKey PROP_ROW( "row" );
+constexpr PropertyKey PROP_ROWS( "rows" );
+constexpr PropertyKey PROP_ROWSPAN( "rowspan" );
+constexpr PropertyKey PROP_SAVE( "Save" );
+constexpr PropertyKey PROP_VGAP( "vgap" );
+constexpr PropertyKey PROP_WIDTH( "width" );
+constexpr PropertyKey PROP_YES( "Yes" );
+
 #ifdef __WX24__
 	#define wxFIXED_MINSIZE wxADJUST_MINSIZE
 #endif
@@ -38,44 +70,42 @@ class SpacerComponent : public ComponentBase
 public:
 	// ImportFromXRC is handled in sizeritem components
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("spacer"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("spacer"));
 		xrc.AddPropertyPair( _("width"), _("height"), _("size") );
-		return xrc.GetXrcObject();
+		return true;
 	}
 };
 
 class GBSizerItemComponent : public ComponentBase
 {
 public:
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("sizeritem"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("sizeritem"));
 		xrc.AddPropertyPair( _("row"), _("column"), _("cellpos") );
 		xrc.AddPropertyPair( _("rowspan"), _("colspan"), _("cellspan") );
 		xrc.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
 		xrc.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
 		// XrcLoader::GetObject imports spacers as sizeritems
-		XrcToXfbFilter filter(xrcObj, _("gbsizeritem"));
+		XrcToXfbFilter filter(writer, xrcObj, _("gbsizeritem"));
 		filter.AddPropertyPair( "cellpos", _("row"), _("column") );
 		filter.AddPropertyPair( "cellspan", _("rowspan"), _("colspan") );
 		filter.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
 		filter.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
-		ticpp::Element* sizeritem = filter.GetXfbObject();
 
 		// XrcLoader::GetObject imports spacers as sizeritems, so check for a spacer
 		if ( xrcObj->FirstChildElement( "size", false ) && !xrcObj->FirstChildElement( "object", false ) )
 		{
 			// it is a spacer
-			XrcToXfbFilter spacer( xrcObj, _("spacer") );
+			XrcToXfbFilter spacer( writer->AddObject( _("spacer") ), xrcObj, _("spacer") );
 			spacer.AddPropertyPair( "size", _("width"), _("height") );
-			sizeritem->LinkEndChild( spacer.GetXfbObject() );
 		}
 
-		return sizeritem;
+		return true;
 	}
 };
 
@@ -108,11 +138,11 @@ public:
 		// Add the spacer
 		if ( _("spacer") == childObj->GetClassName() )
 		{
-			sizer->Add(	childObj->GetPropertyAsInteger( _("width") ),
-						childObj->GetPropertyAsInteger( _("height") ),
-						obj->GetPropertyAsInteger(_("proportion")),
-						obj->GetPropertyAsInteger(_("flag")),
-						obj->GetPropertyAsInteger(_("border"))
+			sizer->Add(	childObj->GetPropertyAsIntegerByKey( PROP_WIDTH ),
+						childObj->GetPropertyAsIntegerByKey( PROP_HEIGHT ),
+						obj->GetPropertyAsIntegerByKey(PROP_PROPORTION),
+						obj->GetPropertyAsIntegerByKey(PROP_FLAG),
+						obj->GetPropertyAsIntegerByKey(PROP_BORDER)
 						);
 			return;
 		}
@@ -124,16 +154,16 @@ public:
 		if ( windowChild != NULL )
 		{
 			sizer->Add( windowChild,
-				obj->GetPropertyAsInteger(_("proportion")),
-				obj->GetPropertyAsInteger(_("flag")),
-				obj->GetPropertyAsInteger(_("border")));
+				obj->GetPropertyAsIntegerByKey(PROP_PROPORTION),
+				obj->GetPropertyAsIntegerByKey(PROP_FLAG),
+				obj->GetPropertyAsIntegerByKey(PROP_BORDER));
 		}
 		else if ( sizerChild != NULL )
 		{
 			sizer->Add( sizerChild,
-				obj->GetPropertyAsInteger(_("proportion")),
-				obj->GetPropertyAsInteger(_("flag")),
-				obj->GetPropertyAsInteger(_("border")));
+				obj->GetPropertyAsIntegerByKey(PROP_PROPORTION),
+				obj->GetPropertyAsIntegerByKey(PROP_FLAG),
+				obj->GetPropertyAsIntegerByKey(PROP_BORDER));
 		}
 		else
 		{
@@ -141,30 +171,28 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("sizeritem"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("sizeritem"));
 		xrc.AddProperty(_("proportion"), _("option"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
 		xrc.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("sizeritem"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("sizeritem"));
 		filter.AddProperty(_("option"), _("proportion"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
 		filter.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
-		ticpp::Element* sizeritem = filter.GetXfbObject();
 
 		// XrcLoader::GetObject imports spacers as sizeritems, so check for a spacer
 		if ( xrcObj->FirstChildElement("size", false ) && !xrcObj->FirstChildElement("object", false ) )
 		{
 			// it is a spacer
-			XrcToXfbFilter spacer( xrcObj, _("spacer") );
+			XrcToXfbFilter spacer( writer->AddObject( _("spacer") ), xrcObj, _("spacer") );
 			spacer.AddPropertyPair( "size", _("width"), _("height") );
-			sizeritem->LinkEndChild( spacer.GetXfbObject() );
 		}
-		return sizeritem;
+		return true;
 	}
 };
 
@@ -172,24 +200,24 @@ class BoxSizerComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
-		wxBoxSizer *sizer = new wxBoxSizer(obj->GetPropertyAsInteger(_("orient")));
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		wxBoxSizer *sizer = new wxBoxSizer(obj->GetPropertyAsIntegerByKey(PROP_ORIENT));
+		sizer->SetMinSize( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) );
 		return sizer;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxBoxSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxBoxSizer"));
+		if( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj ) override
+	bool ReadXrc( ticpp::Element* xrcObj, IXfbWriter* writer ) override
 	{
-		XrcToXfbFilter filter(xrcObj, _("wxBoxSizer"));
+		XrcToXfbFilter filter(writer, xrcObj, _("wxBoxSizer"));
 		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
 		filter.AddProperty(_("orient"),_("orient"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -197,29 +225,29 @@ class WrapSizerComponent : public ComponentBase
 {
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
-		const auto sizer = new wxWrapSizer(obj->GetPropertyAsInteger(_("orient")),
-		                                   obj->GetPropertyAsInteger(_("flags")));
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		const auto sizer = new wxWrapSizer(obj->GetPropertyAsIntegerByKey(PROP_ORIENT),
+		                                   obj->GetPropertyAsIntegerByKey(PROP_FLAGS));
+		sizer->SetMinSize( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) );
 		return sizer;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxWrapSizer"));
-		if (obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize)
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxWrapSizer"));
+		if (obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) != wxDefaultSize)
 		{
 			xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		}
 		xrc.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("flags"), _("flags"), XRC_TYPE_BITLIST);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxWrapSizer"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxWrapSizer"));
 		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
 		filter.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
 		filter.AddProperty(_("flags"), _("flags"), XRC_TYPE_BITLIST);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -234,30 +262,30 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		m_count++;
 		wxStaticBox* box = new wxStaticBox((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("label")));
+			obj->GetPropertyAsStringByKey(PROP_LABEL));
 
 		wxStaticBoxSizer* sizer = new wxStaticBoxSizer(box,
-			obj->GetPropertyAsInteger(_("orient")));
+			obj->GetPropertyAsIntegerByKey(PROP_ORIENT));
 
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) );
 
 		return sizer;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxStaticBoxSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxStaticBoxSizer"));
+		if( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxStaticBoxSizer"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxStaticBoxSizer"));
 		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
 		filter.AddProperty(_("orient"),_("orient"),XRC_TYPE_TEXT);
 		filter.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -266,34 +294,34 @@ class GridSizerComponent : public ComponentBase
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
 		wxGridSizer *sizer = new wxGridSizer(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")),
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsIntegerByKey(PROP_ROWS),
+			obj->GetPropertyAsIntegerByKey(PROP_COLS),
+			obj->GetPropertyAsIntegerByKey(PROP_VGAP),
+			obj->GetPropertyAsIntegerByKey(PROP_HGAP));
 
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) );
 
 		return sizer;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGridSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxGridSizer"));
+		if( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("hgap"), _("hgap"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGridSizer"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxGridSizer"));
 		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
 		filter.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("hgap"), _("hgap"), XRC_TYPE_INTEGER);
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -303,8 +331,8 @@ public:
 	void AddProperties( IObject* obj, wxFlexGridSizer* sizer )
 	{
 		wxArrayInt gcols, grows;
-		gcols = obj->GetPropertyAsArrayInt(_("growablecols"));
-		grows = obj->GetPropertyAsArrayInt(_("growablerows"));
+		gcols = obj->GetPropertyAsArrayIntByKey(PROP_GROWABLECOLS);
+		grows = obj->GetPropertyAsArrayIntByKey(PROP_GROWABLEROWS);
 
 		unsigned int i;
 		for (i=0; i < gcols.GetCount() ; i++)
@@ -313,18 +341,18 @@ public:
 		for (i=0; i < grows.GetCount() ; i++)
 			sizer->AddGrowableRow(grows[i]);
 
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
-		sizer->SetFlexibleDirection( obj->GetPropertyAsInteger(_("flexible_direction")) );
-		sizer->SetNonFlexibleGrowMode( (wxFlexSizerGrowMode )obj->GetPropertyAsInteger(_("non_flexible_grow_mode")) );
+		sizer->SetMinSize( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) );
+		sizer->SetFlexibleDirection( obj->GetPropertyAsIntegerByKey(PROP_FLEXIBLE_DIRECTION) );
+		sizer->SetNonFlexibleGrowMode( (wxFlexSizerGrowMode )obj->GetPropertyAsIntegerByKey(PROP_NON_FLEXIBLE_GROW_MODE) );
 	}
 
 	void ExportXRCProperties( ObjectToXrcFilter* xrc, IObject* obj )
 	{
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc->AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+		if( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) != wxDefaultSize ) xrc->AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		xrc->AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
 		xrc->AddProperty(_("hgap"), _("hgap"), XRC_TYPE_INTEGER);
-		xrc->AddPropertyValue(_("growablecols"), obj->GetPropertyAsString(_("growablecols")));
-		xrc->AddPropertyValue(_("growablerows"), obj->GetPropertyAsString(_("growablerows")));
+		xrc->AddPropertyValue(_("growablecols"), obj->GetPropertyAsStringByKey(PROP_GROWABLECOLS));
+		xrc->AddPropertyValue(_("growablerows"), obj->GetPropertyAsStringByKey(PROP_GROWABLEROWS));
 	}
 
 	void ImportXRCProperties( XrcToXfbFilter* filter )
@@ -342,30 +370,30 @@ class FlexGridSizerComponent : public FlexGridSizerBase
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
 		wxFlexGridSizer *sizer = new wxFlexGridSizer(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")),
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsIntegerByKey(PROP_ROWS),
+			obj->GetPropertyAsIntegerByKey(PROP_COLS),
+			obj->GetPropertyAsIntegerByKey(PROP_VGAP),
+			obj->GetPropertyAsIntegerByKey(PROP_HGAP));
 
 		AddProperties( obj, sizer );
 
 		return sizer;
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxFlexGridSizer"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxFlexGridSizer"));
 		xrc.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
 		ExportXRCProperties( &xrc, obj );
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxFlexGridSizer"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxFlexGridSizer"));
 		filter.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
 		filter.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
 		ImportXRCProperties( &filter );
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -378,12 +406,12 @@ private:
 
 		if ( _("spacer") == childObj->GetClassName() )
 		{
-			return new wxGBSizerItem(	childObj->GetPropertyAsInteger( _("width") ),
-										childObj->GetPropertyAsInteger( _("height") ),
+			return new wxGBSizerItem(	childObj->GetPropertyAsIntegerByKey( PROP_WIDTH ),
+										childObj->GetPropertyAsIntegerByKey( PROP_HEIGHT ),
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										sizeritem->GetPropertyAsIntegerByKey(PROP_FLAG),
+										sizeritem->GetPropertyAsIntegerByKey(PROP_BORDER),
 										NULL
 										);
 		}
@@ -397,8 +425,8 @@ private:
 			return new wxGBSizerItem( 	windowChild,
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										sizeritem->GetPropertyAsIntegerByKey(PROP_FLAG),
+										sizeritem->GetPropertyAsIntegerByKey(PROP_BORDER),
 										NULL
 										);
 		}
@@ -407,8 +435,8 @@ private:
 			return new wxGBSizerItem( 	sizerChild,
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										sizeritem->GetPropertyAsIntegerByKey(PROP_FLAG),
+										sizeritem->GetPropertyAsIntegerByKey(PROP_BORDER),
 										NULL
 										);
 		}
@@ -422,14 +450,14 @@ private:
 public:
 	wxObject* Create(IObject* obj, wxObject* /*parent*/) override {
 		wxGridBagSizer* sizer = new wxGridBagSizer(
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsIntegerByKey(PROP_VGAP),
+			obj->GetPropertyAsIntegerByKey(PROP_HGAP));
 
 		AddProperties( obj, sizer );
 
-		if ( !obj->IsNull( _("empty_cell_size") ) )
+		if ( !obj->IsNullByKey( PROP_EMPTY_CELL_SIZE ) )
 		{
-			sizer->SetEmptyCellSize( obj->GetPropertyAsSize( _("empty_cell_size") ) );
+			sizer->SetEmptyCellSize( obj->GetPropertyAsSizeByKey( PROP_EMPTY_CELL_SIZE ) );
 		}
 
 		return sizer;
@@ -464,9 +492,9 @@ public:
 			IObject* isizerItem = manager->GetIObject( wxsizerItem );
 
 			// Get the location of the item
-			wxGBSpan span( isizerItem->GetPropertyAsInteger( _("rowspan") ), isizerItem->GetPropertyAsInteger( _("colspan") ) );
+			wxGBSpan span( isizerItem->GetPropertyAsIntegerByKey( PROP_ROWSPAN ), isizerItem->GetPropertyAsIntegerByKey( PROP_COLSPAN ) );
 
-			int column = isizerItem->GetPropertyAsInteger( _("column") );
+			int column = isizerItem->GetPropertyAsIntegerByKey( PROP_COLUMN );
 			if ( column < 0 )
 			{
 				// Needs to be auto positioned after the other children are added
@@ -478,7 +506,7 @@ public:
 				continue;
 			}
 
-			wxGBPosition position( isizerItem->GetPropertyAsInteger( _("row") ), column );
+			wxGBPosition position( isizerItem->GetPropertyAsIntegerByKey( PROP_ROW ), column );
 
 			// Check for intersection
 			if ( sizer->CheckForIntersection( position, span ) )
@@ -514,16 +542,16 @@ public:
 		}
 	}
 
-	ticpp::Element* ExportToXrc(IObject* obj) override {
-		ObjectToXrcFilter xrc(obj, _("wxGridBagSizer"));
+	bool WriteXrc(IObject* obj, IXrcWriter* writer) override {
+		ObjectToXrcFilter xrc(writer, obj, _("wxGridBagSizer"));
 		ExportXRCProperties( &xrc, obj );
-		return xrc.GetXrcObject();
+		return true;
 	}
 
-	ticpp::Element* ImportFromXrc(ticpp::Element* xrcObj) override {
-		XrcToXfbFilter filter(xrcObj, _("wxGridBagSizer"));
+	bool ReadXrc(ticpp::Element* xrcObj, IXfbWriter* writer) override {
+		XrcToXfbFilter filter(writer, xrcObj, _("wxGridBagSizer"));
 		ImportXRCProperties( &filter );
-		return filter.GetXfbObject();
+		return true;
 	}
 };
 
@@ -567,30 +595,30 @@ public:
 	wxObject* Create(IObject* obj, wxObject* parent) override {
 		wxStdDialogButtonSizer* sizer =  new wxStdDialogButtonSizer();
 
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) );
 
-		if (obj->GetPropertyAsInteger(_("OK")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_OK) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_OK));
 		}
-		if (obj->GetPropertyAsInteger(_("Yes")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_YES) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_YES));
 		}
-		if (obj->GetPropertyAsInteger(_("Save")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_SAVE) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_SAVE));
 		}
-		if (obj->GetPropertyAsInteger(_("Apply")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_APPLY) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_APPLY));
 		}
-		if (obj->GetPropertyAsInteger(_("No")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_NO) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_NO));
 		}
-		if (obj->GetPropertyAsInteger(_("Cancel")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_CANCEL) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_CANCEL));
 		}
-		if (obj->GetPropertyAsInteger(_("Help")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_HELP) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_HELP));
 		}
-		if (obj->GetPropertyAsInteger(_("ContextHelp")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_CONTEXTHELP) != 0) {
 			sizer->AddButton(new wxButton((wxWindow*)parent, wxID_CONTEXT_HELP));
 		}
 
@@ -602,31 +630,31 @@ public:
 		ObjectToXrcFilter xrc(obj, _("wxStdDialogButtonSizer"));
 		ticpp::Element* sizer = xrc.GetXrcObject();
 
-		if (obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize) {
+		if (obj->GetPropertyAsSizeByKey(PROP_MINIMUM_SIZE) != wxDefaultSize) {
 			xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		}
-		if (obj->GetPropertyAsInteger(_("OK")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_OK) != 0) {
 			AddXRCButton(sizer, "wxID_OK", "&OK");
 		}
-		if (obj->GetPropertyAsInteger(_("Yes")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_YES) != 0) {
 			AddXRCButton(sizer, "wxID_YES", "&Yes");
 		}
-		if (obj->GetPropertyAsInteger(_("Save")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_SAVE) != 0) {
 			AddXRCButton(sizer, "wxID_SAVE", "&Save");
 		}
-		if (obj->GetPropertyAsInteger(_("Apply")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_APPLY) != 0) {
 			AddXRCButton(sizer, "wxID_APPLY", "&Apply");
 		}
-		if (obj->GetPropertyAsInteger(_("No")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_NO) != 0) {
 			AddXRCButton(sizer, "wxID_NO", "&No");
 		}
-		if (obj->GetPropertyAsInteger(_("Cancel")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_CANCEL) != 0) {
 			AddXRCButton(sizer, "wxID_CANCEL", "&Cancel");
 		}
-		if (obj->GetPropertyAsInteger(_("Help")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_HELP) != 0) {
 			AddXRCButton(sizer, "wxID_HELP", "&Help");
 		}
-		if (obj->GetPropertyAsInteger(_("ContextHelp")) != 0) {
+		if (obj->GetPropertyAsIntegerByKey(PROP_CONTEXTHELP) != 0) {
 			AddXRCButton(sizer, "wxID_CONTEXT_HELP", "");
 		}
 
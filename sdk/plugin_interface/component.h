@@ -56,6 +56,30 @@ enum
 };
 
 
+/**
+ * Name of a property, for reading it without looking it up by name.
+ *
+ * The first read of a key resolves it to the index of the property in the objects
+ * of the class, which is cached by the class, so keys must have static storage:
+ *
+ * @code
+ *  constexpr PropertyKey PROP_LABEL( "label" );
+ *  ...
+ *  wxString label = obj->GetPropertyAsStringByKey( PROP_LABEL );
+ * @endcode
+ */
+class PropertyKey
+{
+ public:
+  constexpr explicit PropertyKey( const char* name ) : m_name( name ) {}
+
+  /// UTF-8 name of the property, its address identifies the key
+  constexpr const char* GetName() const { return m_name; }
+
+ private:
+  const char* m_name;
+};
+
 // Plugins interface
 // The point is to provide an interface for accessing the object's properties
 // from the plugin itself, in a safe way.
@@ -79,6 +103,52 @@ class IObject
   virtual wxString GetObjectTypeName() = 0;
   virtual IObject* GetChildPtr (unsigned int idx) = 0;
   virtual ~IObject(){}
+
+  // New functions are appended here, see WXFB_PLUGIN_INTERFACE_VERSION
+
+  // Same as the functions above, with the property resolved through a key.
+  // Named apart from them, as compilers may group the overloads of a virtual function in the vtable
+  virtual bool     IsNullByKey (const PropertyKey& key) = 0;
+  virtual int      GetPropertyAsIntegerByKey (const PropertyKey& key) = 0;
+  virtual wxFontContainer   GetPropertyAsFontByKey    (const PropertyKey& key) = 0;
+  virtual wxColour GetPropertyAsColourByKey  (const PropertyKey& key) = 0;
+  virtual wxString GetPropertyAsStringByKey  (const PropertyKey& key) = 0;
+  virtual wxPoint  GetPropertyAsPointByKey   (const PropertyKey& key) = 0;
+  virtual wxSize   GetPropertyAsSizeByKey    (const PropertyKey& key) = 0;
+  virtual wxBitmap GetPropertyAsBitmapByKey  (const PropertyKey& key) = 0;
+  virtual wxArrayInt GetPropertyAsArrayIntByKey(const PropertyKey& key) = 0;
+  virtual wxArrayString GetPropertyAsArrayStringByKey(const PropertyKey& key) = 0;
+  virtual double GetPropertyAsFloatByKey(const PropertyKey& key) = 0;
+};
+
+/**
+ * Receives the XRC of an object, see IComponent::WriteXrc.
+ *
+ * Elements are nested by StartElement/EndElement pairs, attributes and text
+ * belong to the innermost open element.
+ */
+class IXrcWriter
+{
+ public:
+  virtual void StartElement( const wxString& name ) = 0;
+  virtual void AddAttribute( const wxString& name, const wxString& value ) = 0;
+  virtual void AddText( const wxString& text ) = 0;
+  virtual void EndElement() = 0;
+  virtual ~IXrcWriter(){}
+};
+
+/**
+ * Receives the properties of an object imported from XRC, see IComponent::ReadXrc.
+ *
+ * Properties are named as in the project file. AddObject creates a child of the
+ * object, the returned writer belongs to this one.
+ */
+class IXfbWriter
+{
+ public:
+  virtual void SetProperty( const wxString& name, const wxString& value ) = 0;
+  virtual IXfbWriter* AddObject( const wxString& classname ) = 0;
+  virtual ~IXfbWriter(){}
 };
 
 // Interface which intends to contain all the components for a plugin
@@ -152,6 +222,30 @@ class IComponent
 
   virtual int GetComponentType() = 0;
   virtual ~IComponent(){}
+
+  // New functions are appended here, see WXFB_PLUGIN_INTERFACE_VERSION
+
+  /**
+   * Writes the object to XRC without building an XML element.
+   * The component starts the "object" element and writes its properties, but does not
+   * end it: the children are written by the caller, which also ends the element.
+   *
+   * @return false if the component does not support it, ExportToXrc is used instead.
+   */
+  virtual bool WriteXrc( IObject* obj, IXrcWriter* writer ) = 0;
+
+  /**
+   * Imports an XRC object without building a project file XML element: the component
+   * writes the properties straight to the object, which the caller has already created.
+   * The child objects are imported by the caller, xrcObj may only hold them as empty
+   * "object" elements.
+   *
+   * Support is detected by calling it once per class with an empty element, so it must
+   * not do anything but write to the writer.
+   *
+   * @return false if the component does not support it, ImportFromXrc is used instead.
+   */
+  virtual bool ReadXrc( ticpp::Element* xrcObj, IXfbWriter* writer ) = 0;
 };
 
 // Used to identify wxObject* that must be manually deleted
@@ -213,6 +307,18 @@ public:
 	virtual ~IManager(){}
 };
 
+/**
+ * Version of the interfaces above, exported by every library through END_LIBRARY().
+ * Libraries built before it was introduced are version 1.
+ *
+ * Virtual functions are only appended to the interfaces, so the ones a library was
+ * built with keep their place. The functions it does not know about are not called.
+ *
+ * Version 2 added IComponent::WriteXrc and IComponent::ReadXrc.
+ * Version 3 added the IObject functions reading a property through a PropertyKey.
+ */
+#define WXFB_PLUGIN_INTERFACE_VERSION 3
+
 #ifdef BUILD_DLL
 	#define DLL_FUNC extern "C" WXEXPORT
 #else
@@ -225,6 +331,9 @@ DLL_FUNC IComponentLibrary* GetComponentLibrary( IManager* manager );
 // Function that the application calls to free the library
 DLL_FUNC void FreeComponentLibrary( IComponentLibrary* lib );
 
+// Function that the application calls to get the interface version the library was built with
+DLL_FUNC int GetPluginInterfaceVersion();
+
 #define BEGIN_LIBRARY()  															\
 \
 extern "C" WXEXPORT IComponentLibrary* GetComponentLibrary( IManager* manager ) 	\
@@ -237,6 +346,10 @@ extern "C" WXEXPORT IComponentLibrary* GetComponentLibrary( IManager* manager )
 	extern "C" WXEXPORT void FreeComponentLibrary( IComponentLibrary* lib ) 	        \
 	{                                                                                   \
         delete lib;                                                                     \
+	}                                                                                   \
+	extern "C" WXEXPORT int GetPluginInterfaceVersion()                                 \
+	{                                                                                   \
+        return WXFB_PLUGIN_INTERFACE_VERSION;                                           \
 	}
 
 #define MACRO( name ) \
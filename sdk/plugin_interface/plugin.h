@@ -230,11 +230,21 @@ public:
 		return NULL;
 	}
 
+	bool WriteXrc(IObject* /*obj*/, IXrcWriter* /*writer*/) override
+	{
+		return false;
+	}
+
 	ticpp::Element* ImportFromXrc(ticpp::Element* /*xrcObj*/) override
 	{
 		return NULL;
 	}
 
+	bool ReadXrc(ticpp::Element* /*xrcObj*/, IXfbWriter* /*writer*/) override
+	{
+		return false;
+	}
+
 	int GetComponentType() override
 	{
 		return m_type;
@@ -26,10 +26,29 @@
 #include "xrcconv.h"
 #include "wx/tokenzr.h"
 
+#include <memory>
 #include <set>
+#include <sstream>
+#include <vector>
 
 #include <ticpp.h>
 
+// Properties read by the components, resolved once per class
+constexpr PropertyKey PROP_BG( "bg" );
+constexpr PropertyKey PROP_ENABLED( "enabled" );
+constexpr PropertyKey PROP_EXTRA_STYLE( "extra_style" );
+constexpr PropertyKey PROP_FG( "fg" );
+constexpr PropertyKey PROP_FOCUSED( "focused" );
+constexpr PropertyKey PROP_FONT( "font" );
+constexpr PropertyKey PROP_HIDDEN( "hidden" );
+constexpr PropertyKey PROP_POS( "pos" );
+constexpr PropertyKey PROP_SIZE( "size" );
+constexpr PropertyKey PROP_STYLE( "style" );
+constexpr PropertyKey PROP_SUBCLASS( "subclass" );
+constexpr PropertyKey PROP_TOOLTIP( "tooltip" );
+constexpr PropertyKey PROP_WINDOW_EXTRA_STYLE( "window_extra_style" );
+constexpr PropertyKey PROP_WINDOW_STYLE( "window_style" );
+
 static wxString StringToXrcText( const wxString &str )
 {
 	wxString result;
@@ -109,9 +128,16 @@ static wxString XrcTextToString( const wxString &str )
 	return result;
 }
 
+static IComponentLibrary* GetSynonymousLibrary()
+{
+	// Built once per plugin, building it for every style made importing large files slow
+	static std::unique_ptr< IComponentLibrary > lib( GetComponentLibrary( NULL ) );
+	return lib.get();
+}
+
 static wxString ReplaceSynonymous( const wxString &bitlist )
 {
-	IComponentLibrary* lib = GetComponentLibrary( NULL );
+	IComponentLibrary* lib = GetSynonymousLibrary();
 	wxString result, translation;
 	wxStringTokenizer tkz( bitlist, wxT( "|" ) );
 	while ( tkz.HasMoreTokens() )
@@ -130,75 +156,159 @@ static wxString ReplaceSynonymous( const wxString &bitlist )
 			result += token;
 
 	}
-	delete lib;
 
 	return result;
 }
 
+/**
+ * Builds the element returned by ObjectToXrcFilter::GetXrcObject.
+ */
+class TicppXrcWriter : public IXrcWriter
+{
+private:
+	ticpp::Element* m_root;
+	std::vector< ticpp::Element* > m_open;
+
+public:
+	TicppXrcWriter()
+	:
+	m_root( NULL )
+	{
+	}
+
+	~TicppXrcWriter() override
+	{
+		for ( size_t i = 0; i < m_open.size(); ++i )
+		{
+			if ( m_open[i] != m_root )
+			{
+				delete m_open[i];
+			}
+		}
+		delete m_root;
+	}
+
+	ticpp::Element* GetRoot()
+	{
+		return m_root;
+	}
+
+	void StartElement( const wxString& name ) override
+	{
+		ticpp::Element* element = new ticpp::Element( name.mb_str( wxConvUTF8 ) );
+		if ( !m_root )
+		{
+			m_root = element;
+		}
+		m_open.push_back( element );
+	}
+
+	void AddAttribute( const wxString& name, const wxString& value ) override
+	{
+		m_open.back()->SetAttribute( std::string( name.mb_str( wxConvUTF8 ) ), value.mb_str( wxConvUTF8 ) );
+	}
+
+	void AddText( const wxString& text ) override
+	{
+		m_open.back()->SetText( text.mb_str( wxConvUTF8 ) );
+	}
+
+	void EndElement() override
+	{
+		ticpp::Element* element = m_open.back();
+		m_open.pop_back();
+		if ( element != m_root )
+		{
+			m_open.back()->LinkEndChild( element );
+			delete element;
+		}
+	}
+};
+
 ObjectToXrcFilter::ObjectToXrcFilter( 	IObject *obj,
 										const wxString &classname,
 										const wxString &objname,
 										const wxString &base )
 {
 	m_obj = obj;
-	m_xrcObj = new ticpp::Element( "object" );
+	m_builder = new TicppXrcWriter;
+	m_writer = m_builder;
 
-	m_xrcObj->SetAttribute( "class", classname.mb_str( wxConvUTF8 ) );
+	StartObject( classname, objname, base );
+}
 
-	if ( objname != wxT( "" ) )
-		m_xrcObj->SetAttribute( "name", objname.mb_str( wxConvUTF8 ) );
+ObjectToXrcFilter::ObjectToXrcFilter( 	IXrcWriter *writer,
+										IObject *obj,
+										const wxString &classname,
+										const wxString &objname,
+										const wxString &base )
+{
+	m_obj = obj;
+	m_builder = NULL;
+	m_writer = writer;
 
-	if ( base != wxT( "" ) )
-		m_xrcObj->SetAttribute( "base", base.mb_str( wxConvUTF8 ) );
+	StartObject( classname, objname, base );
 }
 
 ObjectToXrcFilter::~ObjectToXrcFilter()
 {
-	delete m_xrcObj;
+	delete m_builder;
+}
+
+void ObjectToXrcFilter::StartObject( const wxString &classname, const wxString &objname, const wxString &base )
+{
+	m_writer->StartElement( wxT( "object" ) );
+
+	m_writer->AddAttribute( wxT( "class" ), classname );
+
+	if ( objname != wxT( "" ) )
+		m_writer->AddAttribute( wxT( "name" ), objname );
+
+	if ( base != wxT( "" ) )
+		m_writer->AddAttribute( wxT( "base" ), base );
 }
 
 void ObjectToXrcFilter::AddProperty( const wxString &objPropName,
                                      const wxString &xrcPropName,
                                      const int &propType )
 {
-	std::string name( xrcPropName.mb_str( wxConvUTF8 ) );
-	ticpp::Element propElement( name );
+	m_writer->StartElement( xrcPropName );
 
 	switch ( propType )
 	{
 		case XRC_TYPE_SIZE:
 		case XRC_TYPE_POINT:
 		case XRC_TYPE_BITLIST:
-			LinkText( m_obj->GetPropertyAsString( objPropName ), &propElement );
+			LinkText( m_obj->GetPropertyAsString( objPropName ) );
 			break;
 
 		case XRC_TYPE_TEXT:
 			// The text must be converted to XRC format
 			{
 				wxString text = m_obj->GetPropertyAsString( objPropName );
-				LinkText( text, &propElement, true );
+				LinkText( text, true );
 			}
 			break;
 
 		case XRC_TYPE_BOOL:
 		case XRC_TYPE_INTEGER:
-			LinkInteger( m_obj->GetPropertyAsInteger( objPropName ), &propElement );
+			LinkInteger( m_obj->GetPropertyAsInteger( objPropName ) );
 			break;
 
 		case XRC_TYPE_FLOAT:
-			LinkFloat( m_obj->GetPropertyAsFloat( objPropName ), &propElement );
+			LinkFloat( m_obj->GetPropertyAsFloat( objPropName ) );
 			break;
 
 		case XRC_TYPE_COLOUR:
-			LinkColour( m_obj->GetPropertyAsColour( objPropName ), &propElement );
+			LinkColour( m_obj->GetPropertyAsColour( objPropName ) );
 			break;
 
 		case XRC_TYPE_FONT:
-			LinkFont( m_obj->GetPropertyAsFont( objPropName ), &propElement );
+			LinkFont( m_obj->GetPropertyAsFont( objPropName ) );
 			break;
 
 		case XRC_TYPE_STRINGLIST:
-			LinkStringList( m_obj->GetPropertyAsArrayString( objPropName ), &propElement );
+			LinkStringList( m_obj->GetPropertyAsArrayString( objPropName ) );
 			break;
 
 		case XRC_TYPE_BITMAP:
@@ -222,29 +332,29 @@ void ObjectToXrcFilter::AddProperty( const wxString &objPropName,
 
 				if (bitmapProp.StartsWith(_("Load From File")) || bitmapProp.StartsWith(_("Load From Embedded File")) || bitmapProp.StartsWith(_("Load From XRC")))
 				{
-					LinkText( filename.Trim().Trim(false), &propElement );
+					LinkText( filename.Trim().Trim(false) );
 				}
 				else if( bitmapProp.StartsWith( _("Load From Art Provider") ) )
 				{
-					propElement.SetAttribute( "stock_id", filename.BeforeFirst( wxT(';') ).Trim().Trim(false).mb_str( wxConvUTF8 ) );
-					propElement.SetAttribute( "stock_client", filename.AfterFirst( wxT(';') ).Trim().Trim(false).mb_str( wxConvUTF8 ) );
+					m_writer->AddAttribute( wxT( "stock_id" ), filename.BeforeFirst( wxT(';') ).Trim().Trim(false) );
+					m_writer->AddAttribute( wxT( "stock_client" ), filename.AfterFirst( wxT(';') ).Trim().Trim(false) );
 
-					LinkText( wxT("undefined.png"), &propElement );
+					LinkText( wxT("undefined.png") );
 				}
 			}
 			break;
 	}
 
-	m_xrcObj->LinkEndChild( &propElement );
+	m_writer->EndElement();
 }
 
 void ObjectToXrcFilter::AddPropertyValue ( 	const wxString &xrcPropName,
 											const wxString &xrcPropValue,
 											bool xrcFormat )
 {
-	ticpp::Element propElement( xrcPropName.mb_str( wxConvUTF8 ) );
-	LinkText( xrcPropValue, &propElement, xrcFormat );
-	m_xrcObj->LinkEndChild( &propElement );
+	m_writer->StartElement( xrcPropName );
+	LinkText( xrcPropValue, xrcFormat );
+	m_writer->EndElement();
 }
 
 void ObjectToXrcFilter::AddPropertyPair ( const wxString& objPropName1, const wxString& objPropName2, const wxString& xrcPropName )
@@ -259,178 +369,176 @@ void ObjectToXrcFilter::AddPropertyPair ( const wxString& objPropName1, const wx
 
 ticpp::Element* ObjectToXrcFilter::GetXrcObject()
 {
-	return new ticpp::Element( *m_xrcObj );
+	if ( !m_builder )
+	{
+		// Everything was already written to the writer
+		return NULL;
+	}
+	return new ticpp::Element( *m_builder->GetRoot() );
+}
+
+void ObjectToXrcFilter::LinkText( const wxString &text, bool xrcFormat )
+{
+	m_writer->AddText( xrcFormat ? StringToXrcText( text ) : text );
 }
 
-void ObjectToXrcFilter::LinkText( const wxString &text, ticpp::Element *propElement, bool xrcFormat )
+void ObjectToXrcFilter::LinkInteger( const int &integer )
 {
-	wxString value = ( xrcFormat ? StringToXrcText( text ) : text );
-	propElement->SetText( value.mb_str( wxConvUTF8 ) );
+	m_writer->AddText( wxString::Format( wxT( "%d" ), integer ) );
 }
 
-void ObjectToXrcFilter::LinkInteger( const int &integer, ticpp::Element *propElement )
+void ObjectToXrcFilter::LinkFloat( const double& value )
 {
-	propElement->SetText( integer );
+	// Same formatting as ticpp::Element::SetText( double )
+	std::ostringstream text;
+	text << value;
+	m_writer->AddText( wxString( text.str().c_str(), wxConvUTF8 ) );
 }
 
-void ObjectToXrcFilter::LinkFloat( const double& value, ticpp::Element* propElement )
+void ObjectToXrcFilter::LinkColour( const wxColour &colour )
 {
-	propElement->SetText( value );
+	m_writer->AddText( wxString::Format( wxT( "#%02x%02x%02x" ), colour.Red(), colour.Green(), colour.Blue() ) );
 }
 
-void ObjectToXrcFilter::LinkColour( const wxColour &colour, ticpp::Element *propElement )
+void ObjectToXrcFilter::LinkTextElement( const wxString &name, const wxString &text )
 {
-	wxString value = wxString::Format( wxT( "#%02x%02x%02x" ), colour.Red(), colour.Green(), colour.Blue() );
-	propElement->SetText( value.mb_str( wxConvUTF8 ) );
+	m_writer->StartElement( name );
+	m_writer->AddText( text );
+	m_writer->EndElement();
 }
 
-void ObjectToXrcFilter::LinkFont( const wxFontContainer &font, ticpp::Element *propElement )
+void ObjectToXrcFilter::LinkFont( const wxFontContainer &font )
 {
 	if ( font.GetPointSize() > 0 )
 	{
 		wxString aux;
 		aux.Printf( wxT( "%d" ), font.GetPointSize() );
 
-		ticpp::Element size( "size" );
-		size.SetText( aux.mb_str( wxConvUTF8 ) );
-		propElement->LinkEndChild( &size );
+		LinkTextElement( wxT( "size" ), aux );
 	}
 
-	bool skipFamily = false;
-	ticpp::Element family( "family" );
+	wxString family;
 	switch ( font.GetFamily() )
 	{
 		case wxFONTFAMILY_DECORATIVE:
-			family.SetText( "decorative" );
+			family = wxT( "decorative" );
 			break;
 		case wxFONTFAMILY_ROMAN:
-			family.SetText( "roman" );
+			family = wxT( "roman" );
 			break;
 		case wxFONTFAMILY_SWISS:
-			family.SetText( "swiss" );
+			family = wxT( "swiss" );
 			break;
 		case wxFONTFAMILY_SCRIPT:
-			family.SetText( "script" );
+			family = wxT( "script" );
 			break;
 		case wxFONTFAMILY_MODERN:
-			family.SetText( "modern" );
+			family = wxT( "modern" );
 			break;
 		case wxFONTFAMILY_TELETYPE:
-			family.SetText( "teletype" );
+			family = wxT( "teletype" );
 			break;
 		default:
 		// wxWidgets 2.9.0 doesn't define "default" family
-			skipFamily = true;
 			break;
 	}
-	if( ! skipFamily ) propElement->LinkEndChild( &family );
+	if( !family.empty() ) LinkTextElement( wxT( "family" ), family );
 
-	ticpp::Element style( "style" );
 	switch ( font.GetStyle() )
 	{
 		case wxFONTSTYLE_SLANT:
-			style.SetText( "slant" );
+			LinkTextElement( wxT( "style" ), wxT( "slant" ) );
 			break;
 		case wxFONTSTYLE_ITALIC:
-			style.SetText( "italic" );
+			LinkTextElement( wxT( "style" ), wxT( "italic" ) );
 			break;
 		default:
-			style.SetText( "normal" );
+			LinkTextElement( wxT( "style" ), wxT( "normal" ) );
 			break;
 	}
-	propElement->LinkEndChild( &style );
 
-	ticpp::Element weight( "weight" );
 	switch ( font.GetWeight() )
 	{
 		case wxFONTWEIGHT_LIGHT:
-			weight.SetText( "light" );
+			LinkTextElement( wxT( "weight" ), wxT( "light" ) );
 			break;
 		case wxFONTWEIGHT_BOLD:
-			weight.SetText( "bold" );
+			LinkTextElement( wxT( "weight" ), wxT( "bold" ) );
 			break;
 		default:
-			weight.SetText( "normal" );
+			LinkTextElement( wxT( "weight" ), wxT( "normal" ) );
 			break;
 	}
-	propElement->LinkEndChild( &weight );
 
-	ticpp::Element underlined( "underlined" );
-	underlined.SetText( font.GetUnderlined() ? "1" : "0" );
-	propElement->LinkEndChild( &underlined );
+	LinkTextElement( wxT( "underlined" ), font.GetUnderlined() ? wxT( "1" ) : wxT( "0" ) );
 
 	if ( !font.GetFaceName().empty() )
 	{
-		ticpp::Element face( "face" );
-		face.SetText( font.GetFaceName().mb_str( wxConvUTF8 ) );
-		propElement->LinkEndChild( &face );
+		LinkTextElement( wxT( "face" ), font.GetFaceName() );
 	}
 }
 
-void ObjectToXrcFilter::LinkStringList( const wxArrayString &array, ticpp::Element *propElement, bool xrcFormat )
+void ObjectToXrcFilter::LinkStringList( const wxArrayString &array, bool xrcFormat )
 {
 	for ( size_t i = 0; i < array.GetCount(); i++ )
 	{
-		wxString value = ( xrcFormat ? StringToXrcText( array[i] ) : array[i] );
-		ticpp::Element item( "item" );
-		item.SetText( value.mb_str( wxConvUTF8 ) );
-		propElement->LinkEndChild( &item );
+		LinkTextElement( wxT( "item" ), xrcFormat ? StringToXrcText( array[i] ) : array[i] );
 	}
 }
 
 void ObjectToXrcFilter::AddWindowProperties()
 {
 	wxString style;
-	if ( !m_obj->IsNull( _( "style" ) ) )
-		style = m_obj->GetPropertyAsString( _T( "style" ) );
-	if ( !m_obj->IsNull( _( "window_style" ) ) ){
+	if ( !m_obj->IsNullByKey( PROP_STYLE ) )
+		style = m_obj->GetPropertyAsStringByKey( PROP_STYLE );
+	if ( !m_obj->IsNullByKey( PROP_WINDOW_STYLE ) ){
 		if ( !style.IsEmpty() ) style += _T( '|' );
-		style += m_obj->GetPropertyAsString( _T( "window_style" ) );
+		style += m_obj->GetPropertyAsStringByKey( PROP_WINDOW_STYLE );
 	}
 	if ( !style.IsEmpty() ) AddPropertyValue( _T( "style" ), style );
 
 	wxString extraStyle;
-	if ( !m_obj->IsNull( _( "extra_style" ) ) )
-		extraStyle = m_obj->GetPropertyAsString( _T( "extra_style" ) );
-	if ( !m_obj->IsNull( _( "window_extra_style" ) ) ){
+	if ( !m_obj->IsNullByKey( PROP_EXTRA_STYLE ) )
+		extraStyle = m_obj->GetPropertyAsStringByKey( PROP_EXTRA_STYLE );
+	if ( !m_obj->IsNullByKey( PROP_WINDOW_EXTRA_STYLE ) ){
 		if ( !extraStyle.IsEmpty() ) extraStyle += _T( '|' );
-		extraStyle += m_obj->GetPropertyAsString( _T( "window_extra_style" ) );
+		extraStyle += m_obj->GetPropertyAsStringByKey( PROP_WINDOW_EXTRA_STYLE );
 	}
 	if ( !extraStyle.IsEmpty() ) AddPropertyValue( _T( "exstyle" ), extraStyle );
 
-	if ( !m_obj->IsNull( _( "pos" ) ) )
+	if ( !m_obj->IsNullByKey( PROP_POS ) )
 		AddProperty( _( "pos" ), _( "pos" ), XRC_TYPE_SIZE );
 
-	if ( !m_obj->IsNull( _( "size" ) ) )
+	if ( !m_obj->IsNullByKey( PROP_SIZE ) )
 		AddProperty( _( "size" ), _( "size" ), XRC_TYPE_SIZE );
 
-	if ( !m_obj->IsNull( _( "bg" ) ) )
+	if ( !m_obj->IsNullByKey( PROP_BG ) )
 		AddProperty( _( "bg" ), _( "bg" ), XRC_TYPE_COLOUR );
 
-	if ( !m_obj->IsNull( _( "fg" ) ) )
+	if ( !m_obj->IsNullByKey( PROP_FG ) )
 		AddProperty( _( "fg" ), _( "fg" ), XRC_TYPE_COLOUR );
 
-	if (!m_obj->IsNull(_("enabled")) && m_obj->GetPropertyAsInteger(_("enabled")) == 0) {
+	if (!m_obj->IsNullByKey(PROP_ENABLED) && m_obj->GetPropertyAsIntegerByKey(PROP_ENABLED) == 0) {
 		AddProperty(_("enabled"), _("enabled"), XRC_TYPE_BOOL);
 	}
-	if ( !m_obj->IsNull( _( "focused" ) ) )
+	if ( !m_obj->IsNullByKey( PROP_FOCUSED ) )
 		AddPropertyValue( _( "focused" ), _( "0" ) );
 
-	if (!m_obj->IsNull(_("hidden")) && m_obj->GetPropertyAsInteger(_("hidden")) != 0) {
+	if (!m_obj->IsNullByKey(PROP_HIDDEN) && m_obj->GetPropertyAsIntegerByKey(PROP_HIDDEN) != 0) {
 		AddProperty(_("hidden"), _("hidden"), XRC_TYPE_BOOL);
 	}
-	if ( !m_obj->IsNull( _( "font" ) ) )
+	if ( !m_obj->IsNullByKey( PROP_FONT ) )
 		AddProperty( _( "font" ), _( "font" ), XRC_TYPE_FONT );
 
-	if ( !m_obj->IsNull( _( "tooltip" ) ) )
+	if ( !m_obj->IsNullByKey( PROP_TOOLTIP ) )
 		AddProperty( _( "tooltip" ), wxT( "tooltip" ), XRC_TYPE_TEXT );
 
-	if ( !m_obj->IsNull( _( "subclass" ) ) )
+	if ( !m_obj->IsNullByKey( PROP_SUBCLASS ) )
 	{
 		wxString subclass = m_obj->GetChildFromParentProperty( _( "subclass" ), wxT( "name" ) );
 		if ( !subclass.empty() )
 		{
-			m_xrcObj->SetAttribute( "subclass", subclass.mb_str( wxConvUTF8 ) );
+			m_writer->AddAttribute( wxT( "subclass" ), subclass );
 		}
 	}
 }
@@ -443,6 +551,7 @@ XrcToXfbFilter::XrcToXfbFilter( ticpp::Element *obj,
 {
 	m_xrcObj = obj;
 	m_xfbObj = new ticpp::Element( "object" );
+	m_writer = NULL;
 
 	try
 	{
@@ -463,13 +572,34 @@ XrcToXfbFilter::XrcToXfbFilter( ticpp::Element *obj, const wxString &classname )
 {
 	m_xrcObj = obj;
 	m_xfbObj = new ticpp::Element( "object" );
+	m_writer = NULL;
 
 	m_xfbObj->SetAttribute( "class", classname.mb_str( wxConvUTF8 ) );
 
+	AddNameProperty();
+}
+
+XrcToXfbFilter::XrcToXfbFilter( IXfbWriter *writer, ticpp::Element *obj, const wxString &/*classname*/ )
+{
+	// The writer's object was created by the caller, which already knows its class
+	m_xrcObj = obj;
+	m_xfbObj = NULL;
+	m_writer = writer;
+
+	AddNameProperty();
+}
+
+XrcToXfbFilter::~XrcToXfbFilter()
+{
+	delete m_xfbObj;
+}
+
+void XrcToXfbFilter::AddNameProperty()
+{
 	try
 	{
 		std::string name;
-		obj->GetAttribute( "name", &name );
+		m_xrcObj->GetAttribute( "name", &name );
 		wxString objname( name.c_str(), wxConvUTF8 );
 		AddPropertyValue( wxT( "name" ), objname );
 	}
@@ -479,9 +609,18 @@ XrcToXfbFilter::XrcToXfbFilter( ticpp::Element *obj, const wxString &classname )
 	}
 }
 
-XrcToXfbFilter::~XrcToXfbFilter()
+void XrcToXfbFilter::SetXfbProperty( const wxString &name, const wxString &value )
 {
-	delete m_xfbObj;
+	if ( m_writer )
+	{
+		m_writer->SetProperty( name, value );
+		return;
+	}
+
+	ticpp::Element propElement( "property" );
+	propElement.SetAttribute( "name", name.mb_str( wxConvUTF8 ) );
+	propElement.SetText( value.mb_str( wxConvUTF8 ) );
+	m_xfbObj->LinkEndChild( &propElement );
 }
 
 
@@ -494,63 +633,58 @@ void XrcToXfbFilter::AddProperty( const wxString &xrcPropName,
                                   const wxString &xfbPropName,
                                   const int &propType )
 {
-	ticpp::Element propElement( "property" );
-	propElement.SetAttribute( "name", xfbPropName.mb_str( wxConvUTF8 ) );
+	wxString value;
 
 	switch ( propType )
 	{
 		case XRC_TYPE_SIZE:
 		case XRC_TYPE_POINT:
 		case XRC_TYPE_BOOL:
-			ImportTextProperty( xrcPropName, &propElement );
+			value = ImportTextProperty( xrcPropName );
 			break;
 
 		case XRC_TYPE_TEXT:
-			ImportTextProperty( xrcPropName, &propElement, true );
+			value = ImportTextProperty( xrcPropName, true );
 			break;
 
 		case XRC_TYPE_INTEGER:
-			ImportIntegerProperty( xrcPropName, &propElement );
+			value = ImportIntegerProperty( xrcPropName );
 			break;
 
 		case XRC_TYPE_FLOAT:
-			ImportFloatProperty( xrcPropName, &propElement );
+			value = ImportFloatProperty( xrcPropName );
 			break;
 
 		case XRC_TYPE_BITLIST:
-			ImportBitlistProperty( xrcPropName, &propElement );
+			value = ImportBitlistProperty( xrcPropName );
 			break;
 
 		case XRC_TYPE_COLOUR:
-			ImportColourProperty( xrcPropName, &propElement );
+			value = ImportColourProperty( xrcPropName );
 			break;
 
 		case XRC_TYPE_FONT:
-			ImportFontProperty( xrcPropName, &propElement );
+			value = ImportFontProperty( xrcPropName );
 			break;
 
 		case XRC_TYPE_STRINGLIST:
-			ImportStringListProperty( xrcPropName, &propElement, true );
+			value = ImportStringListProperty( xrcPropName, true );
 			break;
 
 		case XRC_TYPE_BITMAP:
-			ImportBitmapProperty( xrcPropName, &propElement );
+			value = ImportBitmapProperty( xrcPropName );
 			break;
 
 	}
 
-	m_xfbObj->LinkEndChild( &propElement );
+	SetXfbProperty( xfbPropName, value );
 }
 
 void XrcToXfbFilter::AddPropertyValue ( const wxString &xfbPropName,
                                         const wxString &xfbPropValue,
                                         bool parseXrcText )
 {
-	ticpp::Element propElement( "property" );
-	propElement.SetAttribute( "name", xfbPropName.mb_str( wxConvUTF8 ) );
-	wxString value = ( parseXrcText ? XrcTextToString( xfbPropValue ) : xfbPropValue );
-	propElement.SetText( value.mb_str( wxConvUTF8 ) );
-	m_xfbObj->LinkEndChild( &propElement );
+	SetXfbProperty( xfbPropName, parseXrcText ? XrcTextToString( xfbPropValue ) : xfbPropValue );
 }
 
 void XrcToXfbFilter::AddStyleProperty()
@@ -697,14 +831,16 @@ void XrcToXfbFilter::AddPropertyPair( const char* xrcPropName, const wxString& x
 
 ticpp::Element* XrcToXfbFilter::GetXfbObject()
 {
+	if ( !m_xfbObj )
+	{
+		return NULL;
+	}
 	return m_xfbObj->Clone().release()->ToElement();
 }
 
 //-----------------------------
 
-void XrcToXfbFilter::ImportTextProperty( 	const wxString &xrcPropName,
-											ticpp::Element *property,
-											bool parseXrcText )
+wxString XrcToXfbFilter::ImportTextProperty( const wxString &xrcPropName, bool parseXrcText )
 {
 	try
 	{
@@ -716,41 +852,43 @@ void XrcToXfbFilter::ImportTextProperty( 	const wxString &xrcPropName,
 		if ( parseXrcText )
 			value = XrcTextToString( value );
 
-		property->SetText( value.mb_str( wxConvUTF8 ) );
+		return value;
 	}
 	catch( ticpp::Exception& ex )
 	{
 		wxLogDebug( wxString( ex.m_details.c_str(), wxConvUTF8 ) );
 	}
+
+	return wxEmptyString;
 }
 
-void XrcToXfbFilter::ImportIntegerProperty( const wxString &xrcPropName, ticpp::Element *property )
+wxString XrcToXfbFilter::ImportIntegerProperty( const wxString &xrcPropName )
 {
 	try
 	{
 		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
-		property->SetText( xrcProperty->GetText() );
+		return wxString( xrcProperty->GetText().c_str(), wxConvUTF8 );
 	}
 	catch( ticpp::Exception& )
 	{
-		property->SetText( "0" );
+		return wxT( "0" );
 	}
 }
 
-void XrcToXfbFilter::ImportFloatProperty( const wxString &xrcPropName, ticpp::Element *property )
+wxString XrcToXfbFilter::ImportFloatProperty( const wxString &xrcPropName )
 {
 	try
 	{
 		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
-		property->SetText( xrcProperty->GetText() );
+		return wxString( xrcProperty->GetText().c_str(), wxConvUTF8 );
 	}
 	catch( ticpp::Exception& )
 	{
-		property->SetText( "0.0" );
+		return wxT( "0.0" );
 	}
 }
 
-void XrcToXfbFilter::ImportBitlistProperty( const wxString &xrcPropName, ticpp::Element *property )
+wxString XrcToXfbFilter::ImportBitlistProperty( const wxString &xrcPropName )
 {
 	try
 	{
@@ -758,15 +896,17 @@ void XrcToXfbFilter::ImportBitlistProperty( const wxString &xrcPropName, ticpp::
 
 		wxString bitlist = wxString( xrcProperty->GetText().c_str(), wxConvUTF8 );
 		bitlist = ReplaceSynonymous( bitlist );
-		property->SetText( bitlist.mb_str( wxConvUTF8 ) );
+		return bitlist;
 	}
 	catch( ticpp::Exception& ex )
 	{
 		wxLogDebug( wxString( ex.m_details.c_str(), wxConvUTF8 ) );
 	}
+
+	return wxEmptyString;
 }
 
-void XrcToXfbFilter::ImportFontProperty( const wxString &xrcPropName, ticpp::Element *property )
+wxString XrcToXfbFilter::ImportFontProperty( const wxString &xrcPropName )
 {
 	try
 	{
@@ -884,15 +1024,17 @@ void XrcToXfbFilter::ImportFontProperty( const wxString &xrcPropName, ticpp::Ele
 			wxString::Format( wxT("%s,%d,%d,%d,%d,%d"), font.GetFaceName().c_str(), font.GetStyle(),
 														font.GetWeight(), font.GetPointSize(),
 														font.GetFamily(), font.GetUnderlined() );
-		property->SetText( font_str.mb_str( wxConvUTF8 ) );
+		return font_str;
 	}
 	catch( ticpp::Exception& ex )
 	{
 		wxLogDebug( wxString( ex.m_details.c_str(), wxConvUTF8 ) );
 	}
+
+	return wxEmptyString;
 }
 
-void XrcToXfbFilter::ImportBitmapProperty( const wxString &xrcPropName, ticpp::Element *property )
+wxString XrcToXfbFilter::ImportBitmapProperty( const wxString &xrcPropName )
 {
 	try
 	{
@@ -906,7 +1048,7 @@ void XrcToXfbFilter::ImportBitmapProperty( const wxString &xrcPropName, ticpp::E
 			res += wxString( xrcProperty->GetAttribute( "stock_id" ).c_str(), wxConvUTF8 );
 			res += wxT(";");
 			res += wxString( xrcProperty->GetAttribute( "stock_client" ).c_str(), wxConvUTF8 );
-			property->SetText( res.Trim().mb_str( wxConvUTF8 ) );
+			return res.Trim();
 		}
 		else
 		{
@@ -914,16 +1056,18 @@ void XrcToXfbFilter::ImportBitmapProperty( const wxString &xrcPropName, ticpp::E
 			wxString res = _("Load From File");
 			res += wxT(";");
 			res += wxString( xrcProperty->GetText().c_str(), wxConvUTF8 );
-			property->SetText( res.Trim().mb_str( wxConvUTF8 ) );
+			return res.Trim();
 		}
 	}
 	catch( ticpp::Exception& ex )
 	{
 		wxLogDebug( wxString( ex.m_details.c_str(), wxConvUTF8 ) );
 	}
+
+	return wxEmptyString;
 }
 
-void XrcToXfbFilter::ImportColourProperty( const wxString &xrcPropName, ticpp::Element *property )
+wxString XrcToXfbFilter::ImportColourProperty( const wxString &xrcPropName )
 {
 	try
 	{
@@ -948,7 +1092,7 @@ void XrcToXfbFilter::ImportColourProperty( const wxString &xrcPropName, ticpp::E
 
 		strOut << red << "," << green << "," << blue;
 
-		property->SetText( strOut.str() );
+		return wxString( strOut.str().c_str(), wxConvUTF8 );
 	}
 	catch( ticpp::Exception& ex )
 	{
@@ -984,12 +1128,14 @@ void XrcToXfbFilter::ImportStringListProperty( const wxString &xrcPropName, ticp
 		}
 
 		res.Trim();
-		property->SetText( res.mb_str( wxConvUTF8 ) );
+		return res;
 	}
 	catch( ticpp::Exception& ex )
 	{
 		wxLogDebug( wxT("%s. line: %i"), wxString( ex.m_details.c_str(), wxConvUTF8 ).c_str(), __LINE__ );
 	}
+
+	return wxEmptyString;
 }
 
 void XrcToXfbFilter::AddWindowProperties()
@@ -1013,9 +1159,6 @@ void XrcToXfbFilter::AddWindowProperties()
 	m_xrcObj->GetAttribute( "subclass", &subclass, false );
 	if ( !subclass.empty() )
 	{
-		ticpp::Element propElement( "property" );
-		propElement.SetAttribute( "name", "subclass" );
-		propElement.SetText( subclass );
-		m_xfbObj->LinkEndChild( &propElement );
+		SetXfbProperty( wxT( "subclass" ), wxString( subclass.c_str(), wxConvUTF8 ) );
 	}
 }
@@ -42,6 +42,8 @@ namespace ticpp
 	class Element;
 }
 
+class TicppXrcWriter;
+
 /**
  * Filter for exporting an objetc to XRC format.
  *
@@ -59,6 +61,9 @@ namespace ticpp
  *  xrc.AddProperty("default", "default", XRC_TYPE_BOOL);
  *  ticpp::Element *xrcObj = xrc.GetXrcObject();
  * @endcode
+ *
+ * Constructed with an IXrcWriter, as in IComponent::WriteXrc, the object is
+ * written directly to the writer and no XML element is built.
  */
 class ObjectToXrcFilter
 {
@@ -68,6 +73,12 @@ class ObjectToXrcFilter
                     const wxString &objname = wxT(""),
                     const wxString &base = wxT(""));
 
+  ObjectToXrcFilter(IXrcWriter *writer,
+                    IObject *obj,
+                    const wxString &classname,
+                    const wxString &objname = wxT(""),
+                    const wxString &base = wxT(""));
+
   ~ObjectToXrcFilter();
 
   void AddProperty (const wxString &objPropName,
@@ -82,18 +93,24 @@ class ObjectToXrcFilter
 
   void AddWindowProperties();
 
+  /**
+   * Returns a copy of the built element, or NULL if the object was written to a writer.
+   */
   ticpp::Element* GetXrcObject();
 
  private:
-  ticpp::Element* m_xrcObj;
   IObject *m_obj;
-
-  void LinkText(const wxString &text, ticpp::Element *propElement, bool xrcFormat = false);
-  void LinkColour(const wxColour &colour, ticpp::Element *propElement);
-  void LinkFont(const wxFontContainer &font, ticpp::Element *propElement);
-  void LinkInteger(const int &integer, ticpp::Element *propElement);
-  void LinkFloat( const double& value, ticpp::Element* propElement );
-  void LinkStringList(const wxArrayString &array, ticpp::Element *propElement,  bool xrcFormat = false);
+  IXrcWriter *m_writer;
+  TicppXrcWriter *m_builder;
+
+  void StartObject(const wxString &classname, const wxString &objname, const wxString &base);
+  void LinkText(const wxString &text, bool xrcFormat = false);
+  void LinkTextElement(const wxString &name, const wxString &text);
+  void LinkColour(const wxColour &colour);
+  void LinkFont(const wxFontContainer &font);
+  void LinkInteger(const int &integer);
+  void LinkFloat( const double& value );
+  void LinkStringList(const wxArrayString &array, bool xrcFormat = false);
 };
 
 /**
@@ -102,6 +119,8 @@ class ObjectToXrcFilter
  * The usage is similar to the ObjectToXrcFilter filter. It's only
  * needed to add the properties with their related types.
  *
+ * Constructed with an IXfbWriter, as in IComponent::ReadXrc, the properties are
+ * written directly to the writer and no XML element is built.
  */
 class XrcToXfbFilter
 {
@@ -113,6 +132,10 @@ class XrcToXfbFilter
   XrcToXfbFilter(ticpp::Element *obj,
                  const wxString &classname,
                  const wxString &objname);
+
+  XrcToXfbFilter(IXfbWriter *writer,
+                 ticpp::Element *obj,
+                 const wxString &classname);
   ~XrcToXfbFilter();
 
   void AddProperty (const wxString &xrcPropName,
@@ -126,20 +149,27 @@ class XrcToXfbFilter
 
   void AddPropertyPair( const char* xrcPropName, const wxString& xfbPropName1, const wxString& xfbPropName2 );
 
+  /**
+   * Returns a copy of the built element, or NULL if the properties were written to a writer.
+   */
   ticpp::Element* GetXfbObject();
 
  private:
   ticpp::Element *m_xfbObj;
   ticpp::Element *m_xrcObj;
-
-  void ImportTextProperty(const wxString &xrcPropName, ticpp::Element *property, bool parseXrcText = false);
-  void ImportIntegerProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportFloatProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportBitlistProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportBitmapProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportColourProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportFontProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportStringListProperty(const wxString &xrcPropName, ticpp::Element *property, bool parseXrcText = false);
+  IXfbWriter *m_writer;
+
+  void AddNameProperty();
+  void SetXfbProperty(const wxString &name, const wxString &value);
+
+  wxString ImportTextProperty(const wxString &xrcPropName, bool parseXrcText = false);
+  wxString ImportIntegerProperty(const wxString &xrcPropName);
+  wxString ImportFloatProperty(const wxString &xrcPropName);
+  wxString ImportBitlistProperty(const wxString &xrcPropName);
+  wxString ImportBitmapProperty(const wxString &xrcPropName);
+  wxString ImportColourProperty(const wxString &xrcPropName);
+  wxString ImportFontProperty(const wxString &xrcPropName);
+  wxString ImportStringListProperty(const wxString &xrcPropName, bool parseXrcText = false);
 
   void AddStyleProperty();
   void AddExtraStyleProperty();
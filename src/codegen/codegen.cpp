@@ -25,12 +25,16 @@
 
 #include "codegen.h"
 
+#include "projectanalysis.h"
 #include "../model/objectbase.h"
 #include "../rad/appdata.h"
+#include "../utils/debug.h"
 #include "../utils/wxfbexception.h"
 
 #include <wx/tokenzr.h>
 
+#include <algorithm>
+
 TemplateParser::TemplateParser(PObjectBase obj, wxString _template)
 :
 m_obj( obj ),
@@ -1122,13 +1126,50 @@ void TemplateParser::ParseUnindent()
 
 wxString TemplateParser::PropertyToCode(PProperty property)
 {
-	if ( property )
+	if ( !property )
 	{
-		return ValueToCode(property->GetType(), property->GetValue());
+		return wxEmptyString;
 	}
-	else
+
+	PropertyType type = property->GetType();
+	ValueCodeCache* cache = ValueCodeCache::GetCurrent();
+	if ( !cache || !IsValueCacheable( type ) )
 	{
-		return wxEmptyString;
+		return ValueToCode( type, property->GetValue() );
+	}
+
+	wxString language = GetLanguage();
+	if ( language.empty() )
+	{
+		return ValueToCode( type, property->GetValue() );
+	}
+
+	const wxString& value = property->GetValue();
+	const wxString* cached = cache->Find( language, type, value );
+	if ( cached )
+	{
+		return *cached;
+	}
+
+	wxString code = ValueToCode( type, value );
+	cache->Store( language, type, value, code );
+	return code;
+}
+
+bool TemplateParser::IsValueCacheable( PropertyType type ) const
+{
+	switch ( type )
+	{
+		case PT_BITLIST:
+		case PT_WXPOINT:
+		case PT_WXSIZE:
+		case PT_WXFONT:
+		case PT_WXCOLOUR:
+		case PT_BITMAP:
+		case PT_STRINGLIST:
+			return true;
+		default:
+			return false;
 	}
 }
 
@@ -1151,3 +1192,213 @@ bool TemplateParser::IsEqual(const wxString& value, const wxString& set)
 
 	return contains;
 }
+
+void UniqueLines::Add( const wxString& line )
+{
+	m_lines.push_back( line );
+	m_index.insert( line );
+}
+
+bool UniqueLines::AddUnique( const wxString& line )
+{
+	if ( !m_index.insert( line ).second )
+	{
+		return false;
+	}
+
+	m_lines.push_back( line );
+	return true;
+}
+
+ProjectDependencies::ProjectDependencies( const wxString& uniquePrefix, bool preprocessorBlocks, bool childrenFirst )
+:
+m_uniquePrefix( uniquePrefix ),
+m_preprocessorBlocks( preprocessorBlocks ),
+m_childrenFirst( childrenFirst )
+{
+}
+
+void ProjectDependencies::AddIncludeTemplate( const wxString& include )
+{
+	if ( include.empty() || !m_templates.insert( include ).second )
+	{
+		return;
+	}
+
+	// Split on newlines to only generate unique include lines
+	// This strips blank lines and trims
+	bool inPreproc = false;
+	wxString::const_iterator first = include.begin();
+	while ( first != include.end() )
+	{
+		wxString::const_iterator last = std::find( first, include.end(), wxT('\n') );
+		if ( last != first )
+		{
+			wxString line( first, last );
+			line.Trim( false );
+			line.Trim( true );
+
+			// Anything within a #if preprocessor block will be written
+			if ( m_preprocessorBlocks )
+			{
+				if ( line.StartsWith( wxT("#if") ) )
+				{
+					inPreproc = true;
+				}
+				else if ( line.StartsWith( wxT("#endif") ) )
+				{
+					inPreproc = false;
+				}
+			}
+
+			// Include lines must be unique to be written, anything else is always written
+			bool unique = !inPreproc && line.StartsWith( m_uniquePrefix );
+			m_templateLines.push_back( std::make_pair( line, unique ) );
+		}
+
+		if ( last == include.end() )
+		{
+			break;
+		}
+		first = last + 1;
+	}
+}
+
+UniqueLines ProjectDependencies::GetIncludes() const
+{
+	UniqueLines includes = subclassIncludes;
+	for ( std::vector< std::pair< wxString, bool > >::const_iterator line = m_templateLines.begin(); line != m_templateLines.end(); ++line )
+	{
+		if ( line->second )
+		{
+			includes.AddUnique( line->first );
+		}
+		else
+		{
+			includes.Add( line->first );
+		}
+	}
+	return includes;
+}
+
+const wxString* CodeGenerator::FindCachedCode( PObjectBase obj, const wxString& key ) const
+{
+	const ProjectAnalysis::Form* form = ( m_analysis ? m_analysis->FindForm( obj ) : NULL );
+	return ( form ? form->FindCode( obj, key ) : NULL );
+}
+
+void CodeGenerator::CacheCode( PObjectBase obj, const wxString& key, const wxString& code ) const
+{
+	const ProjectAnalysis::Form* form = ( m_analysis ? m_analysis->FindForm( obj ) : NULL );
+	if ( form )
+	{
+		form->AddCode( obj, key, code );
+	}
+}
+
+void CodeGenerator::CollectDependencies( PObjectBase obj, ProjectDependencies* deps )
+{
+	PObjectInfo info = obj->GetObjectInfo();
+
+	if ( !deps->IsChildrenFirst() )
+	{
+		deps->AddIncludeTemplate( GetIncludeTemplate( info, obj ) );
+	}
+
+	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+	{
+		CollectDependencies( obj->GetChild( i ), deps );
+	}
+
+	if ( deps->IsChildrenFirst() )
+	{
+		deps->AddIncludeTemplate( GetIncludeTemplate( info, obj ) );
+	}
+
+	// Generate includes for base classes
+	for ( unsigned int i = 0; i < info->GetBaseClassCount( false ); i++ )
+	{
+		CollectClassIncludes( info->GetBaseClass( i, false ), obj, deps );
+	}
+
+	CollectSubclass( obj, deps );
+}
+
+void CodeGenerator::CollectClassIncludes( PObjectInfo info, PObjectBase obj, ProjectDependencies* deps )
+{
+	if ( !info )
+	{
+		return;
+	}
+
+	// Process all the base classes recursively
+	for ( unsigned int i = 0; i < info->GetBaseClassCount( false ); i++ )
+	{
+		CollectClassIncludes( info->GetBaseClass( i, false ), obj, deps );
+	}
+
+	deps->AddIncludeTemplate( GetIncludeTemplate( info, obj ) );
+}
+
+namespace
+{
+	ValueCodeCache* s_currentValueCache = NULL;
+}
+
+ValueCodeCache::Scope::Scope()
+:
+m_cache( NULL )
+{
+	if ( !s_currentValueCache )
+	{
+		m_cache = new ValueCodeCache;
+		s_currentValueCache = m_cache;
+	}
+}
+
+ValueCodeCache::Scope::~Scope()
+{
+	if ( m_cache )
+	{
+		LogDebug( wxT("ValueToCode cache: %lu hits, %lu misses"), m_cache->GetStats().hits, m_cache->GetStats().misses );
+		s_currentValueCache = NULL;
+		delete m_cache;
+	}
+}
+
+ValueCodeCache::ValueCodeCache()
+{
+	m_stats.hits = 0;
+	m_stats.misses = 0;
+}
+
+ValueCodeCache* ValueCodeCache::GetCurrent()
+{
+	return s_currentValueCache;
+}
+
+size_t ValueCodeCache::KeyHash::operator()( const Key& key ) const
+{
+	wxStringHash hash;
+	return hash( key.value ) ^ ( hash( key.language ) << 1 ) ^ ( (size_t)key.type * 31 );
+}
+
+const wxString* ValueCodeCache::Find( const wxString& language, PropertyType type, const wxString& value )
+{
+	Key key = { language, type, value };
+	std::unordered_map< Key, wxString, KeyHash >::const_iterator it = m_codes.find( key );
+	if ( it == m_codes.end() )
+	{
+		m_stats.misses++;
+		return NULL;
+	}
+
+	m_stats.hits++;
+	return &it->second;
+}
+
+void ValueCodeCache::Store( const wxString& language, PropertyType type, const wxString& value, const wxString& code )
+{
+	Key key = { language, type, value };
+	m_codes[ key ] = code;
+}
@@ -35,8 +35,14 @@
 #include "../model/types.h"
 #include "../utils/wxfbdefs.h"
 
+#include <wx/hashmap.h>
 #include <wx/sstream.h>
 
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 /**
 * Template notes
 *
@@ -86,6 +92,77 @@
 *
 */
 
+/**
+* Memo cache of the code generated for property values during one code generation.
+*
+* Entries are keyed by the language of the parser, the property type and the raw value, so
+* identical style flags, fonts or bitmaps shared by many widgets are converted only once.
+* A cache is made current by a ValueCodeCache::Scope, TemplateParser::PropertyToCode uses the
+* current cache, if any.
+*/
+class ValueCodeCache
+{
+public:
+	struct Stats
+	{
+		unsigned long hits;
+		unsigned long misses;
+	};
+
+	/**
+	* Makes a new cache current for the lifetime of the object.
+	* Nested scopes keep using the outermost cache.
+	*/
+	class Scope
+	{
+	private:
+		ValueCodeCache* m_cache;
+
+		Scope( const Scope& );
+		Scope& operator=( const Scope& );
+
+	public:
+		Scope();
+		~Scope();
+	};
+
+	ValueCodeCache();
+
+	/// The cache of the innermost active Scope, NULL outside of code generation
+	static ValueCodeCache* GetCurrent();
+
+	/**
+	* Looks up the code of a value.
+	* @return NULL if the value was not converted before in this language.
+	*/
+	const wxString* Find( const wxString& language, PropertyType type, const wxString& value );
+
+	void Store( const wxString& language, PropertyType type, const wxString& value, const wxString& code );
+
+	const Stats& GetStats() const { return m_stats; }
+
+private:
+	struct Key
+	{
+		wxString language;
+		PropertyType type;
+		wxString value;
+
+		bool operator==( const Key& other ) const
+		{
+			return type == other.type && value == other.value && language == other.language;
+		}
+	};
+
+	struct KeyHash
+	{
+		size_t operator()( const Key& key ) const;
+	};
+
+	std::unordered_map< Key, wxString, KeyHash > m_codes;
+	Stats m_stats;
+};
+
 /**
 * Template Parser
 */
@@ -238,6 +315,18 @@ public:
 	*/
 	virtual wxString ValueToCode(PropertyType type, wxString value) = 0;
 
+	/**
+	* Name of the generated language, part of the ValueCodeCache key.
+	* Parsers returning an empty name are not cached.
+	*/
+	virtual wxString GetLanguage() const { return wxEmptyString; }
+
+	/**
+	* Whether the code of a property type only depends on its value, and is expensive enough
+	* to be kept in the ValueCodeCache.
+	*/
+	virtual bool IsValueCacheable( PropertyType type ) const;
+
 	/**
 	* The "star" function for this class. Analyzes a template, returning the code.
 	*/
@@ -249,6 +338,83 @@ public:
 	void SetPredefined( wxString pred, wxString npred ) { m_pred = pred; m_npred = npred; };
 };
 
+/**
+* Lines of generated code kept in insertion order.
+*
+* Duplicates are detected through a hash set, so building large include sections does not
+* search the lines already added.
+*/
+class UniqueLines
+{
+private:
+	std::vector< wxString > m_lines;
+	std::unordered_set< wxString, wxStringHash, wxStringEqual > m_index;
+
+public:
+	/**
+	* Appends the line, even if it was added before.
+	*/
+	void Add( const wxString& line );
+
+	/**
+	* Appends the line only if it was not added before.
+	* @return false if the line is a duplicate.
+	*/
+	bool AddUnique( const wxString& line );
+
+	bool Contains( const wxString& line ) const { return m_index.count( line ) > 0; }
+	bool empty() const { return m_lines.empty(); }
+
+	const std::vector< wxString >& GetLines() const { return m_lines; }
+};
+
+/**
+* Dependencies of the objects of a project, gathered by CodeGenerator::CollectDependencies.
+*/
+class ProjectDependencies
+{
+private:
+	// Parsed include templates, each one is only split once
+	std::unordered_set< wxString, wxStringHash, wxStringEqual > m_templates;
+
+	// Lines of the include templates, and whether each one must be unique
+	std::vector< std::pair< wxString, bool > > m_templateLines;
+
+	wxString m_uniquePrefix;
+	bool m_preprocessorBlocks;
+	bool m_childrenFirst;
+
+public:
+	/**
+	* @param uniquePrefix Template lines starting with this prefix are written once, an empty prefix makes every line unique.
+	* @param preprocessorBlocks Lines inside #if ... #endif blocks are always written.
+	* @param childrenFirst The include template of an object is added after those of its children.
+	*/
+	ProjectDependencies( const wxString& uniquePrefix, bool preprocessorBlocks, bool childrenFirst );
+
+	/// Forward declarations of the subclasses
+	std::set< wxString > subclasses;
+
+	/// Includes of the subclasses that belong to the source file
+	std::set< wxString > sourceIncludes;
+
+	/// Includes of the subclasses that belong to the header file, written before the include templates
+	UniqueLines subclassIncludes;
+
+	bool IsChildrenFirst() const { return m_childrenFirst; }
+
+	/**
+	* Splits a parsed include template into trimmed, non empty lines.
+	* Templates that were already added are ignored.
+	*/
+	void AddIncludeTemplate( const wxString& include );
+
+	/**
+	* The subclass includes followed by the lines of the include templates.
+	*/
+	UniqueLines GetIncludes() const;
+};
+
 /**
 * Code Generator
 *
@@ -271,6 +437,44 @@ public:
 class CodeGenerator
 {
 protected:
+	/**
+	* Summary of the project being generated, shared by all the generation phases.
+	*/
+	PProjectAnalysis m_analysis;
+
+	/**
+	* Code of a template of obj expanded by an earlier generation while the project was not
+	* modified since, in the analysis of its form.
+	* @param key The language, the template and the options of the expansion.
+	* @return NULL if there is none.
+	*/
+	const wxString* FindCachedCode( PObjectBase obj, const wxString& key ) const;
+
+	/**
+	* Keeps the expanded code of a template of obj for FindCachedCode().
+	*/
+	void CacheCode( PObjectBase obj, const wxString& key, const wxString& code ) const;
+
+	/**
+	* Visits every object of the project once, collecting its subclass declarations and the
+	* include templates of its class and base classes.
+	*/
+	void CollectDependencies( PObjectBase obj, ProjectDependencies* deps );
+
+	/**
+	* Adds the include templates of info and of its base classes, base classes first.
+	*/
+	void CollectClassIncludes( PObjectInfo info, PObjectBase obj, ProjectDependencies* deps );
+
+	/**
+	* Parses the include template of info for obj, in the language of the generator.
+	*/
+	virtual wxString GetIncludeTemplate( PObjectInfo /*info*/, PObjectBase /*obj*/ ) { return wxEmptyString; }
+
+	/**
+	* Adds the declaration and include of the subclass of obj, if it has one.
+	*/
+	virtual void CollectSubclass( PObjectBase /*obj*/, ProjectDependencies* /*deps*/ ) {}
 
 public:
 	/**
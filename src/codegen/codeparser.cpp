@@ -1,15 +1,146 @@
 #include "codeparser.h"
 
-wxString RemoveWhiteSpace(wxString str) {
-	size_t index = 0;
-	while (index < str.Len()) {
-		if (str.GetChar(index) == ' ' || str.GetChar(index) == '\t' || str.GetChar(index) == '\n') {
-			str.Remove(index, 1);
-		} else {
-			index++;
+#include <wx/ffile.h>
+
+namespace {
+/** true for the characters identifiers and number literals are made of */
+bool IsIdentifierChar(wxUniChar c) {
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+/** returns the start of the identifier or number that ends right before pos */
+size_t TokenStart(const wxString& code, size_t pos) {
+	while (pos > 0 && IsIdentifierChar(code[pos - 1])) {
+		pos--;
+	}
+	return pos;
+}
+
+/** returns the end of the comment or literal starting at pos, or pos if there is code at pos.
+ unterminated comments and literals end with the code */
+size_t SkipNonCode(const wxString& code, size_t pos) {
+	const size_t length = code.length();
+	const wxUniChar c = code[pos];
+	const wxUniChar next = (pos + 1 < length ? code[pos + 1] : wxUniChar(0));
+
+	if (c == '/' && next == '/') {
+		size_t end = code.find('\n', pos);
+		return (end == wxString::npos ? length : end);
+	}
+	if (c == '/' && next == '*') {
+		size_t end = code.find(wxT("*/"), pos + 2);
+		return (end == wxString::npos ? length : end + 2);
+	}
+	if (c == '"' && pos > 0 && code[pos - 1] == 'R') {
+		// raw string literal R"delimiter( ... )delimiter", optionally prefixed by L, u, U or u8
+		size_t tokenStart = TokenStart(code, pos);
+		wxString prefix = code.Mid(tokenStart, pos - tokenStart);
+		if (prefix == wxT("R") || prefix == wxT("LR") || prefix == wxT("uR") || prefix == wxT("UR") ||
+		    prefix == wxT("u8R")) {
+			size_t open = code.find('(', pos);
+			if (open != wxString::npos) {
+				wxString terminator = wxT(")") + code.Mid(pos + 1, open - pos - 1) + wxT("\"");
+				size_t end = code.find(terminator, open + 1);
+				return (end == wxString::npos ? length : end + terminator.length());
+			}
+		}
+	}
+	if (c == '"' || c == '\'') {
+		// a quote after a number is a digit separator (1'000), not a character literal
+		if (c == '\'' && pos > 0 && IsIdentifierChar(code[pos - 1])) {
+			wxUniChar first = code[TokenStart(code, pos)];
+			if (first >= '0' && first <= '9') {
+				return pos;
+			}
+		}
+		size_t index = pos + 1;
+		while (index < length) {
+			wxUniChar current = code[index];
+			if (current == '\\') {
+				index += 2;
+			} else if (current == c) {
+				return index + 1;
+			} else if (current == '\n') {
+				// unterminated, don't let it swallow the rest of the file
+				return index;
+			} else {
+				index++;
+			}
 		}
+		return length;
 	}
-	return str;
+	return pos;
+}
+
+/** finds the next occurrence of 'text' in code, skipping comments and literals.
+ with 'wholeWord' the occurrence must not be part of a longer identifier */
+size_t FindCode(const wxString& code, const wxString& text, size_t pos, bool wholeWord) {
+	const size_t length = code.length();
+	const wxUniChar first = text[0];
+	while (pos < length) {
+		size_t skipped = SkipNonCode(code, pos);
+		if (skipped != pos) {
+			pos = skipped;
+			continue;
+		}
+		if (code[pos] == first && code.compare(pos, text.length(), text) == 0 &&
+		    (!wholeWord || ((pos == 0 || !IsIdentifierChar(code[pos - 1])) &&
+		                    (pos + text.length() >= length || !IsIdentifierChar(text.Last()) ||
+		                     !IsIdentifierChar(code[pos + text.length()]))))) {
+			return pos;
+		}
+		pos++;
+	}
+	return wxString::npos;
+}
+
+/** returns the position of the bracket closing the one at 'open', or npos if it is never closed */
+size_t FindClosingBracket(const wxString& code, size_t open) {
+	const size_t length = code.length();
+	int depth = 0;
+	size_t pos = open;
+	while (pos < length) {
+		size_t skipped = SkipNonCode(code, pos);
+		if (skipped != pos) {
+			pos = skipped;
+			continue;
+		}
+		wxUniChar c = code[pos];
+		if (c == '{') {
+			depth++;
+		} else if (c == '}') {
+			depth--;
+			if (depth == 0) {
+				return pos;
+			}
+		}
+		pos++;
+	}
+	return wxString::npos;
+}
+
+/** reads a whole file with unix line endings */
+wxString ReadFile(const wxString& path) {
+	wxString contents;
+	if (!path.empty() && wxFileExists(path)) {
+		wxFFile file(path, wxT("rb"));
+		if (file.IsOpened() && file.ReadAll(&contents, wxConvAuto())) {
+			contents = wxTextBuffer::Translate(contents, wxTextFileType_Unix);
+		}
+	}
+	return contents;
+}
+}  // namespace
+
+wxString RemoveWhiteSpace(const wxString& str) {
+	wxString result;
+	result.reserve(str.length());
+	for (wxString::const_iterator c = str.begin(); c != str.end(); ++c) {
+		if (*c != ' ' && *c != '\t' && *c != '\n') {
+			result << *c;
+		}
+	}
+	return result;
 }
 
 void Function::SetHeading(wxString heading) {
@@ -46,52 +177,19 @@ wxString Function::GetFunction() {
 
 void CCodeParser::ParseCFiles(wxString className) {
 	m_className = className;
-	wxTextFile headerFile(m_hFile);
-	wxTextFile sourceFile(m_cFile);
-
-	wxString header;
-	wxString source;
-
-	// start opening files
-	if (headerFile.Open()) {
-		wxString Str;
-
-		Str = headerFile.GetFirstLine();
-		while (!(headerFile.Eof())) {
-			header << Str;
-			header << wxT('\n');
-			Str = headerFile.GetNextLine();
-		}
-		headerFile.Close();
-	} else {
-		header = wxT("");
-	}
-	if (sourceFile.Open()) {
-		wxString Str;
-
-		source = sourceFile.GetFirstLine();
-		while (!(sourceFile.Eof())) {
-			source << Str;
-			source << wxT('\n');
-			Str = sourceFile.GetNextLine();
-		}
-		sourceFile.Close();
-	} else {
-		source = wxT("");
-	}
 
 	// parse the file contents
-	ParseCCode(header, source);
+	ParseCCode(ReadFile(m_hFile), ReadFile(m_cFile));
 }
 
-void CCodeParser::ParseCCode(wxString header, wxString source) {
+void CCodeParser::ParseCCode(const wxString& header, const wxString& source) {
 	ParseCInclude(header);
 	ParseCClass(header);
 
 	ParseSourceFunctions(source);
 }
 
-void CCodeParser::ParseCInclude(wxString code) {
+void CCodeParser::ParseCInclude(const wxString& code) {
 	int userIncludeEnd;
 	m_userInclude = wxT("");
 
@@ -111,17 +209,18 @@ void CCodeParser::ParseCInclude(wxString code) {
 	}
 }
 
-void CCodeParser::ParseCClass(wxString code) {
-	int startClass = code.Find(wxT("class ") + m_className);
-	if (startClass != wxNOT_FOUND) {
-		code = ParseBrackets(code, startClass);
-		if (startClass != wxNOT_FOUND) {
-			ParseCUserMembers(code);
+void CCodeParser::ParseCClass(const wxString& code) {
+	size_t startClass = FindCode(code, wxT("class ") + m_className, 0, true);
+	if (startClass != wxString::npos) {
+		int start = startClass;
+		wxString body = ParseBrackets(code, start);
+		if (start != wxNOT_FOUND) {
+			ParseCUserMembers(body);
 		}
 	}
 }
 
-void CCodeParser::ParseCUserMembers(wxString code) {
+void CCodeParser::ParseCUserMembers(const wxString& code) {
 	m_userMemebers = wxT("");
 	int userMembersStart = code.Find(wxT("//// end generated class members"));
 	if (userMembersStart != wxNOT_FOUND) {
@@ -137,102 +236,87 @@ void CCodeParser::ParseCUserMembers(wxString code) {
 	}
 }
 
-void CCodeParser::ParseSourceFunctions(wxString code) {
-	int functionStart = 0;
-	int functionEnd = 0;
-	int previousFunctionEnd = 0;
-	wxString funcName, funcArg;
-	Function* func;
-	wxString Str, R;
+void CCodeParser::ParseSourceFunctions(const wxString& code) {
+	const wxString scope = m_className + wxT("::");
+	size_t previousFunctionEnd = 0;
 
-	int loop = 0;
 	while (1) {
 		// find the begining of the function name
-		Str = m_className + wxT("::");
-		functionStart = code.find(Str, previousFunctionEnd);
-		if (functionStart == wxNOT_FOUND) {
-			// Get the last bit of remaining code after the last function in the file
-			m_trailingCode = code.Mid(previousFunctionEnd);
-			m_trailingCode.RemoveLast();
-			return;
+		size_t nameStart = FindCode(code, scope, previousFunctionEnd, true);
+		if (nameStart == wxString::npos) {
+			break;
 		}
-		// found a function now creat a new function class
-		func = new Function();
 
 		// find the begining of the line on which the function name resides
-		functionStart = code.rfind('\n', functionStart);
-		func->SetDocumentation(code.Mid(previousFunctionEnd, functionStart - previousFunctionEnd));
-		functionStart++;
+		size_t documentationEnd = code.rfind('\n', nameStart);
+		if (documentationEnd == wxString::npos || documentationEnd < previousFunctionEnd) {
+			documentationEnd = previousFunctionEnd;
+		}
+		size_t functionStart =
+		    (documentationEnd < nameStart && code[documentationEnd] == '\n' ? documentationEnd + 1 : documentationEnd);
+
+		// find the opening bracket of the function
+		size_t bodyStart = FindCode(code, wxT("{"), nameStart, false);
+		if (bodyStart == wxString::npos) {
+			break;
+		}
 
-		functionEnd = code.find('{', functionStart);
-		wxString heading = code.Mid(functionStart, functionEnd - functionStart);
+		// found a function now creat a new function class
+		Function* func = new Function();
+		func->SetDocumentation(code.Mid(previousFunctionEnd, documentationEnd - previousFunctionEnd));
+
+		wxString heading = code.Mid(functionStart, bodyStart - functionStart);
 		if (heading.Right(1) == '\n') {
 			heading.RemoveLast();
 		}
 		func->SetHeading(heading);
 
-		m_functions[RemoveWhiteSpace(heading)] = func;
+		wxString key = RemoveWhiteSpace(heading);
+		funcIterator existing = m_functions.find(key);
+		if (existing != m_functions.end()) {
+			delete existing->second;
+		}
+		m_functions[key] = func;
 
-		// find the opening brackets of the function
-		func->SetContents(ParseBrackets(code, functionStart));
-		if (functionStart != wxNOT_FOUND) {
-			functionEnd = functionStart;
-		} else {
+		size_t bodyEnd = FindClosingBracket(code, bodyStart);
+		if (bodyEnd == wxString::npos) {
 			wxMessageBox(wxT("Brackets Missing in Source File!"));
-			code.insert(functionEnd + 1,
-			            wxT("//The Following Block is missing a closing bracket\n//and has been "
-			                "set aside by wxFormbuilder\n"));
 			func->SetContents(wxT(""));
-		}
 
-		previousFunctionEnd = functionEnd;
-		if (loop == 100) {
+			// the rest of the file can't be split into functions, keep it as it is
+			m_trailingCode = wxT("//The Following Block is missing a closing bracket\n//and has been "
+			                     "set aside by wxFormbuilder\n") +
+			                 code.Mid(bodyStart + 1);
 			return;
 		}
-		loop++;
+
+		func->SetContents(code.Mid(bodyStart + 1, bodyEnd - bodyStart - 1));
+		previousFunctionEnd = bodyEnd + 1;
 	}
-}
 
-wxString CCodeParser::ParseBrackets(wxString code, int& functionStart) {
-	int openingBrackets = 0;
-	int closingBrackets = 0;
-	int index = 0;
-	wxString Str;
+	// Get the last bit of remaining code after the last function in the file
+	m_trailingCode = code.Mid(previousFunctionEnd);
+	if (m_trailingCode.Right(1) == '\n') {
+		m_trailingCode.RemoveLast();
+	}
+}
 
-	int functionLength = 0;
-	index = code.find('{', functionStart);
-	if (index != wxNOT_FOUND) {
-		openingBrackets++;
-		index++;
-		functionStart = index;
-		int loop = 0;
-		while (openingBrackets > closingBrackets) {
-			index = code.find_first_of(wxT("{}"), index);
-			if (index == wxNOT_FOUND) {
-				Str = code.Mid(functionStart, index);
-				functionStart = index;
-				return Str;
-			}
-			if (code.GetChar(index) == '{') {
-				index++;
-				openingBrackets++;
-			} else {
-				index++;
-				closingBrackets++;
-			}
-			if (loop == 100) {
-				return wxT("");
-			}
-			loop++;
-		}
-		index--;
-		functionLength = index - functionStart;
-	} else {
+wxString CCodeParser::ParseBrackets(const wxString& code, int& functionStart) {
+	size_t open = FindCode(code, wxT("{"), functionStart, false);
+	if (open == wxString::npos) {
 		wxMessageBox(wxT("no brackets found"));
+		functionStart = wxNOT_FOUND;
+		return wxT("");
 	}
-	Str = code.Mid(functionStart, functionLength);
-	functionStart = functionStart + functionLength + 1;
-	return Str;
+
+	size_t close = FindClosingBracket(code, open);
+	if (close == wxString::npos) {
+		functionStart = wxNOT_FOUND;
+		return code.Mid(open + 1);
+	}
+
+	functionStart = close + 1;
+	return code.Mid(open + 1, close - open - 1);
 }
 
 wxString CodeParser::GetFunctionDocumentation(wxString function) {
@@ -5,7 +5,7 @@
 #include <wx/textfile.h>
 #include <wx/msgdlg.h>
 
-wxString RemoveWhiteSpace(wxString str);
+wxString RemoveWhiteSpace(const wxString& str);
 
 /** Stores all of the information for all of the parsed funtions */
 class Function {
@@ -134,19 +134,23 @@ public:
 
 	/** extracts the contents of the files.  take the the entire contents of both files in string
 	 * form */
-	void ParseCCode(wxString header, wxString source);
+	void ParseCCode(const wxString& header, const wxString& source);
 
 	/** extracts all user header include code before the class declaration */
-	void ParseCInclude(wxString code);
+	void ParseCInclude(const wxString& code);
 
 	/** extracts the contents of the generated class declaration */
-	void ParseCClass(wxString code);
+	void ParseCClass(const wxString& code);
 
-	void ParseSourceFunctions(wxString code);
+	/** splits the source into the functions of the class in a single pass, brackets inside
+	 * comments, string, character and raw string literals are ignored */
+	void ParseSourceFunctions(const wxString& code);
 
-	wxString ParseBrackets(wxString code, int& functionStart);
+	/** returns the code between the first bracket after 'functionStart' and its closing one,
+	 * 'functionStart' is moved past the closing bracket or set to wxNOT_FOUND */
+	wxString ParseBrackets(const wxString& code, int& functionStart);
 
-	void ParseCUserMembers(wxString code);
+	void ParseCUserMembers(const wxString& code);
 
 	/***************/
 };
@@ -29,16 +29,27 @@
 #include "../md5/md5.hh"
 #include "../utils/typeconv.h"
 #include "../utils/wxfbexception.h"
+#include "manifest.h"
 
 #include <wx/file.h>
-#include <wx/tokenzr.h>
-#include <wx/regex.h>
 
 #include <wx/stc/stc.h>
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 
+namespace
+{
+	// Same set of characters as wxString::Trim()
+	inline bool IsTrimmed( wxUniChar c )
+	{
+		return c == wxT(' ') || c == wxT('\t') || c == wxT('\r') || c == wxT('\n') || c == wxT('\v') || c == wxT('\f');
+	}
+
+	const wxString TAB_MARKER = wxT("%TAB%");
+}
+
 CodeWriter::CodeWriter()
 :
 m_indent( 0 ),
@@ -71,75 +82,127 @@ void CodeWriter::Unindent()
 	}
 }
 
-void CodeWriter::WriteLn( wxString code, bool keepIndents )
+const wxString& CodeWriter::GetIndentPrefix( int level )
 {
-	// It will not be allowed newlines (carry return) inside "code"
-	// If there was anyone, then FixWrite gets the string and breaks it
-	// in different lines, inserting them one after another using WriteLn
-	if ( !StringOk( code ) )
+	if ( m_indentPrefixes.empty() )
 	{
-		FixWrite( code, keepIndents);
+		m_indentPrefixes.push_back( wxEmptyString );
 	}
-	else
-	{
-		if(keepIndents)
-		{
-			m_cols = m_indent;
-		}
 
-		code.Trim();
-		Write( code );
-		Write(wxT("\n"));
-		m_cols = 0;
+	while ( m_indentPrefixes.size() <= static_cast< size_t >( level ) )
+	{
+		m_indentPrefixes.push_back( m_indentPrefixes.back() + ( m_indent_with_spaces ? wxT("    ") : wxT("\t") ) );
 	}
+
+	return m_indentPrefixes[ level ];
 }
 
-bool CodeWriter::StringOk( wxString s )
+void CodeWriter::WriteLn( const wxString& code, bool keepIndents )
 {
-	return ( s.find( wxT("\n"), 0 ) == wxString::npos );
+	// It will not be allowed newlines (carry return) inside "code"
+	// If there was anyone, it is broken in different lines, that are written one after another
+	wxString::const_iterator lineStart = code.begin();
+	for ( wxString::const_iterator c = code.begin(); c != code.end(); ++c )
+	{
+		if ( *c == wxT('\n') )
+		{
+			WriteLine( lineStart, c, keepIndents, true );
+			lineStart = c + 1;
+		}
+	}
+
+	// The remainder is the whole string if there was no newline, otherwise the (possibly empty) last line
+	WriteLine( lineStart, code.end(), keepIndents, lineStart != code.begin() );
 }
 
-void CodeWriter::FixWrite( wxString s , bool keepIndents)
+void CodeWriter::WriteLine( wxString::const_iterator first, wxString::const_iterator last, bool keepIndents, bool fromTemplate )
 {
-	wxRegEx reIndent( wxT("%TAB%\\s*"), wxRE_ADVANCED );
-	wxStringTokenizer tkz( s, wxT("\n"), wxTOKEN_RET_EMPTY_ALL );
+	while ( last != first && IsTrimmed( *( last - 1 ) ) )
+	{
+		--last;
+	}
 
-	while ( tkz.HasMoreTokens() )
+	if ( fromTemplate && !keepIndents )
 	{
-		wxString line = tkz.GetNextToken();
-		if(!keepIndents)
+		while ( first != last && IsTrimmed( *first ) )
 		{
-			line.Trim( false );
+			++first;
 		}
-		line.Trim( true );
+	}
+
+	if ( keepIndents )
+	{
+		m_cols = m_indent;
+	}
+
+	wxString expanded;
+	if ( fromTemplate && std::search( first, last, TAB_MARKER.begin(), TAB_MARKER.end() ) != last )
+	{
 		// replace indentations defined in code templates by #indent and #unindent macros...
-		reIndent.Replace( &line, wxT("\t") );
-		WriteLn( line, keepIndents );
+		wxString line( first, last );
+		expanded.reserve( line.length() );
+
+		size_t pos = 0;
+		size_t marker;
+		while ( ( marker = line.find( TAB_MARKER, pos ) ) != wxString::npos )
+		{
+			expanded.append( line, pos, marker - pos );
+			expanded += wxT('\t');
+
+			pos = marker + TAB_MARKER.length();
+			while ( pos < line.length() && IsTrimmed( line[pos] ) )
+			{
+				++pos;
+			}
+		}
+		expanded.append( line, pos, wxString::npos );
+		expanded.Trim();
 
+		first = expanded.begin();
+		last = expanded.end();
 	}
+
+	WriteRange( first, last );
+	DoWrite( wxT("\n") );
+	m_cols = 0;
+}
+
+void CodeWriter::Write( const wxString& code )
+{
+	WriteRange( code.begin(), code.end() );
 }
 
-void CodeWriter::Write( wxString code )
+void CodeWriter::WriteRange( wxString::const_iterator first, wxString::const_iterator last )
 {
 	if ( m_cols == 0 )
 	{
 		// Inserting indents
-		for ( int i = 0; i < m_indent; i++ )
+		if ( first != last && m_indent > 0 )
 		{
-			if (!code.IsEmpty()) {
-				DoWrite(m_indent_with_spaces ? wxT("    ") : wxT("\t"));
-			}
+			DoWrite( GetIndentPrefix( m_indent ) );
 		}
 
 		m_cols = m_indent;
 	}
 
-	DoWrite( code );
+	if ( first != last )
+	{
+		DoWrite( first, last );
+	}
+}
+
+void CodeWriter::DoWrite( wxString::const_iterator first, wxString::const_iterator last )
+{
+	DoWrite( wxString( first, last ) );
 }
 
 void CodeWriter::SetIndentWithSpaces( bool on )
 {
-	m_indent_with_spaces = on;
+	if ( on != m_indent_with_spaces )
+	{
+		m_indent_with_spaces = on;
+		m_indentPrefixes.clear();
+	}
 }
 
 TCCodeWriter::TCCodeWriter()
@@ -158,7 +221,7 @@ void TCCodeWriter::SetTextCtrl( wxStyledTextCtrl* tc )
 	m_tc = tc;
 }
 
-void TCCodeWriter::DoWrite( wxString code )
+void TCCodeWriter::DoWrite( const wxString& code )
 {
 	if ( m_tc )
 		m_tc->AddText( code );
@@ -174,17 +237,22 @@ StringCodeWriter::StringCodeWriter()
 {
 }
 
-void StringCodeWriter::DoWrite( wxString code )
+void StringCodeWriter::DoWrite( const wxString& code )
 {
 	m_buffer += code;
 }
 
+void StringCodeWriter::DoWrite( wxString::const_iterator first, wxString::const_iterator last )
+{
+	m_buffer.append( first, last );
+}
+
 void StringCodeWriter::Clear()
 {
 	m_buffer.clear();
 }
 
-wxString StringCodeWriter::GetString()
+const wxString& StringCodeWriter::GetString() const
 {
 	return m_buffer;
 }
@@ -207,6 +275,8 @@ void FileCodeWriter::WriteBuffer()
 {
 	const static unsigned char MICROSOFT_BOM[3] = { 0xEF, 0xBB, 0xBF };
 
+	GenerationManifest::AddOutput( m_filename );
+
 	// Compare buffer with existing file (if any) to determine if
 	// writing the file is necessary
 	bool shouldWrite = true;
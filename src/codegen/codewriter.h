@@ -28,6 +28,8 @@
 
 #include <wx/string.h>
 
+#include <vector>
+
 /** Abstracts the code generation from the target.
 Because, in some cases the target is a file, sometimes a TextCtrl, and sometimes both.
 */
@@ -39,21 +41,29 @@ private:
 	int m_cols;
 	bool m_indent_with_spaces;
 
+	// Indentation strings, the n-th entry holds n levels
+	std::vector< wxString > m_indentPrefixes;
+
+	const wxString& GetIndentPrefix( int level );
+
+	/// Writes the range [first, last) of a line, taking indent into account.
+	void WriteRange( wxString::const_iterator first, wxString::const_iterator last );
+
+	/** Writes one line of a (possibly multi-line) string, trimmed, with the %TAB% markers
+	left by the #indent and #unindent template macros replaced by tabs.
+	*/
+	void WriteLine( wxString::const_iterator first, wxString::const_iterator last, bool keepIndents, bool fromTemplate );
+
 protected:
 	/// Write a wxString.
-	virtual void DoWrite( wxString code ) = 0;
+	virtual void DoWrite( const wxString& code ) = 0;
+
+	/// Write a part of a wxString, writers that can append ranges directly should override this.
+	virtual void DoWrite( wxString::const_iterator first, wxString::const_iterator last );
 
 	/// Returns the size of the indentation - was useful when using spaces, now it is 1 because using tabs.
 	virtual int GetIndentSize();
 
-	/// Verifies that the wxString does not contain carraige return characters.
-	bool StringOk( wxString s );
-
-	/** Divides a badly formed string (including carriage returns) in simple
-	columns, inserting them one after another and taking indent into account.
-	*/
-	void FixWrite( wxString s, bool keepIndents = false);
-
 public:
 	/// Constructor.
 	CodeWriter();
@@ -67,11 +77,13 @@ public:
 	/// Decrement the indent.
 	void Unindent();
 
-	/// Write a line of code.
-	void WriteLn( wxString code = wxEmptyString, bool keepIndents = false );
+	/** Write a line of code.
+	Strings containing carriage returns are divided in simple lines, each of them is written taking indent into account.
+	*/
+	void WriteLn( const wxString& code = wxEmptyString, bool keepIndents = false );
 
 	/// Writes a text string into the code.
-	void Write( wxString code );
+	void Write( const wxString& code );
 
 	// Sets the option to indent with spaces
 	void SetIndentWithSpaces( bool on );
@@ -88,7 +100,8 @@ private:
 	wxStyledTextCtrl* m_tc;
 
 protected:
-	void DoWrite(wxString code) override;
+	using CodeWriter::DoWrite;
+	void DoWrite( const wxString& code ) override;
 
 public:
 	TCCodeWriter();
@@ -101,12 +114,13 @@ class StringCodeWriter : public CodeWriter
 {
 protected:
 	wxString m_buffer;
-	void DoWrite(wxString code) override;
+	void DoWrite( const wxString& code ) override;
+	void DoWrite( wxString::const_iterator first, wxString::const_iterator last ) override;
 
 public:
 	StringCodeWriter();
 	void Clear() override;
-	wxString GetString();
+	const wxString& GetString() const;
 };
 
 class FileCodeWriter : public StringCodeWriter
@@ -28,9 +28,11 @@
 #include "../model/objectbase.h"
 #include "../rad/appdata.h"
 #include "../utils/filetocarray.h"
+#include "../utils/profiler.h"
 #include "../utils/typeconv.h"
 #include "../utils/wxfbexception.h"
 #include "codewriter.h"
+#include "projectanalysis.h"
 
 #include <algorithm>
 
@@ -349,6 +351,7 @@ CppCodeGenerator::CppCodeGenerator()
 	m_useRelativePath = false;
 	m_i18n = false;
 	m_firstID = 1000;
+	m_writeEmbeddedFiles = true;
 }
 
 wxString CppCodeGenerator::ConvertCppString( wxString text )
@@ -472,8 +475,8 @@ void CppCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	m_source->WriteLn( wxT("}") );
 
 	// Do events in both files
-	EventVector events;
-	FindEventHandlers( form, events );
+	ProjectAnalysis::Form formAnalysis( form );
+	const EventVector& events = formAnalysis.GetEvents();
 
 	if ( events.size() > 0 )
 	{
@@ -563,12 +566,20 @@ void CppCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 
 bool CppCodeGenerator::GenerateCode( PObjectBase project )
 {
+	ProfileScope profile( wxT("CppCodeGenerator::GenerateCode") );
+
 	if ( !project )
 	{
 		wxLogError( wxT( "There is no project to generate code" ) );
 		return false;
 	}
 
+	// Walk the project once for everything the generation phases need
+	m_analysis = ProjectAnalysis::Get( project );
+
+	// Convert repeated property values to code only once
+	ValueCodeCache::Scope valueCache;
+
 	bool useEnum = false;
 
 	PProperty useEnumProperty = project->GetProperty( wxT( "use_enum" ) );
@@ -618,31 +629,25 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 		m_header->WriteLn( code );
 	}
 
-	// Generate the subclass sets
-	std::set< wxString > subclasses;
-	std::set< wxString > subclassSourceIncludes;
-	std::vector< wxString > headerIncludes;
-
-	GenSubclassSets( project, &subclasses, &subclassSourceIncludes, &headerIncludes );
+	// Generate the subclass sets and the includes from components dependencies
+	ProjectDependencies deps( wxT( "#include" ), true, true );
+	CollectDependencies( project, &deps );
 
 	// Write the forward declaration lines
 	std::set< wxString >::iterator subclass_it;
-	for ( subclass_it = subclasses.begin(); subclass_it != subclasses.end(); ++subclass_it )
+	for ( subclass_it = deps.subclasses.begin(); subclass_it != deps.subclasses.end(); ++subclass_it )
 	{
 		m_header->WriteLn( *subclass_it );
 	}
-	if ( !subclasses.empty() )
+	if ( !deps.subclasses.empty() )
 	{
 		m_header->WriteLn( wxT( "" ) );
 	}
 
-	// Generating in the .h header file those include from components dependencies.
-	std::set< wxString > templates;
-	GenIncludes( project, &headerIncludes, &templates );
-
 	// Write the include lines
-	std::vector<wxString>::iterator include_it;
-	for ( include_it = headerIncludes.begin(); include_it != headerIncludes.end(); ++include_it )
+	UniqueLines headerIncludes = deps.GetIncludes();
+	std::vector<wxString>::const_iterator include_it;
+	for ( include_it = headerIncludes.GetLines().begin(); include_it != headerIncludes.GetLines().end(); ++include_it )
 	{
 		m_header->WriteLn( *include_it );
 	}
@@ -682,8 +687,7 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 			if ( !headerVal.empty() )
 			{
 				wxString include = wxT( "#include \"" ) + headerVal + wxT( "\"" );
-				std::vector< wxString >::iterator findInclude = std::find( headerIncludes.begin(), headerIncludes.end(), include );
-				if ( findInclude == headerIncludes.end() )
+				if ( !headerIncludes.Contains( include ) )
 				{
 					m_header->WriteLn( include );
 					m_header->WriteLn( wxEmptyString );
@@ -706,11 +710,11 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 	}
 
 	// Write include lines for subclasses
-	for ( subclass_it = subclassSourceIncludes.begin(); subclass_it != subclassSourceIncludes.end(); ++subclass_it )
+	for ( subclass_it = deps.sourceIncludes.begin(); subclass_it != deps.sourceIncludes.end(); ++subclass_it )
 	{
 		m_source->WriteLn( *subclass_it );
 	}
-	if ( !subclassSourceIncludes.empty() )
+	if ( !deps.sourceIncludes.empty() )
 	{
 		m_source->WriteLn( wxEmptyString );
 	}
@@ -765,8 +769,7 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 	{
 		PObjectBase child = project->GetChild( i );
 
-		EventVector events;
-		FindEventHandlers( child, events );
+		const EventVector& events = m_analysis->GetForm( child ).GetEvents();
 		GenClassDeclaration( child, useEnum, classDecoration, events );
 		if ( !m_useConnect )
 		{
@@ -959,41 +962,34 @@ void CppCodeGenerator::GenVirtualEventHandlers( const EventVector& events, const
 	}
 }
 
-void CppCodeGenerator::GenAttributeDeclaration( PObjectBase obj, Permission perm )
+void CppCodeGenerator::GenAttributeDeclaration( const ObjectBaseVector& objects, Permission perm )
 {
-	wxString typeName = obj->GetObjectTypeName();
-	if ( ObjectDatabase::HasCppProperties( typeName ) )
+	for ( ObjectBaseVector::const_iterator it = objects.begin(); it != objects.end(); ++it )
 	{
-		wxString perm_str = obj->GetProperty( wxT( "permission" ) )->GetValue();
-
-		if ( ( perm == P_PUBLIC && perm_str == wxT( "public" ) ) ||
-				( perm == P_PROTECTED && perm_str == wxT( "protected" ) ) ||
-				( perm == P_PRIVATE && perm_str == wxT( "private" ) ) )
+		PObjectBase obj = *it;
+		wxString typeName = obj->GetObjectTypeName();
+		if ( ObjectDatabase::HasCppProperties( typeName ) )
 		{
-			// Generate the declaration
-			wxString code = GetCode( obj, wxT( "declaration" ) );
-			if ( !code.empty() )
-				m_header->WriteLn( code );
-		}
-	}
-
-	// Generate recursively the rest of the attributes
-	for ( unsigned int i = 0; i < obj->GetChildCount() ; i++ )
-	{
-		PObjectBase child = obj->GetChild( i );
+			wxString perm_str = obj->GetProperty( wxT( "permission" ) )->GetValue();
 
-		GenAttributeDeclaration( child, perm );
+			if ( ( perm == P_PUBLIC && perm_str == wxT( "public" ) ) ||
+					( perm == P_PROTECTED && perm_str == wxT( "protected" ) ) ||
+					( perm == P_PRIVATE && perm_str == wxT( "private" ) ) )
+			{
+				// Generate the declaration
+				wxString code = GetCode( obj, wxT( "declaration" ) );
+				if ( !code.empty() )
+					m_header->WriteLn( code );
+			}
+		}
 	}
 }
-void CppCodeGenerator::GenValidatorVariables( PObjectBase obj )
-{
-	GenValVarsBase( obj->GetObjectInfo(), obj );
 
-	// Proceeding recursively with the children
-	for ( unsigned int i = 0; i < obj->GetChildCount() ; i++ )
+void CppCodeGenerator::GenValidatorVariables( const ObjectBaseVector& objects )
+{
+	for ( ObjectBaseVector::const_iterator it = objects.begin(); it != objects.end(); ++it )
 	{
-		PObjectBase child = obj->GetChild( i );
-		GenValidatorVariables( child );
+		GenValVarsBase( ( *it )->GetObjectInfo(), *it );
 	}
 }
 
@@ -1027,15 +1023,11 @@ void CppCodeGenerator::GenValVarsBase( PObjectInfo info, PObjectBase obj )
 	}
 }
 
-void CppCodeGenerator::GetGenEventHandlers( PObjectBase obj )
+void CppCodeGenerator::GetGenEventHandlers( const ObjectBaseVector& objects )
 {
-	GenDefinedEventHandlers( obj->GetObjectInfo(), obj );
-
-	// Process child widgets
-	for ( unsigned int i = 0; i < obj->GetChildCount() ; i++ )
+	for ( ObjectBaseVector::const_iterator it = objects.begin(); it != objects.end(); ++it )
 	{
-		PObjectBase child = obj->GetChild( i );
-		GetGenEventHandlers( child );
+		GenDefinedEventHandlers( ( *it )->GetObjectInfo(), *it );
 	}
 }
 
@@ -1067,6 +1059,14 @@ void CppCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase ob
 
 wxString CppCodeGenerator::GetCode( PObjectBase obj, wxString name )
 {
+	// Expanded once per template while the project is not modified, e.g. across the code panels' updates
+	const wxString key = wxString::Format( wxT("C++\n%s\n%d\n%d\n%s"), name, ( m_i18n ? 1 : 0 ), ( m_useRelativePath ? 1 : 0 ), m_basePath );
+	const wxString* cached = FindCachedCode( obj, key );
+	if ( cached )
+	{
+		return *cached;
+	}
+
 	wxString _template;
 	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
 
@@ -1089,6 +1089,7 @@ wxString CppCodeGenerator::GetCode( PObjectBase obj, wxString name )
 
 	CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
 	wxString code = parser.ParseTemplate();
+	CacheCode( obj, key, code );
 
 	return code;
 }
@@ -1114,6 +1115,8 @@ void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum
 	m_header->WriteLn( wxT( "/// Class " ) + class_name );
 	m_header->WriteLn( wxT( "///////////////////////////////////////////////////////////////////////////////" ) );
 
+	const ObjectBaseVector& objects = m_analysis->GetForm( class_obj ).GetObjects();
+
 	m_header->WriteLn( wxT( "class " ) + classDecoration + class_name + wxT( " : " ) + GetCode( class_obj, wxT( "base" ) ) );
 	m_header->WriteLn( wxT( "{" ) );
 	m_header->Indent();
@@ -1127,7 +1130,7 @@ void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum
 	// private
 	m_header->WriteLn( wxT( "private:" ) );
 	m_header->Indent();
-	GenAttributeDeclaration( class_obj, P_PRIVATE );
+	GenAttributeDeclaration( objects, P_PRIVATE );
 
 	if ( !m_useConnect )
 	{
@@ -1144,7 +1147,7 @@ void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum
 	if ( use_enum )
 		GenEnumIds( class_obj );
 
-	GenAttributeDeclaration( class_obj, P_PROTECTED );
+	GenAttributeDeclaration( objects, P_PROTECTED );
 
 	wxString eventHandlerKind;
 	wxString eventHandlerPrefix;
@@ -1180,10 +1183,10 @@ void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum
 	// public
 	m_header->WriteLn( wxT( "public:" ) );
 	m_header->Indent();
-	GenAttributeDeclaration( class_obj, P_PUBLIC );
+	GenAttributeDeclaration( objects, P_PUBLIC );
 
 	// Validators' variables
-	GenValidatorVariables( class_obj );
+	GenValidatorVariables( objects );
 	m_header->WriteLn( wxT( "" ) );
 
 	// The constructor is also included within public
@@ -1192,7 +1195,7 @@ void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum
 	// Destructor
 	m_header->WriteLn( wxString::Format( wxT( "~%s();" ), class_name.c_str() ) );
 
-	GetGenEventHandlers( class_obj );
+	GetGenEventHandlers( objects );
 	m_header->Unindent();
 	m_header->WriteLn( wxT( "" ) );
 
@@ -1203,8 +1206,7 @@ void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum
 
 void CppCodeGenerator::GenEnumIds( PObjectBase class_obj )
 {
-	std::vector< wxString > macros;
-	FindMacros( class_obj, &macros );
+	std::vector< wxString > macros = FilterMacros( m_analysis->GetForm( class_obj ).GetMacros() );
 
 	std::vector< wxString >::iterator it = macros.begin();
 	if ( it != macros.end() )
@@ -1246,14 +1248,8 @@ void CppCodeGenerator::GenEnumIds( PObjectBase class_obj )
 	}
 }
 
-void CppCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::set< wxString >* sourceIncludes, std::vector< wxString >* headerIncludes )
+void CppCodeGenerator::CollectSubclass( PObjectBase obj, ProjectDependencies* deps )
 {
-	// Call GenSubclassForwardDeclarations on all children as well
-	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
-	{
-		GenSubclassSets( obj->GetChild( i ), subclasses, sourceIncludes, headerIncludes );
-	}
-
 	// Fill the set
 	PProperty subclass = obj->GetProperty( wxT( "subclass" ) );
 	if ( subclass )
@@ -1357,140 +1353,26 @@ void CppCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 			 obj->GetChild( 1, wxT("menu") ) ||
 			 !forward_declare )
 		{
-			std::vector< wxString >::iterator it = std::find( headerIncludes->begin(), headerIncludes->end(), include );
-			if ( headerIncludes->end() == it )
-			{
-				headerIncludes->push_back( include );
-			}
+			deps->subclassIncludes.AddUnique( include );
 		}
 		else
 		{
-			subclasses->insert( forwardDecl );
-			sourceIncludes->insert( include );
+			deps->subclasses.insert( forwardDecl );
+			deps->sourceIncludes.insert( include );
 		}
 	}
 }
 
-void CppCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>* includes, std::set< wxString >* templates )
+wxString CppCodeGenerator::GetIncludeTemplate( PObjectInfo info, PObjectBase obj )
 {
-	GenObjectIncludes( project, includes, templates );
-}
-
-void CppCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
-{
-	// Call GenIncludes on all children as well
-	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
-	{
-		GenObjectIncludes( project->GetChild( i ), includes, templates );
-	}
-
-	// Fill the set
-	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
-	if ( code_info )
-	{
-		CppTemplateParser parser( project, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath );
-		wxString include = parser.ParseTemplate();
-		if ( !include.empty() )
-		{
-			if ( templates->insert( include ).second )
-			{
-				AddUniqueIncludes( include, includes );
-			}
-		}
-	}
-
-	// Generate includes for base classes
-	GenBaseIncludes( project->GetObjectInfo(), project, includes, templates );
-}
-
-void CppCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates )
-{
-	if ( !info )
-	{
-		return;
-	}
-
-	// Process all the base classes recursively
-	for ( unsigned int i = 0; i < info->GetBaseClassCount(false); i++ )
-	{
-		PObjectInfo base_info = info->GetBaseClass( i, false );
-		GenBaseIncludes( base_info, obj, includes, templates );
-	}
-
 	PCodeInfo code_info = info->GetCodeInfo( wxT( "C++" ) );
-	if ( code_info )
-	{
-		CppTemplateParser parser( obj, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath );
-		wxString include = parser.ParseTemplate();
-		if ( !include.empty() )
-		{
-			if ( templates->insert( include ).second )
-			{
-				AddUniqueIncludes( include, includes );
-			}
-		}
-	}
-}
-
-void CppCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes )
-{
-	// Split on newlines to only generate unique include lines
-	// This strips blank lines and trims
-	wxStringTokenizer tkz( include, wxT( "\n" ), wxTOKEN_STRTOK );
-
-	bool inPreproc = false;
-
-	while ( tkz.HasMoreTokens() )
+	if ( !code_info )
 	{
-		wxString line = tkz.GetNextToken();
-		line.Trim( false );
-		line.Trim( true );
-
-		// Anything within a #if preprocessor block will be written
-		if ( line.StartsWith( wxT( "#if" ) ) )
-		{
-			inPreproc = true;
-		}
-		else if ( line.StartsWith( wxT( "#endif" ) ) )
-		{
-			inPreproc = false;
-		}
-
-		if ( inPreproc )
-		{
-			includes->push_back( line );
-			continue;
-		}
-
-		// If it is not an include line, it will be written
-		if ( !line.StartsWith( wxT( "#include" ) ) )
-		{
-			includes->push_back( line );
-			continue;
-		}
-
-		// If it is an include, it must be unique to be written
-		std::vector< wxString >::iterator it = std::find( includes->begin(), includes->end(), line );
-		if ( includes->end() == it )
-		{
-			includes->push_back( line );
-		}
+		return wxEmptyString;
 	}
-}
 
-void CppCodeGenerator::FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set )
-{
-	unsigned int ch_count = obj->GetChildCount();
-	if ( ch_count > 0 )
-	{
-		unsigned int i;
-		for ( i = 0; i < ch_count; i++ )
-		{
-			PObjectBase child = obj->GetChild( i );
-			info_set.insert( child->GetObjectInfo() );
-			FindDependencies( child, info_set );
-		}
-	}
+	CppTemplateParser parser( obj, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath );
+	return parser.ParseTemplate();
 }
 
 void CppCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector &events )
@@ -1506,9 +1388,11 @@ void CppCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector
 		m_source->WriteLn( settings );
 	}
 
-	for ( unsigned int i = 0; i < class_obj->GetChildCount(); i++ )
+	const std::vector< ConstructionNode >& construction = m_analysis->GetForm( class_obj ).GetConstruction();
+	std::vector< ConstructionNode >::const_iterator node;
+	for ( node = construction.begin(); node != construction.end(); ++node )
 	{
-		GenConstruction( class_obj->GetChild( i ), true );
+		GenConstruction( *node );
 	}
 
 	wxString afterAddChild = GetCode( class_obj, wxT( "after_addchild" ) );
@@ -1554,18 +1438,18 @@ void CppCodeGenerator::GenDestructor( PObjectBase class_obj, const EventVector &
 	}
 
 	// destruct objects
-	GenDestruction( class_obj );
+	GenDestruction( m_analysis->GetForm( class_obj ).GetObjects() );
 
 	m_source->Unindent();
 	m_source->WriteLn( wxT( "}" ) );
 }
 
-void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
+void CppCodeGenerator::GenConstruction( const ConstructionNode& node )
 {
-	wxString type = obj->GetObjectTypeName();
-	PObjectInfo info = obj->GetObjectInfo();
+	PObjectBase obj = node.object;
+	const wxString& type = node.type;
 
-	if ( ObjectDatabase::HasCppProperties( type ) )
+	if ( ConstructionNode::NODE_OBJECT == node.kind )
 	{
 		// Checking if it has not been declared as class attribute
 		// so that, we will declare it inside the constructor
@@ -1584,20 +1468,18 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 
 		GenSettings( obj->GetObjectInfo(), obj );
 
-		bool isWidget = !info->IsSubclassOf( wxT( "sizer" ) );
-
-		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		std::vector< ConstructionNode >::const_iterator child;
+		for ( child = node.children.begin(); child != node.children.end(); ++child )
 		{
-			PObjectBase child = obj->GetChild( i );
-			GenConstruction( child, isWidget );
+			GenConstruction( *child );
 
 			if ( type == wxT( "toolbar" ) )
 			{
-				GenAddToolbar( child->GetObjectInfo(), child );
+				GenAddToolbar( child->object->GetObjectInfo(), child->object );
 			}
 		}
 
-		if ( !isWidget ) // sizers
+		if ( node.isSizer )
 		{
 			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
 			if ( !afterAddChild.empty() )
@@ -1606,7 +1488,7 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 			}
 			m_source->WriteLn();
 
-			if ( is_widget )
+			if ( node.parentIsWidget )
 			{
 				// the parent object is not a sizer. There is no template for
 				// this so we'll make it manually.
@@ -1694,53 +1576,27 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 			m_source->WriteLn();
 		}
 	}
-	else if ( info->IsSubclassOf( wxT( "sizeritembase" ) ) )
+	else if ( ConstructionNode::NODE_SIZERITEM == node.kind )
 	{
-		// The child must be added to the sizer having in mind the
-		// child object type (there are 3 different routines)
-		GenConstruction( obj->GetChild( 0 ), false );
+		GenConstruction( node.children[0] );
 
-		PObjectInfo childInfo = obj->GetChild( 0 )->GetObjectInfo();
-		wxString temp_name;
-		if ( childInfo->IsSubclassOf( wxT( "wxWindow" ) ) || wxT( "CustomControl" ) == childInfo->GetClassName() )
-		{
-			temp_name = wxT( "window_add" );
-		}
-		else if ( childInfo->IsSubclassOf( wxT( "sizer" ) ) )
+		if ( !node.addTemplate.empty() )
 		{
-			temp_name = wxT( "sizer_add" );
+			m_source->WriteLn( GetCode( obj, node.addTemplate ) );
 		}
-		else if ( childInfo->GetClassName() == wxT( "spacer" ) )
-		{
-			temp_name = wxT( "spacer_add" );
-		}
-		else
-		{
-			LogDebug( wxT( "SizerItem child is not a Spacer and is not a subclass of wxWindow or of sizer." ) );
-			return;
-		}
-
-		m_source->WriteLn( GetCode( obj, temp_name ) );
 	}
-	else if ( type == wxT( "notebookpage" )		||
-			  type == wxT( "flatnotebookpage" )	||
-			  type == wxT( "listbookpage" )		||
-			  type == wxT( "choicebookpage" )	||
-			  type == wxT( "simplebookpage" )	||
-			  type == wxT( "auinotebookpage" )  ||
-			  type == wxT(" wizardpagesimple" )
-			)
+	else if ( ConstructionNode::NODE_PAGE == node.kind )
 	{
-		GenConstruction( obj->GetChild( 0 ), false );
+		GenConstruction( node.children[0] );
 		m_source->WriteLn( GetCode( obj, wxT( "page_add" ) ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
-	else if ( type == wxT( "treelistctrlcolumn" ) )
+	else if ( ConstructionNode::NODE_COLUMN == node.kind )
 	{
 		m_source->WriteLn( GetCode( obj, wxT( "column_add" ) ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
-	else if ( type == wxT( "tool" ) )
+	else if ( ConstructionNode::NODE_TOOL == node.kind )
 	{
 		// If loading bitmap from ICON resource, and size is not set, set size to toolbars bitmapsize
 		// So hacky, yet so useful ...
@@ -1768,64 +1624,34 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 	else
 	{
 		// Generate the children
-		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		std::vector< ConstructionNode >::const_iterator child;
+		for ( child = node.children.begin(); child != node.children.end(); ++child )
 		{
-			GenConstruction( obj->GetChild( i ), false );
+			GenConstruction( *child );
 		}
 	}
 }
 
-void CppCodeGenerator::FindMacros( PObjectBase obj, std::vector<wxString>* macros )
+std::vector< wxString > CppCodeGenerator::FilterMacros( const std::vector< wxString >& macros )
 {
-	// iterate through all of the properties of all objects, add the macros
-	// to the vector
-	unsigned int i;
+	std::vector< wxString > result;
+	result.reserve( macros.size() );
 
-	for ( i = 0; i < obj->GetPropertyCount(); i++ )
+	std::vector< wxString >::const_iterator it;
+	for ( it = macros.begin(); it != macros.end(); ++it )
 	{
-		PProperty prop = obj->GetProperty( i );
-		if ( prop->GetType() == PT_MACRO )
+		// Skip wx IDs
+		if ( m_predMacros.end() == m_predMacros.find( *it ) )
 		{
-			wxString value = prop->GetValue();
-			// Skip wx IDs
-			if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
-				 ( m_predMacros.end() == m_predMacros.find( value ) ) )
-			{
-				if ( macros->end() == std::find( macros->begin(), macros->end(), value ) )
-				{
-					macros->push_back( value );
-				}
-			}
+			result.push_back( *it );
 		}
 	}
-
-	for ( i = 0; i < obj->GetChildCount(); i++ )
-	{
-		FindMacros( obj->GetChild( i ), macros );
-	}
-}
-
-void CppCodeGenerator::FindEventHandlers( PObjectBase obj, EventVector &events )
-{
-	unsigned int i;
-	for ( i = 0; i < obj->GetEventCount(); i++ )
-	{
-		PEvent event = obj->GetEvent( i );
-		if ( !event->GetValue().IsEmpty() )
-			events.push_back( event );
-	}
-
-	for ( i = 0; i < obj->GetChildCount(); i++ )
-	{
-		PObjectBase child = obj->GetChild( i );
-		FindEventHandlers( child, events );
-	}
+	return result;
 }
 
 void CppCodeGenerator::GenDefines( PObjectBase project )
 {
-	std::vector< wxString > macros;
-	FindMacros( project, &macros );
+	std::vector< wxString > macros = FilterMacros( m_analysis->GetMacros() );
 
 	// Remove the default macro from the set, for backward compatiblity
 	std::vector< wxString >::iterator it;
@@ -1882,15 +1708,18 @@ void CppCodeGenerator::GenSettings( PObjectInfo info, PObjectBase obj )
 	}
 }
 
-void CppCodeGenerator::GenDestruction( PObjectBase obj )
+void CppCodeGenerator::GenDestruction( const ObjectBaseVector& objects )
 {
-	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
-
-	if ( code_info )
+	for ( ObjectBaseVector::const_iterator it = objects.begin(); it != objects.end(); ++it )
 	{
-		_template = code_info->GetTemplate( wxT( "destruction" ) );
+		PObjectBase obj = *it;
+		PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
+		if ( !code_info )
+		{
+			continue;
+		}
 
+		wxString _template = code_info->GetTemplate( wxT( "destruction" ) );
 		if ( !_template.empty() )
 		{
 			CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
@@ -1901,13 +1730,6 @@ void CppCodeGenerator::GenDestruction( PObjectBase obj )
 			}
 		}
 	}
-
-	// Process child widgets
-	for ( unsigned int i = 0; i < obj->GetChildCount() ; i++ )
-	{
-		PObjectBase child = obj->GetChild( i );
-		GenDestruction( child );
-	}
 }
 
 void CppCodeGenerator::GenAddToolbar( PObjectInfo info, PObjectBase obj )
@@ -1955,7 +1777,22 @@ void CppCodeGenerator::GenEmbeddedBitmapIncludes( PObjectBase project )
 	std::set< wxString > include_set;
 
 	// We begin obtaining the "include" list
-	FindEmbeddedBitmapProperties( project, include_set );
+	std::set< wxString > embeddedFiles;
+	FindEmbeddedBitmapProperties( m_analysis->GetBitmaps(), include_set, embeddedFiles );
+
+	// The headers of embedded files are generated together, so they can be encoded in parallel
+	if ( !embeddedFiles.empty() )
+	{
+		ProfileScope profile( wxT("FileToCArray::Generate") );
+
+		std::vector< wxString > includePaths = FileToCArray::Generate( std::vector< wxString >( embeddedFiles.begin(), embeddedFiles.end() ), m_writeEmbeddedFiles );
+		for ( std::vector< wxString >::iterator includePath = includePaths.begin(); includePath != includePaths.end(); ++includePath )
+		{
+			wxString inc;
+			inc << wxT( "#include \"" ) << *includePath << wxT( "\"" );
+			include_set.insert( inc );
+		}
+	}
 
 	if ( include_set.empty() )
 	{
@@ -1975,62 +1812,43 @@ void CppCodeGenerator::GenEmbeddedBitmapIncludes( PObjectBase project )
 	m_source->WriteLn();
 }
 
-void CppCodeGenerator::FindEmbeddedBitmapProperties( PObjectBase obj, std::set<wxString>& embedset )
+void CppCodeGenerator::FindEmbeddedBitmapProperties( const std::vector< PProperty >& bitmaps, std::set<wxString>& embedset, std::set<wxString>& embeddedFiles )
 {
-	// We go through (browse) for each property in "obj" object. If any of the
-	// PT_BITMAP type is found, then the proper "include" string is added
-	// in "set". After that, we recursively do it the same with the child objects.
-	unsigned int i, count;
-
-	count = obj->GetPropertyCount();
-
-	for ( i = 0; i < count; i++ )
+	// For each PT_BITMAP property of the project, the proper "include" string is added
+	// in "set", or the file to embed in "embeddedFiles".
+	std::vector< PProperty >::const_iterator property;
+	for ( property = bitmaps.begin(); property != bitmaps.end(); ++property )
 	{
-		PProperty property = obj->GetProperty( i );
-		if ( property->GetType() == PT_BITMAP )
-		{
-			wxString propValue = property->GetValue();
+		wxString propValue = ( *property )->GetValue();
 
-			wxString path;
-			wxString source;
-			wxSize icoSize;
-			TypeConv::ParseBitmapWithResource( propValue, &path, &source, &icoSize );
+		wxString path;
+		wxString source;
+		wxSize icoSize;
+		TypeConv::ParseBitmapWithResource( propValue, &path, &source, &icoSize );
 
-			wxFileName bmpFileName( path );
-			if ( bmpFileName.GetExt().Upper() == wxT( "XPM" ) )
-			{
-				wxString absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
+		wxFileName bmpFileName( path );
+		if ( bmpFileName.GetExt().Upper() == wxT( "XPM" ) )
+		{
+			wxString absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
 
-				// It's supposed that "path" contains an absolut path to the file
-				// and not a relative one.
-				wxString relPath = ( m_useRelativePath ? TypeConv::MakeRelativePath( absPath, m_basePath ) : absPath );
+			// It's supposed that "path" contains an absolut path to the file
+			// and not a relative one.
+			wxString relPath = ( m_useRelativePath ? TypeConv::MakeRelativePath( absPath, m_basePath ) : absPath );
 
-				wxString inc;
-				inc << wxT( "#include \"" ) << relPath << wxT( "\"" );
-				embedset.insert( inc );
-			}
-			else if ( source == _("Load From Embedded File") )
-			{
-				wxString absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
-				wxString includePath = FileToCArray::Generate( absPath );
-				wxString inc;
-				inc << wxT( "#include \"" ) << includePath << wxT( "\"" );
-				embedset.insert( inc );
-			}
-			// NOTE: This is currently not necessary because the default code already contains this header.
-			//       Because the unique include filtering is not global this cannot be enabled without creating a duplicate entry.
-			//else if (source == _("Load From XRC"))
-			//{
-			//	embedset.insert(wxT("#include <wx/xrc/xmlres.h>"));
-			//}
+			wxString inc;
+			inc << wxT( "#include \"" ) << relPath << wxT( "\"" );
+			embedset.insert( inc );
 		}
-	}
-
-	count = obj->GetChildCount();
-	for ( i = 0; i < count; i++ )
-	{
-		PObjectBase child = obj->GetChild( i );
-		FindEmbeddedBitmapProperties( child, embedset );
+		else if ( source == _("Load From Embedded File") )
+		{
+			embeddedFiles.insert( TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() ) );
+		}
+		// NOTE: This is currently not necessary because the default code already contains this header.
+		//       Because the unique include filtering is not global this cannot be enabled without creating a duplicate entry.
+		//else if (source == _("Load From XRC"))
+		//{
+		//	embedset.insert(wxT("#include <wx/xrc/xmlres.h>"));
+		//}
 	}
 }
 
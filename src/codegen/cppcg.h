@@ -58,6 +58,7 @@ public:
 	PTemplateParser CreateParser(const TemplateParser* oldparser, wxString _template) override;
 	wxString RootWxParentToCode() override;
 	wxString ValueToCode(PropertyType type, wxString value) override;
+	wxString GetLanguage() const override { return wxT("C++"); }
 };
 
 /**
@@ -84,6 +85,7 @@ private:
 	unsigned int m_firstID;
 	bool m_useConnect;
 	bool m_disconnectEvents;
+	bool m_writeEmbeddedFiles;
 
 	/**
 	* Predefined macros won't generate defines.
@@ -97,26 +99,16 @@ private:
 	*/
 	wxString GetCode( PObjectBase obj, wxString name);
 
-	/**
-	* Stores the project's objects classes set, for generating the includes.
-	*/
-	void FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set );
-
 	/**
 	* Stores the needed "includes" set for the PT_BITMAP properties.
 	*/
-	void FindEmbeddedBitmapProperties( PObjectBase obj, std::set< wxString >& embedset);
+	void FindEmbeddedBitmapProperties( const std::vector< PProperty >& bitmaps, std::set< wxString >& embedset, std::set< wxString >& embeddedFiles );
 
 	/**
-	* Stores all the properties for "macro" type objects, so that their
-	* related '#define' can be generated subsequently.
+	* Removes the predefined macros from the macros found by the project analysis,
+	* so that the related '#define' can be generated for the others.
 	*/
-	void FindMacros( PObjectBase obj, std::vector< wxString >* macros );
-
-	/**
-	 * Looks for "non-null" event handlers (PEvent) and collects it into a vector.
-	 */
-	void FindEventHandlers(PObjectBase obj, EventVector &events);
+	std::vector< wxString > FilterMacros( const std::vector< wxString >& macros );
 
 	/**
 	* Generates classes declarations inside the header file.
@@ -134,14 +126,14 @@ private:
 	bool GenEventEntry( PObjectBase obj, PObjectInfo obj_info, const wxString& templateName, const wxString& handlerName, bool disconnect = false );
 
 	/**
-	* Recursive function for the attributes declaration, used inside GenClassDeclaration.
+	* Generates the attributes declaration of the objects of a form, used inside GenClassDeclaration.
 	*/
-	void GenAttributeDeclaration( PObjectBase obj, Permission perm);
+	void GenAttributeDeclaration( const ObjectBaseVector& objects, Permission perm );
 
 	/**
-	* Recursive function for the validators' variables declaration, used inside GenClassDeclaration.
+	* Generates the validators' variables declaration of the objects of a form, used inside GenClassDeclaration.
 	*/
-	void GenValidatorVariables( PObjectBase obj);
+	void GenValidatorVariables( const ObjectBaseVector& objects );
 	/**
 	* Recursive function for the validators' variables declaration, used inside GenClassDeclaration.
 	*/
@@ -150,25 +142,22 @@ private:
 	/**
 	* Generates the generated_event_handlers template
 	*/
-	void GetGenEventHandlers( PObjectBase obj );
+	void GetGenEventHandlers( const ObjectBaseVector& objects );
 	/**
 	* Generates the generated_event_handlers template
 	*/
 	void GenDefinedEventHandlers( PObjectInfo info, PObjectBase obj );
 
 	/**
-	* Generates the '#include' section for files.
+	* Parses the C++ include template of a class for an object.
 	*/
-	void GenIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes );
+	wxString GetIncludeTemplate( PObjectInfo info, PObjectBase obj ) override;
 
 	/**
-	* Generate a set of all subclasses to forward declare in the generated header file.
-	* Also generate sets of header files to be include in either the source or header file.
+	* Adds the forward declaration of the subclass of an object, with its include for either
+	* the source or the header file.
 	*/
-	void GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::set< wxString >* sourceIncludes, std::vector< wxString >* headerIncludes );
+	void CollectSubclass( PObjectBase obj, ProjectDependencies* deps ) override;
 
 	/**
 	* Generates the '#include' section for the embedded bitmap properties.
@@ -197,14 +186,15 @@ private:
 
 	/**
 	* Makes the objects construction, setting up the objects' and Layout properties.
-	* The algorithm is simmilar to that used in the designer preview generation.
+	* The algorithm is simmilar to that used in the designer preview generation,
+	* the decisions are taken from the construction plan of the project analysis.
 	*/
-	void GenConstruction( PObjectBase obj, bool is_widget );
+	void GenConstruction( const ConstructionNode& node );
 
 	/**
 	* Makes the objects destructions.
 	*/
-	void GenDestruction( PObjectBase obj);
+	void GenDestruction( const ObjectBaseVector& objects );
 
 	/**
 	* Configures the object properties, both own and inherited ones.
@@ -281,6 +271,12 @@ public:
 	*/
 	void SetFirstID( const unsigned int id ){ m_firstID = id; }
 
+	/**
+	* Whether the headers of embedded files are written, true by default.
+	* Code previews only include them, they may show only part of the project.
+	*/
+	void SetWriteEmbeddedFiles( bool write ){ m_writeEmbeddedFiles = write; }
+
 	/**
 	* Generate the project's code
 	*/
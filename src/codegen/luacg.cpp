@@ -31,9 +31,11 @@
 #include "../model/objectbase.h"
 #include "../rad/appdata.h"
 #include "../utils/debug.h"
+#include "../utils/profiler.h"
 #include "../utils/typeconv.h"
 #include "../utils/wxfbexception.h"
 #include "codewriter.h"
+#include "projectanalysis.h"
 
 #include <algorithm>
 
@@ -368,6 +370,12 @@ wxString LuaTemplateParser::ValueToCode( PropertyType type, wxString value )
 	return result;
 }
 
+bool LuaTemplateParser::IsValueCacheable( PropertyType type ) const
+{
+	// System colours are converted like options, which depends on the user IDs defined so far
+	return type != PT_WXCOLOUR && TemplateParser::IsValueCacheable( type );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 LuaCodeGenerator::LuaCodeGenerator()
@@ -456,8 +464,8 @@ void LuaCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	m_source->WriteLn( wxEmptyString );
 
 
-			EventVector events;
-			FindEventHandlers( form, events );
+			ProjectAnalysis::Form formAnalysis( form );
+			const EventVector& events = formAnalysis.GetEvents();
 
 
 			if ( events.size() > 0 )
@@ -540,12 +548,20 @@ wxString LuaCodeGenerator::GenEventEntryForInheritedClass( PObjectBase obj, PObj
 
 bool LuaCodeGenerator::GenerateCode( PObjectBase project )
 {
+	ProfileScope profile( wxT("LuaCodeGenerator::GenerateCode") );
+
 	if (!project)
 	{
 		wxLogError(wxT("There is no project to generate code"));
 		return false;
 	}
 
+	// Walk the project once for everything the generation phases need
+	m_analysis = ProjectAnalysis::Get( project );
+
+	// Convert repeated property values to code only once
+	ValueCodeCache::Scope valueCache;
+
 	m_i18n = false;
 	PProperty i18nProperty = project->GetProperty( wxT("internationalize") );
 	if (i18nProperty && i18nProperty->GetValueAsInteger())
@@ -586,19 +602,14 @@ bool LuaCodeGenerator::GenerateCode( PObjectBase project )
 		file = wxT("noname");
 	}
 
-	// Generate the subclass sets
-	std::set< wxString > subclasses;
-	std::vector< wxString > headerIncludes;
-
-	GenSubclassSets( project, &subclasses, &headerIncludes );
-
-	// Generating  includes
-	std::set< wxString > templates;
-	GenIncludes(project, &headerIncludes, &templates );
+	// Generate the subclass sets and the includes from components dependencies
+	ProjectDependencies deps( wxEmptyString, false, false );
+	CollectDependencies( project, &deps );
 
 	// Write the include lines
-	std::vector<wxString>::iterator include_it;
-	for ( include_it = headerIncludes.begin(); include_it != headerIncludes.end(); ++include_it )
+	UniqueLines headerIncludes = deps.GetIncludes();
+	std::vector<wxString>::const_iterator include_it;
+	for ( include_it = headerIncludes.GetLines().begin(); include_it != headerIncludes.GetLines().end(); ++include_it )
 	{
 		m_source->WriteLn( *include_it );
 	}
@@ -639,8 +650,7 @@ bool LuaCodeGenerator::GenerateCode( PObjectBase project )
 	{
 		PObjectBase child = project->GetChild( i );
 
-		EventVector events;
-		FindEventHandlers( child, events );
+		const EventVector& events = m_analysis->GetForm( child ).GetEvents();
 		GenClassDeclaration( child, false, wxT(""), events, m_strEventHandlerPostfix );
 	}
 
@@ -802,14 +812,11 @@ void LuaCodeGenerator::GenVirtualEventHandlers( const EventVector& events, const
 	}
 }
 
-void LuaCodeGenerator::GetGenEventHandlers( PObjectBase obj )
+void LuaCodeGenerator::GetGenEventHandlers( const ObjectBaseVector& objects )
 {
-	GenDefinedEventHandlers( obj->GetObjectInfo(), obj );
-
-	for (unsigned int i = 0; i < obj->GetChildCount() ; i++)
+	for ( ObjectBaseVector::const_iterator it = objects.begin(); it != objects.end(); ++it )
 	{
-		PObjectBase child = obj->GetChild(i);
-		GetGenEventHandlers(child);
+		GenDefinedEventHandlers( ( *it )->GetObjectInfo(), *it );
 	}
 }
 
@@ -918,19 +925,13 @@ void LuaCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool /*use_enu
 		return;
 	}
 
-	GetGenEventHandlers( class_obj );
+	GetGenEventHandlers( m_analysis->GetForm( class_obj ).GetObjects() );
 	GenConstructor( class_obj, events, strName);
 
 }
 
-void LuaCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::vector< wxString >* headerIncludes )
+void LuaCodeGenerator::CollectSubclass( PObjectBase obj, ProjectDependencies* deps )
 {
-	// Call GenSubclassForwardDeclarations on all children as well
-	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
-	{
-		GenSubclassSets( obj->GetChild( i ), subclasses, headerIncludes );
-	}
-
 	// Fill the set
 	PProperty subclass = obj->GetProperty( wxT("subclass") );
 	if ( subclass )
@@ -985,109 +986,20 @@ void LuaCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 		}
 
 		wxString include = wxT("require(\"") + headerVal.Trim() +  wxT("\")\n");
-		std::vector< wxString >::iterator it = std::find( headerIncludes->begin(), headerIncludes->end(), include );
-		if ( headerIncludes->end() == it )
-		{
-			headerIncludes->push_back( include );
-		}
-	}
-}
-
-void LuaCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>* includes, std::set< wxString >* templates )
-{
-	GenObjectIncludes( project, includes, templates );
-}
-
-void LuaCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
-{
-	// Fill the set
-	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT("Lua") );
-	if (code_info)
-	{
-		LuaTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
-		wxString include = parser.ParseTemplate();
-		if ( !include.empty() )
-		{
-			if ( templates->insert( include ).second )
-			{
-				AddUniqueIncludes( include, includes );
-			}
-		}
-	}
-
-	// Call GenIncludes on all children as well
-	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
-	{
-		GenObjectIncludes( project->GetChild(i), includes, templates );
+		deps->subclassIncludes.AddUnique( include );
 	}
-
-	// Generate includes for base classes
-	GenBaseIncludes( project->GetObjectInfo(), project, includes, templates );
 }
 
-void LuaCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates )
+wxString LuaCodeGenerator::GetIncludeTemplate( PObjectInfo info, PObjectBase obj )
 {
-	if ( !info )
-	{
-		return;
-	}
-
-	// Process all the base classes recursively
-	for ( unsigned int i = 0; i < info->GetBaseClassCount(false); i++ )
-	{
-		PObjectInfo base_info = info->GetBaseClass( i, false );
-		GenBaseIncludes( base_info, obj, includes, templates );
-	}
-
 	PCodeInfo code_info = info->GetCodeInfo( wxT("Lua") );
-	if ( code_info )
-	{
-		LuaTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
-		wxString include = parser.ParseTemplate();
-		if ( !include.empty() )
-		{
-			if ( templates->insert( include ).second )
-			{
-				AddUniqueIncludes( include, includes );
-			}
-		}
-	}
-}
-
-void LuaCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes )
-{
-	// Split on newlines to only generate unique include lines
-	// This strips blank lines and trims
-	wxStringTokenizer tkz( include, wxT("\n"), wxTOKEN_STRTOK );
-
-	while ( tkz.HasMoreTokens() )
+	if ( !code_info )
 	{
-		wxString line = tkz.GetNextToken();
-		line.Trim( false );
-		line.Trim( true );
-
-		// If it is an include, it must be unique to be written
-		std::vector< wxString >::iterator it = std::find( includes->begin(), includes->end(), line );
-		if ( includes->end() == it )
-		{
-			includes->push_back( line );
-		}
+		return wxEmptyString;
 	}
-}
 
-void LuaCodeGenerator::FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set )
-{
-	unsigned int ch_count = obj->GetChildCount();
-	if (ch_count > 0)
-	{
-		unsigned int i;
-		for (i = 0; i<ch_count; i++)
-		{
-			PObjectBase child = obj->GetChild(i);
-			info_set.insert(child->GetObjectInfo());
-			FindDependencies(child, info_set);
-		}
-	}
+	LuaTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+	return parser.ParseTemplate();
 }
 
 void LuaCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector &events, wxString &strClassName )
@@ -1133,9 +1045,11 @@ void LuaCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector
 		m_source->WriteLn( wxT("end") );
 	}
 
-	for ( unsigned int i = 0; i < class_obj->GetChildCount(); i++ )
+	const std::vector< ConstructionNode >& construction = m_analysis->GetForm( class_obj ).GetConstruction();
+	std::vector< ConstructionNode >::const_iterator node;
+	for ( node = construction.begin(); node != construction.end(); ++node )
 	{
-		GenConstruction( class_obj->GetChild( i ), true , strClassName);
+		GenConstruction( *node, strClassName );
 	}
 
 	wxString afterAddChild = GetCode( class_obj, wxT("after_addchild") );
@@ -1164,7 +1078,7 @@ void LuaCodeGenerator::GenDestructor( PObjectBase class_obj, const EventVector &
 	}
 
 	// destruct objects
-	GenDestruction( class_obj );
+	GenDestruction( m_analysis->GetForm( class_obj ).GetObjects() );
 
 	m_source->Unindent();
 }
@@ -1177,12 +1091,12 @@ wxString GetParentWindow(PObjectBase obj)
 
 	return strName;
 }
-void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString &strClassName  )
+void LuaCodeGenerator::GenConstruction( const ConstructionNode& node, wxString &strClassName )
 {
-	wxString type = obj->GetObjectTypeName();
-	PObjectInfo info = obj->GetObjectInfo();
+	PObjectBase obj = node.object;
+	const wxString& type = node.type;
 
-	if ( ObjectDatabase::HasCppProperties( type ) )
+	if ( ConstructionNode::NODE_OBJECT == node.kind )
 	{
 
 		wxString strName;
@@ -1206,20 +1120,18 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 
 		GenSettings( obj->GetObjectInfo(), obj, strClassName );
 
-		bool isWidget = !info->IsSubclassOf( wxT("sizer") );
-
-		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		std::vector< ConstructionNode >::const_iterator child;
+		for ( child = node.children.begin(); child != node.children.end(); ++child )
 		{
-			PObjectBase child = obj->GetChild( i );
-			GenConstruction( child, isWidget, strClassName);
+			GenConstruction( *child, strClassName );
 
 			if ( type == wxT("toolbar") )
 			{
-				GenAddToolbar(child->GetObjectInfo(), child);
+				GenAddToolbar( child->object->GetObjectInfo(), child->object );
 			}
 		}
 
-		if ( !isWidget ) // sizers
+		if ( node.isSizer )
 		{
 			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
 			if ( !afterAddChild.empty() )
@@ -1228,7 +1140,7 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 			}
 			m_source->WriteLn();
 
-			if (is_widget)
+			if ( node.parentIsWidget )
 			{
 				// the parent object is not a sizer. There is no template for
 				// this so we'll make it manually.
@@ -1323,55 +1235,27 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 			m_source->WriteLn();
 		}
 	}
-	else if ( info->IsSubclassOf( wxT("sizeritembase") ) )
+	else if ( ConstructionNode::NODE_SIZERITEM == node.kind )
 	{
+		GenConstruction( node.children[0], strClassName );
 
-		// The child must be added to the sizer having in mind the
-		// child object type (there are 3 different routines)
-		GenConstruction( obj->GetChild(0), false,  strClassName);
-
-		PObjectInfo childInfo = obj->GetChild(0)->GetObjectInfo();
-		wxString temp_name;
-		if ( childInfo->IsSubclassOf( wxT("wxWindow") ) || wxT("CustomControl") == childInfo->GetClassName() )
-		{
-			temp_name = wxT("window_add");
-		}
-		else if ( childInfo->IsSubclassOf( wxT("sizer") ) )
-		{
-			temp_name = wxT("sizer_add");
-		}
-		else if ( childInfo->GetClassName() == wxT("spacer") )
-		{
-			temp_name = wxT("spacer_add");
-		}
-		else
+		if ( !node.addTemplate.empty() )
 		{
-			LogDebug( wxT("SizerItem child is not a Spacer and is not a subclass of wxWindow or of sizer.") );
-			return;
+			m_source->WriteLn( GetCode( obj, node.addTemplate ) );
 		}
-
-
-			m_source->WriteLn( GetCode( obj, temp_name ) );
-
 	}
-	else if (	type == wxT("notebookpage")		||
-				type == wxT("flatnotebookpage")	||
-				type == wxT("listbookpage")		||
-				type == wxT("simplebookpage")	||
-				type == wxT("choicebookpage")	||
-				type == wxT("auinotebookpage")
-			)
+	else if ( ConstructionNode::NODE_PAGE == node.kind )
 	{
-		GenConstruction( obj->GetChild( 0 ), false, strClassName);
+		GenConstruction( node.children[0], strClassName );
 		m_source->WriteLn( GetCode( obj, wxT("page_add") ) );
 		GenSettings( obj->GetObjectInfo(), obj, strClassName );
 	}
-	else if ( type == wxT("treelistctrlcolumn") )
+	else if ( ConstructionNode::NODE_COLUMN == node.kind )
 	{
 		m_source->WriteLn( GetCode( obj, wxT("column_add") ) );
 		GenSettings( obj->GetObjectInfo(), obj, strClassName );
 	}
-	else if ( type == wxT("tool") )
+	else if ( ConstructionNode::NODE_TOOL == node.kind )
 	{
 		// If loading bitmap from ICON resource, and size is not set, set size to toolbars bitmapsize
 		// So hacky, yet so useful ...
@@ -1399,22 +1283,26 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 	else
 	{
 		// Generate the children
-		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		std::vector< ConstructionNode >::const_iterator child;
+		for ( child = node.children.begin(); child != node.children.end(); ++child )
 		{
-			GenConstruction( obj->GetChild( i ), false, strClassName);
+			GenConstruction( *child, strClassName );
 		}
 	}
 }
 
-void LuaCodeGenerator::GenDestruction( PObjectBase obj )
+void LuaCodeGenerator::GenDestruction( const ObjectBaseVector& objects )
 {
-	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "Lua" ) );
-
-	if ( code_info )
+	for ( ObjectBaseVector::const_iterator it = objects.begin(); it != objects.end(); ++it )
 	{
-		_template = code_info->GetTemplate( wxT( "destruction" ) );
+		PObjectBase obj = *it;
+		PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "Lua" ) );
+		if ( !code_info )
+		{
+			continue;
+		}
 
+		wxString _template = code_info->GetTemplate( wxT( "destruction" ) );
 		if ( !_template.empty() )
 		{
 			LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
@@ -1425,69 +1313,31 @@ void LuaCodeGenerator::GenDestruction( PObjectBase obj )
 			}
 		}
 	}
-
-	// Process child widgets
-	for ( unsigned int i = 0; i < obj->GetChildCount() ; i++ )
-	{
-		PObjectBase child = obj->GetChild( i );
-		GenDestruction( child );
-	}
 }
 
-void LuaCodeGenerator::FindMacros( PObjectBase obj, std::vector<wxString>* macros )
+std::vector< wxString > LuaCodeGenerator::FilterMacros( const std::vector< wxString >& macros )
 {
-	// iterate through all of the properties of all objects, add the macros
-	// to the vector
-	unsigned int i;
+	std::vector< wxString > result;
+	result.reserve( macros.size() );
 
-	for ( i = 0; i < obj->GetPropertyCount(); i++ )
+	std::vector< wxString >::const_iterator it;
+	for ( it = macros.begin(); it != macros.end(); ++it )
 	{
-		PProperty prop = obj->GetProperty( i );
-		if ( prop->GetType() == PT_MACRO )
-		{
-			wxString value = prop->GetValue();
-			if( value.IsEmpty() ) continue;
+		wxString value = *it;
+		if( value.IsEmpty() ) continue;
 
-			// Skip wx IDs
-			if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
-				 ( m_predMacros.end() == m_predMacros.find( value ) ) )
-			{
-				if ( macros->end() == std::find( macros->begin(), macros->end(), value ) )
-				{
-					macros->push_back( value );
-				}
-			}
+		// Skip wx IDs
+		if ( m_predMacros.end() == m_predMacros.find( value ) )
+		{
+			result.push_back( value );
 		}
 	}
-
-	for ( i = 0; i < obj->GetChildCount(); i++ )
-	{
-		FindMacros( obj->GetChild( i ), macros );
-	}
-}
-
-void LuaCodeGenerator::FindEventHandlers(PObjectBase obj, EventVector &events)
-{
-  unsigned int i;
-  unsigned int evt_cnt = obj->GetEventCount();
-  for (i=0; i < evt_cnt; i++)
-  {
-	PEvent event = obj->GetEvent(i);
-	if (!event->GetValue().IsEmpty())
-	  events.push_back(event);
-  }
-
-  for (i=0; i < obj->GetChildCount(); i++)
-  {
-	PObjectBase child = obj->GetChild(i);
-	FindEventHandlers(child,events);
-  }
+	return result;
 }
 
 void LuaCodeGenerator::GenDefines( PObjectBase project)
 {
-	std::vector< wxString > macros;
-	FindMacros( project, &macros );
+	std::vector< wxString > macros = FilterMacros( m_analysis->GetMacros() );
 	m_strUserIDsVec.erase(m_strUserIDsVec.begin(),m_strUserIDsVec.end());
 
 	// Remove the default macro from the set, for backward compatiblity
@@ -0,0 +1,376 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "manifest.h"
+
+#include "../md5/md5.hh"
+#include "../model/database.h"
+#include "../model/objectbase.h"
+#include "../rad/appdata.h"
+#include "../utils/typeconv.h"
+#include "projectanalysis.h"
+
+#include <wx/dir.h>
+#include <wx/ffile.h>
+#include <wx/filename.h>
+#include <wx/tokenzr.h>
+
+namespace
+{
+	const wxChar* const MANIFEST_HEADER = wxT("wxFormBuilder generation manifest 2");
+
+	GenerationManifest::Recorder* s_currentRecorder = NULL;
+
+	wxString HashFile( const wxString& path )
+	{
+		FILE* file = wxFopen( path, wxT("rb") );
+		if ( !file )
+		{
+			return wxEmptyString;
+		}
+
+		MD5 md5;
+		md5.update( file );
+		md5.finalize();
+		fclose( file );
+
+		char* digest = md5.hex_digest();
+		wxString hash = wxString::FromAscii( digest );
+		delete [] digest;
+		return hash;
+	}
+
+	/*
+	Hash of the names of the plugin directories and of the names and modification times of
+	their definition files. The manifest is checked before the plugins are loaded, so this is
+	what notices an installed or removed plugin.
+	*/
+	wxString HashPluginListing( const wxString& pluginPath )
+	{
+		wxArrayString plugins;
+		wxDir pluginsDir;
+		if ( wxDir::Exists( pluginPath ) && pluginsDir.Open( pluginPath ) )
+		{
+			wxString name;
+			for ( bool more = pluginsDir.GetFirst( &name, wxEmptyString, wxDIR_DIRS | wxDIR_HIDDEN ); more; more = pluginsDir.GetNext( &name ) )
+			{
+				plugins.Add( name );
+			}
+		}
+		plugins.Sort();
+
+		wxString listing;
+		for ( size_t i = 0; i < plugins.GetCount(); i++ )
+		{
+			listing << plugins[i] << wxT("\n");
+
+			wxArrayString files;
+			wxString xmlPath = pluginPath + plugins[i] + wxFILE_SEP_PATH + wxT("xml");
+			if ( wxDir::Exists( xmlPath ) )
+			{
+				wxDir::GetAllFiles( xmlPath, &files, wxEmptyString, wxDIR_FILES | wxDIR_HIDDEN );
+			}
+			files.Sort();
+
+			for ( size_t j = 0; j < files.GetCount(); j++ )
+			{
+				listing << files[j] << wxT(" ") << wxString::Format( wxT("%lld"), (long long)wxFileModificationTime( files[j] ) ) << wxT("\n");
+			}
+		}
+
+		const wxScopedCharBuffer utf8 = listing.utf8_str();
+		MD5 md5( reinterpret_cast< const unsigned char* >( utf8.data() ), static_cast< uint32_t >( utf8.length() ) );
+		char* digest = md5.hex_digest();
+		wxString hash = wxString::FromAscii( digest );
+		delete [] digest;
+		return hash;
+	}
+
+	// Every file still has the hash it had when the manifest was written
+	bool AreCurrent( const std::map< wxString, wxString >& files )
+	{
+		std::map< wxString, wxString >::const_iterator file;
+		for ( file = files.begin(); file != files.end(); ++file )
+		{
+			if ( HashFile( file->first ) != file->second )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Make and Ninja split paths on whitespace and treat '#' and '$' specially
+	wxString EscapeDepfilePath( const wxString& path )
+	{
+		wxString escaped;
+		escaped.reserve( path.length() );
+		for ( wxString::const_iterator c = path.begin(); c != path.end(); ++c )
+		{
+			switch ( (wxChar)*c )
+			{
+				case wxT(' '):
+				case wxT('#'):
+					escaped << wxT('\\') << *c;
+					break;
+				case wxT('$'):
+					escaped << wxT("$$");
+					break;
+				default:
+					escaped << *c;
+					break;
+			}
+		}
+		return escaped;
+	}
+}
+
+GenerationManifest::Recorder::Recorder( GenerationManifest* manifest )
+:
+m_previous( s_currentRecorder ),
+m_manifest( manifest )
+{
+	s_currentRecorder = this;
+}
+
+GenerationManifest::Recorder::~Recorder()
+{
+	s_currentRecorder = m_previous;
+}
+
+GenerationManifest::Recorder* GenerationManifest::Recorder::GetCurrent()
+{
+	return s_currentRecorder;
+}
+
+void GenerationManifest::Recorder::AddOutput( const wxString& path )
+{
+	wxFileName fileName( path );
+	fileName.MakeAbsolute();
+	m_manifest->m_outputs[ fileName.GetFullPath() ] = wxEmptyString;
+}
+
+void GenerationManifest::AddOutput( const wxString& path )
+{
+	Recorder* recorder = Recorder::GetCurrent();
+	if ( recorder )
+	{
+		recorder->AddOutput( path );
+	}
+}
+
+GenerationManifest::GenerationManifest( const wxString& projectFile, const wxString& settings )
+:
+m_projectFile( projectFile ),
+m_settings( settings )
+{
+}
+
+wxString GenerationManifest::GetPath() const
+{
+	return m_projectFile + wxT(".manifest");
+}
+
+bool GenerationManifest::Load( FileHashes* inputs, FileHashes* listings, FileHashes* outputs ) const
+{
+	if ( !wxFileExists( GetPath() ) )
+	{
+		return false;
+	}
+
+	wxFFile file( GetPath(), wxT("rb") );
+	wxString contents;
+	if ( !file.IsOpened() || !file.ReadAll( &contents, wxConvUTF8 ) )
+	{
+		return false;
+	}
+
+	wxStringTokenizer lines( contents, wxT("\n") );
+	if ( lines.GetNextToken() != MANIFEST_HEADER || lines.GetNextToken() != wxT("settings ") + m_settings )
+	{
+		return false;
+	}
+
+	// "input <md5> <path>", "listing <md5> <directory>" and "output <md5> <path>"
+	while ( lines.HasMoreTokens() )
+	{
+		wxString line = lines.GetNextToken();
+		wxString kind = line.BeforeFirst( wxT(' ') );
+		wxString hash = line.AfterFirst( wxT(' ') ).BeforeFirst( wxT(' ') );
+		wxString path = line.AfterFirst( wxT(' ') ).AfterFirst( wxT(' ') );
+		if ( hash.empty() || path.empty() )
+		{
+			return false;
+		}
+
+		if ( kind == wxT("input") )
+		{
+			( *inputs )[ path ] = hash;
+		}
+		else if ( kind == wxT("listing") )
+		{
+			( *listings )[ path ] = hash;
+		}
+		else if ( kind == wxT("output") )
+		{
+			( *outputs )[ path ] = hash;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return !inputs->empty() && !outputs->empty();
+}
+
+bool GenerationManifest::IsCurrent()
+{
+	FileHashes inputs;
+	FileHashes listings;
+	FileHashes outputs;
+	if ( !Load( &inputs, &listings, &outputs ) )
+	{
+		return false;
+	}
+
+	FileHashes::const_iterator listing;
+	for ( listing = listings.begin(); listing != listings.end(); ++listing )
+	{
+		if ( HashPluginListing( listing->first ) != listing->second )
+		{
+			return false;
+		}
+	}
+
+	// Outputs edited or deleted by hand have to be generated again as well
+	if ( !AreCurrent( inputs ) || !AreCurrent( outputs ) )
+	{
+		return false;
+	}
+
+	m_inputs.swap( inputs );
+	m_listings.swap( listings );
+	m_outputs.swap( outputs );
+	return true;
+}
+
+void GenerationManifest::CollectInputs( PObjectBase project )
+{
+	m_inputs.clear();
+	m_inputs[ m_projectFile ] = HashFile( m_projectFile );
+
+	m_listings.clear();
+	const wxString pluginPath = AppData()->GetObjectDatabase()->GetPluginPath();
+	m_listings[ pluginPath ] = HashPluginListing( pluginPath );
+
+	const std::vector< wxString >& definitions = AppData()->GetObjectDatabase()->GetDefinitionFiles();
+	std::vector< wxString >::const_iterator definition;
+	for ( definition = definitions.begin(); definition != definitions.end(); ++definition )
+	{
+		wxFileName fileName( *definition );
+		fileName.MakeAbsolute();
+		m_inputs[ fileName.GetFullPath() ] = HashFile( fileName.GetFullPath() );
+	}
+
+	if ( !project )
+	{
+		return;
+	}
+
+	// Bitmaps loaded from files, embedded ones end up in the generated code
+	const std::vector< PProperty >& bitmaps = ProjectAnalysis::Get( project )->GetBitmaps();
+	std::vector< PProperty >::const_iterator bitmap;
+	for ( bitmap = bitmaps.begin(); bitmap != bitmaps.end(); ++bitmap )
+	{
+		wxString path;
+		wxString source;
+		wxSize icoSize;
+		TypeConv::ParseBitmapWithResource( ( *bitmap )->GetValue(), &path, &source, &icoSize );
+		if ( path.empty() )
+		{
+			continue;
+		}
+
+		wxString absPath = TypeConv::MakeAbsolutePath( path, AppData()->GetProjectPath() );
+		if ( wxFileExists( absPath ) && m_inputs.find( absPath ) == m_inputs.end() )
+		{
+			m_inputs[ absPath ] = HashFile( absPath );
+		}
+	}
+}
+
+bool GenerationManifest::Save() const
+{
+	wxString contents;
+	contents << MANIFEST_HEADER << wxT("\n");
+	contents << wxT("settings ") << m_settings << wxT("\n");
+
+	FileHashes::const_iterator file;
+	for ( file = m_inputs.begin(); file != m_inputs.end(); ++file )
+	{
+		contents << wxT("input ") << file->second << wxT(" ") << file->first << wxT("\n");
+	}
+	for ( file = m_listings.begin(); file != m_listings.end(); ++file )
+	{
+		contents << wxT("listing ") << file->second << wxT(" ") << file->first << wxT("\n");
+	}
+
+	// The writers only report the paths, the hashes are those of the files as written
+	for ( file = m_outputs.begin(); file != m_outputs.end(); ++file )
+	{
+		wxString hash = ( file->second.empty() ? HashFile( file->first ) : file->second );
+		if ( hash.empty() )
+		{
+			// A file could not be written, the next generation must not be skipped
+			return false;
+		}
+		contents << wxT("output ") << hash << wxT(" ") << file->first << wxT("\n");
+	}
+
+	wxFFile out( GetPath(), wxT("wb") );
+	return out.IsOpened() && out.Write( contents, wxConvUTF8 ) && out.Close();
+}
+
+bool GenerationManifest::WriteDepfile( const wxString& path ) const
+{
+	wxString contents;
+	FileHashes::const_iterator file;
+	for ( file = m_outputs.begin(); file != m_outputs.end(); ++file )
+	{
+		contents << ( file == m_outputs.begin() ? wxT("") : wxT(" ") ) << EscapeDepfilePath( file->first );
+	}
+	contents << wxT(":");
+	for ( file = m_inputs.begin(); file != m_inputs.end(); ++file )
+	{
+		contents << wxT(" \\\n  ") << EscapeDepfilePath( file->first );
+	}
+
+	// The plugin directory changes when a plugin is installed or removed
+	for ( file = m_listings.begin(); file != m_listings.end(); ++file )
+	{
+		contents << wxT(" \\\n  ") << EscapeDepfilePath( wxFileName::DirName( file->first ).GetPath() );
+	}
+	contents << wxT("\n");
+
+	wxFFile out( path, wxT("wb") );
+	return out.IsOpened() && out.Write( contents, wxConvUTF8 ) && out.Close();
+}
@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __GENERATION_MANIFEST__
+#define __GENERATION_MANIFEST__
+
+#include "../utils/wxfbdefs.h"
+
+#include <wx/string.h>
+
+#include <map>
+#include <vector>
+
+/**
+* Record of a command line generation: the files it wrote and the hashes of all the inputs they
+* were generated from, stored next to the project as "<project>.manifest".
+*
+* The inputs are the project file, the object descriptions and code templates of the loaded
+* plugins, a listing of the plugin directories, and the files of the bitmaps the project references. When none of them changed and
+* the outputs are still as they were written, --generate does not need to load the project at all.
+*/
+class GenerationManifest
+{
+public:
+	/**
+	* Collects the files written by FileCodeWriter and FileToCArray while it is alive.
+	*/
+	class Recorder
+	{
+	private:
+		Recorder* m_previous;
+		GenerationManifest* m_manifest;
+
+		Recorder( const Recorder& );
+		Recorder& operator=( const Recorder& );
+
+	public:
+		explicit Recorder( GenerationManifest* manifest );
+		~Recorder();
+
+		static Recorder* GetCurrent();
+
+		void AddOutput( const wxString& path );
+	};
+
+	/// Reports a generated file to the current recorder, if there is one
+	static void AddOutput( const wxString& path );
+
+private:
+	typedef std::map< wxString, wxString > FileHashes;
+
+	wxString m_projectFile;
+	wxString m_settings;
+	FileHashes m_inputs;
+	FileHashes m_listings;
+	FileHashes m_outputs;
+
+	bool Load( FileHashes* inputs, FileHashes* listings, FileHashes* outputs ) const;
+
+public:
+	/**
+	* @param projectFile Absolute path of the project.
+	* @param settings Anything else the output depends on, like the generator version and the languages.
+	*/
+	GenerationManifest( const wxString& projectFile, const wxString& settings );
+
+	wxString GetPath() const;
+
+	/**
+	* Checks the manifest stored by the last generation: same settings, unchanged inputs and
+	* unchanged outputs. When it is current its outputs are taken over for WriteDepfile().
+	*/
+	bool IsCurrent();
+
+	/// Hashes the project file, the loaded plugin definitions, the plugin listing and the bitmap files of the project
+	void CollectInputs( PObjectBase project );
+
+	bool Save() const;
+
+	/**
+	* Writes a Make/Ninja depfile with the outputs as targets and all inputs as prerequisites.
+	*/
+	bool WriteDepfile( const wxString& path ) const;
+};
+
+#endif //__GENERATION_MANIFEST__
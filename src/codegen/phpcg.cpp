@@ -29,8 +29,10 @@
 #include "phpcg.h"
 
 #include "codewriter.h"
+#include "projectanalysis.h"
 #include "../utils/typeconv.h"
 #include "../utils/debug.h"
+#include "../utils/profiler.h"
 #include "../rad/appdata.h"
 #include "../model/objectbase.h"
 #include "../utils/wxfbexception.h"
@@ -421,8 +423,8 @@ void PHPCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	m_source->WriteLn( code );
 
 	// Do events
-	EventVector events;
-	FindEventHandlers( form, events );
+	ProjectAnalysis::Form formAnalysis( form );
+	const EventVector& events = formAnalysis.GetEvents();
 
 	if ( events.size() > 0 )
 	{
@@ -452,12 +454,20 @@ void PHPCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 
 bool PHPCodeGenerator::GenerateCode( PObjectBase project )
 {
+	ProfileScope profile( wxT("PHPCodeGenerator::GenerateCode") );
+
 	if (!project)
 	{
 		wxLogError(wxT("There is no project to generate code"));
 		return false;
 	}
 
+	// Walk the project once for everything the generation phases need
+	m_analysis = ProjectAnalysis::Get( project );
+
+	// Convert repeated property values to code only once
+	ValueCodeCache::Scope valueCache;
+
 	m_i18n = false;
 	PProperty i18nProperty = project->GetProperty( wxT("internationalize") );
 	if (i18nProperty && i18nProperty->GetValueAsInteger())
@@ -500,19 +510,14 @@ bool PHPCodeGenerator::GenerateCode( PObjectBase project )
 		file = wxT("noname");
 	}
 
-	// Generate the subclass sets
-	std::set< wxString > subclasses;
-	std::vector< wxString > headerIncludes;
-
-	GenSubclassSets( project, &subclasses, &headerIncludes );
-
-	// Generating in the .h header file those include from components dependencies.
-	std::set< wxString > templates;
-	GenIncludes(project, &headerIncludes, &templates );
+	// Generate the subclass sets and the includes from components dependencies
+	ProjectDependencies deps( wxT("import"), false, false );
+	CollectDependencies( project, &deps );
 
 	// Write the include lines
-	std::vector<wxString>::iterator include_it;
-	for ( include_it = headerIncludes.begin(); include_it != headerIncludes.end(); ++include_it )
+	UniqueLines headerIncludes = deps.GetIncludes();
+	std::vector<wxString>::const_iterator include_it;
+	for ( include_it = headerIncludes.GetLines().begin(); include_it != headerIncludes.GetLines().end(); ++include_it )
 	{
 		m_source->WriteLn( *include_it );
 	}
@@ -548,8 +553,7 @@ bool PHPCodeGenerator::GenerateCode( PObjectBase project )
 	{
 		PObjectBase child = project->GetChild( i );
 
-		EventVector events;
-		FindEventHandlers( child, events );
+		const EventVector& events = m_analysis->GetForm( child ).GetEvents();
 		//GenClassDeclaration( child, useEnum, classDecoration, events, eventHandlerPrefix, eventHandlerPostfix );
 		GenClassDeclaration( child, false, wxT(""), events, eventHandlerPostfix );
 	}
@@ -702,14 +706,11 @@ void PHPCodeGenerator::GenVirtualEventHandlers( const EventVector& events, const
 	}
 }
 
-void PHPCodeGenerator::GetGenEventHandlers( PObjectBase obj )
+void PHPCodeGenerator::GetGenEventHandlers( const ObjectBaseVector& objects )
 {
-	GenDefinedEventHandlers( obj->GetObjectInfo(), obj );
-
-	for (unsigned int i = 0; i < obj->GetChildCount() ; i++)
+	for ( ObjectBaseVector::const_iterator it = objects.begin(); it != objects.end(); ++it )
 	{
-		PObjectBase child = obj->GetChild(i);
-		GetGenEventHandlers(child);
+		GenDefinedEventHandlers( ( *it )->GetObjectInfo(), *it );
 	}
 }
 
@@ -742,6 +743,14 @@ void PHPCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase ob
 
 wxString PHPCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silent)
 {
+	// Expanded once per template while the project is not modified, e.g. across the code panels' updates
+	const wxString key = wxString::Format( wxT("PHP\n%s\n%d\n%d\n%s"), name, ( m_i18n ? 1 : 0 ), ( m_useRelativePath ? 1 : 0 ), m_basePath );
+	const wxString* cached = FindCachedCode( obj, key );
+	if ( cached )
+	{
+		return *cached;
+	}
+
 	wxString _template;
 	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT("PHP") );
 
@@ -767,6 +776,7 @@ wxString PHPCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silent)
 
 	PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
 	wxString code = parser.ParseTemplate();
+	CacheCode( obj, key, code );
 
 	return code;
 }
@@ -806,21 +816,15 @@ void PHPCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool /*use_enu
 
 	// event handlers
 	GenVirtualEventHandlers(events, eventHandlerPostfix);
-	GetGenEventHandlers( class_obj );
+	GetGenEventHandlers( m_analysis->GetForm( class_obj ).GetObjects() );
 
 	m_source->Unindent();
 	m_source->WriteLn( wxT("}") );
 	m_source->WriteLn( wxT("") );
 }
 
-void PHPCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::vector< wxString >* headerIncludes )
+void PHPCodeGenerator::CollectSubclass( PObjectBase obj, ProjectDependencies* deps )
 {
-	// Call GenSubclassForwardDeclarations on all children as well
-	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
-	{
-		GenSubclassSets( obj->GetChild( i ), subclasses, headerIncludes );
-	}
-
 	// Fill the set
 	PProperty subclass = obj->GetProperty( wxT("subclass") );
 	if ( subclass )
@@ -875,116 +879,20 @@ void PHPCodeGenerator::GenSubclassSets( PObjectBase obj, std::set< wxString >* s
 		}
 
 		wxString include = wxT("include_once ") + headerVal + wxT(";");
-		std::vector< wxString >::iterator it = std::find( headerIncludes->begin(), headerIncludes->end(), include );
-		if ( headerIncludes->end() == it )
-		{
-			headerIncludes->push_back( include );
-		}
+		deps->subclassIncludes.AddUnique( include );
 	}
 }
 
-void PHPCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>* includes, std::set< wxString >* templates )
-{
-	GenObjectIncludes( project, includes, templates );
-}
-
-void PHPCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
+wxString PHPCodeGenerator::GetIncludeTemplate( PObjectInfo info, PObjectBase obj )
 {
-	// Fill the set
-	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT("PHP") );
-	if (code_info)
-	{
-		PHPTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
-		wxString include = parser.ParseTemplate();
-		if ( !include.empty() )
-		{
-			if ( templates->insert( include ).second )
-			{
-				AddUniqueIncludes( include, includes );
-			}
-		}
-	}
-
-	// Call GenIncludes on all children as well
-	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
-	{
-		GenObjectIncludes( project->GetChild(i), includes, templates );
-	}
-
-	// Generate includes for base classes
-	GenBaseIncludes( project->GetObjectInfo(), project, includes, templates );
-}
-
-void PHPCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates )
-{
-	if ( !info )
-	{
-		return;
-	}
-
-	// Process all the base classes recursively
-	for ( unsigned int i = 0; i < info->GetBaseClassCount(); i++ )
-	{
-		PObjectInfo base_info = info->GetBaseClass( i );
-		GenBaseIncludes( base_info, obj, includes, templates );
-	}
-
 	PCodeInfo code_info = info->GetCodeInfo( wxT("PHP") );
-	if ( code_info )
-	{
-		PHPTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
-		wxString include = parser.ParseTemplate();
-		if ( !include.empty() )
-		{
-			if ( templates->insert( include ).second )
-			{
-				AddUniqueIncludes( include, includes );
-			}
-		}
-	}
-}
-
-void PHPCodeGenerator::AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes )
-{
-	// Split on newlines to only generate unique include lines
-	// This strips blank lines and trims
-	wxStringTokenizer tkz( include, wxT("\n"), wxTOKEN_STRTOK );
-
-	while ( tkz.HasMoreTokens() )
+	if ( !code_info )
 	{
-		wxString line = tkz.GetNextToken();
-		line.Trim( false );
-		line.Trim( true );
-
-		// If it is not an include line, it will be written
-		if ( !line.StartsWith( wxT("import") ) )
-		{
-			includes->push_back( line );
-			continue;
-		}
-
-		// If it is an include, it must be unique to be written
-		std::vector< wxString >::iterator it = std::find( includes->begin(), includes->end(), line );
-		if ( includes->end() == it )
-		{
-			includes->push_back( line );
-		}
+		return wxEmptyString;
 	}
-}
 
-void PHPCodeGenerator::FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set )
-{
-	unsigned int ch_count = obj->GetChildCount();
-	if (ch_count > 0)
-	{
-		unsigned int i;
-		for (i = 0; i<ch_count; i++)
-		{
-			PObjectBase child = obj->GetChild(i);
-			info_set.insert(child->GetObjectInfo());
-			FindDependencies(child, info_set);
-		}
-	}
+	PHPTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
+	return parser.ParseTemplate();
 }
 
 void PHPCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector &events )
@@ -1003,9 +911,11 @@ void PHPCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector
 		m_source->WriteLn( settings );
 	}
 
-	for ( unsigned int i = 0; i < class_obj->GetChildCount(); i++ )
+	const std::vector< ConstructionNode >& construction = m_analysis->GetForm( class_obj ).GetConstruction();
+	std::vector< ConstructionNode >::const_iterator node;
+	for ( node = construction.begin(); node != construction.end(); ++node )
 	{
-		GenConstruction( class_obj->GetChild( i ), true );
+		GenConstruction( *node );
 	}
 
 	wxString afterAddChild = GetCode( class_obj, wxT("after_addchild") );
@@ -1050,37 +960,35 @@ void PHPCodeGenerator::GenDestructor( PObjectBase class_obj, const EventVector &
 	}
 
 	// destruct objects
-	GenDestruction( class_obj );
+	GenDestruction( m_analysis->GetForm( class_obj ).GetObjects() );
 
 	m_source->Unindent();
 	m_source->WriteLn( wxT("}") );
 }
 
-void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
+void PHPCodeGenerator::GenConstruction( const ConstructionNode& node )
 {
-	wxString type = obj->GetObjectTypeName();
-	PObjectInfo info = obj->GetObjectInfo();
+	PObjectBase obj = node.object;
+	const wxString& type = node.type;
 
-	if ( ObjectDatabase::HasCppProperties( type ) )
+	if ( ConstructionNode::NODE_OBJECT == node.kind )
 	{
 		m_source->WriteLn( GetCode( obj, wxT("construction") ) );
 
 		GenSettings( obj->GetObjectInfo(), obj );
 
-		bool isWidget = !info->IsSubclassOf( wxT("sizer") );
-
-		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		std::vector< ConstructionNode >::const_iterator child;
+		for ( child = node.children.begin(); child != node.children.end(); ++child )
 		{
-			PObjectBase child = obj->GetChild( i );
-			GenConstruction( child, isWidget );
+			GenConstruction( *child );
 
 			if ( type == wxT("toolbar") )
 			{
-				GenAddToolbar(child->GetObjectInfo(), child);
+				GenAddToolbar( child->object->GetObjectInfo(), child->object );
 			}
 		}
 
-		if ( !isWidget ) // sizers
+		if ( node.isSizer )
 		{
 			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
 			if ( !afterAddChild.empty() )
@@ -1089,7 +997,7 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 			}
 			m_source->WriteLn();
 
-			if (is_widget)
+			if ( node.parentIsWidget )
 			{
 				// the parent object is not a sizer. There is no template for
 				// this so we'll make it manually.
@@ -1178,52 +1086,27 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 			m_source->WriteLn();
 		}
 	}
-	else if ( info->IsSubclassOf( wxT("sizeritembase") ) )
+	else if ( ConstructionNode::NODE_SIZERITEM == node.kind )
 	{
-		// The child must be added to the sizer having in mind the
-		// child object type (there are 3 different routines)
-		GenConstruction( obj->GetChild(0), false );
+		GenConstruction( node.children[0] );
 
-		PObjectInfo childInfo = obj->GetChild(0)->GetObjectInfo();
-		wxString temp_name;
-		if ( childInfo->IsSubclassOf( wxT("wxWindow") ) || wxT("CustomControl") == childInfo->GetClassName() )
-		{
-			temp_name = wxT("window_add");
-		}
-		else if ( childInfo->IsSubclassOf( wxT("sizer") ) )
-		{
-			temp_name = wxT("sizer_add");
-		}
-		else if ( childInfo->GetClassName() == wxT("spacer") )
+		if ( !node.addTemplate.empty() )
 		{
-			temp_name = wxT("spacer_add");
-		}
-		else
-		{
-			LogDebug( wxT("SizerItem child is not a Spacer and is not a subclass of wxWindow or of sizer.") );
-			return;
+			m_source->WriteLn( GetCode( obj, node.addTemplate ) );
 		}
-
-		m_source->WriteLn( GetCode( obj, temp_name ) );
 	}
-	else if (	type == wxT("notebookpage")		||
-				type == wxT("flatnotebookpage")	||
-				type == wxT("listbookpage")		||
-				type == wxT("simplebookpage")	||
-				type == wxT("choicebookpage")	||
-				type == wxT("auinotebookpage")
-			)
+	else if ( ConstructionNode::NODE_PAGE == node.kind )
 	{
-		GenConstruction( obj->GetChild( 0 ), false );
+		GenConstruction( node.children[0] );
 		m_source->WriteLn( GetCode( obj, wxT("page_add") ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
-	else if ( type == wxT("treelistctrlcolumn") )
+	else if ( ConstructionNode::NODE_COLUMN == node.kind )
 	{
 		m_source->WriteLn( GetCode( obj, wxT("column_add") ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
-	else if ( type == wxT("tool") )
+	else if ( ConstructionNode::NODE_TOOL == node.kind )
 	{
 		// If loading bitmap from ICON resource, and size is not set, set size to toolbars bitmapsize
 		// So hacky, yet so useful ...
@@ -1251,22 +1134,26 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 	else
 	{
 		// Generate the children
-		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		std::vector< ConstructionNode >::const_iterator child;
+		for ( child = node.children.begin(); child != node.children.end(); ++child )
 		{
-			GenConstruction( obj->GetChild( i ), false );
+			GenConstruction( *child );
 		}
 	}
 }
 
-void PHPCodeGenerator::GenDestruction( PObjectBase obj )
+void PHPCodeGenerator::GenDestruction( const ObjectBaseVector& objects )
 {
-	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "PHP" ) );
-
-	if ( code_info )
+	for ( ObjectBaseVector::const_iterator it = objects.begin(); it != objects.end(); ++it )
 	{
-		_template = code_info->GetTemplate( wxT( "destruction" ) );
+		PObjectBase obj = *it;
+		PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "PHP" ) );
+		if ( !code_info )
+		{
+			continue;
+		}
 
+		wxString _template = code_info->GetTemplate( wxT( "destruction" ) );
 		if ( !_template.empty() )
 		{
 			PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
@@ -1277,68 +1164,31 @@ void PHPCodeGenerator::GenDestruction( PObjectBase obj )
 			}
 		}
 	}
-
-	// Process child widgets
-	for ( unsigned int i = 0; i < obj->GetChildCount() ; i++ )
-	{
-		PObjectBase child = obj->GetChild( i );
-		GenDestruction( child );
-	}
 }
 
-void PHPCodeGenerator::FindMacros( PObjectBase obj, std::vector<wxString>* macros )
+std::vector< wxString > PHPCodeGenerator::FilterMacros( const std::vector< wxString >& macros )
 {
-	// iterate through all of the properties of all objects, add the macros
-	// to the vector
-	unsigned int i;
+	std::vector< wxString > result;
+	result.reserve( macros.size() );
 
-	for ( i = 0; i < obj->GetPropertyCount(); i++ )
+	std::vector< wxString >::const_iterator it;
+	for ( it = macros.begin(); it != macros.end(); ++it )
 	{
-		PProperty prop = obj->GetProperty( i );
-		if ( prop->GetType() == PT_MACRO )
-		{
-			wxString value = prop->GetValue();
-			if( value.IsEmpty() ) continue;
+		wxString value = *it;
+		if( value.IsEmpty() ) continue;
 
-			// Skip wx IDs
-			if ( ( ! value.Contains( wxT("XRCID" ) ) ) &&
-				 ( m_predMacros.end() == m_predMacros.find( value ) ) )
-			{
-				if ( macros->end() == std::find( macros->begin(), macros->end(), value ) )
-				{
-					macros->push_back( value );
-				}
-			}
+		// Skip wx IDs
+		if ( m_predMacros.end() == m_predMacros.find( value ) )
+		{
+			result.push_back( value );
 		}
 	}
-
-	for ( i = 0; i < obj->GetChildCount(); i++ )
-	{
-		FindMacros( obj->GetChild( i ), macros );
-	}
-}
-
-void PHPCodeGenerator::FindEventHandlers(PObjectBase obj, EventVector &events)
-{
-  unsigned int i;
-  for (i=0; i < obj->GetEventCount(); i++)
-  {
-	PEvent event = obj->GetEvent(i);
-	if (!event->GetValue().IsEmpty())
-	  events.push_back(event);
-  }
-
-  for (i=0; i < obj->GetChildCount(); i++)
-  {
-	PObjectBase child = obj->GetChild(i);
-	FindEventHandlers(child,events);
-  }
+	return result;
 }
 
 void PHPCodeGenerator::GenDefines( PObjectBase project)
 {
-	std::vector< wxString > macros;
-	FindMacros( project, &macros );
+	std::vector< wxString > macros = FilterMacros( m_analysis->GetMacros() );
 
 	// Remove the default macro from the set, for backward compatiblity
 	std::vector< wxString >::iterator it;
@@ -70,6 +70,7 @@ public:
 	PTemplateParser CreateParser(const TemplateParser* oldparser, wxString _template) override;
 	wxString RootWxParentToCode() override;
 	wxString ValueToCode(PropertyType type, wxString value) override;
+	wxString GetLanguage() const override { return wxT("PHP"); }
 };
 
 /**
@@ -100,20 +101,10 @@ private:
 	wxString GetCode( PObjectBase obj, wxString name, bool silent = false);
 
 	/**
-	* Stores the project's objects classes set, for generating the includes.
+	* Removes the predefined macros from the macros found by the project analysis,
+	* so that the related '#define' can be generated for the others.
 	*/
-	void FindDependencies( PObjectBase obj, std::set< PObjectInfo >& info_set );
-
-	/**
-	* Stores all the properties for "macro" type objects, so that their
-	* related '#define' can be generated subsequently.
-	*/
-	void FindMacros( PObjectBase obj, std::vector< wxString >* macros );
-
-	/**
-	 * Looks for "non-null" event handlers (PEvent) and collects it into a vector.
-	 */
-	void FindEventHandlers(PObjectBase obj, EventVector &events);
+	std::vector< wxString > FilterMacros( const std::vector< wxString >& macros );
 
 	/**
 	* Generates classes declarations inside the header file.
@@ -133,24 +124,21 @@ private:
 	/**
 	* Generates the generated_event_handlers template
 	*/
-	void GetGenEventHandlers( PObjectBase obj );
+	void GetGenEventHandlers( const ObjectBaseVector& objects );
 	/**
 	* Generates the generated_event_handlers template
 	*/
 	void GenDefinedEventHandlers( PObjectInfo info, PObjectBase obj );
 
 	/**
-	* Generates the 'import' section for files.
+	* Parses the PHP include template of a class for an object.
 	*/
-	void GenIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::vector< wxString >* includes, std::set< wxString >* templates );
-	void AddUniqueIncludes( const wxString& include, std::vector< wxString >* includes );
+	wxString GetIncludeTemplate( PObjectInfo info, PObjectBase obj ) override;
 
 	/**
-	* Generate a set of all subclasses to forward declare in the generated file.
+	* Adds the include of the subclass of an object.
 	*/
-	void GenSubclassSets( PObjectBase obj, std::set< wxString >* subclasses, std::vector< wxString >* headerIncludes );
+	void CollectSubclass( PObjectBase obj, ProjectDependencies* deps ) override;
 
 	/**
 	* Generates the '#define' section for macros.
@@ -169,14 +157,15 @@ private:
 
 	/**
 	* Makes the objects construction, setting up the objects' and Layout properties.
-	* The algorithm is simmilar to that used in the designer preview generation.
+	* The algorithm is simmilar to that used in the designer preview generation,
+	* the decisions are taken from the construction plan of the project analysis.
 	*/
-	void GenConstruction( PObjectBase obj, bool is_widget );
+	void GenConstruction( const ConstructionNode& node );
 
 	/**
 	* Makes the objects destructions.
 	*/
-	void GenDestruction( PObjectBase obj);
+	void GenDestruction( const ObjectBaseVector& objects );
 
 	/**
 	* Configures the object properties, both own and inherited ones.
@@ -0,0 +1,334 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "projectanalysis.h"
+
+#include "../model/database.h"
+#include "../model/objectbase.h"
+#include "../rad/appdata.h"
+#include "../utils/debug.h"
+#include "../utils/profiler.h"
+#include "../utils/wxfbexception.h"
+
+namespace
+{
+	// Analyses of the project open in the application and of its copies, valid while its change stamp is current
+	struct AnalysisCache
+	{
+		std::weak_ptr< ObjectBase > source;
+		unsigned long stamp;
+
+		// Shared by the analyses of the source and of its copies
+		ProjectAnalysis::FormMap forms;
+
+		// By the forms of the analysed project, a copy may have less forms than the source
+		std::map< std::vector< ObjectBase* >, PProjectAnalysis > projects;
+
+		AnalysisCache() : stamp( 0 ) {}
+	};
+	AnalysisCache s_cache;
+
+	// The code panels generate from a shallow copy of the project, which shares its properties and forms
+	bool IsCopyOf( PObjectBase project, PObjectBase source )
+	{
+		if ( project == source )
+		{
+			return true;
+		}
+
+		if ( project->GetPropertyCount() != source->GetPropertyCount() )
+		{
+			return false;
+		}
+
+		for ( unsigned int i = 0; i < project->GetPropertyCount(); i++ )
+		{
+			if ( project->GetProperty( i ) != source->GetProperty( i ) )
+			{
+				return false;
+			}
+		}
+
+		for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
+		{
+			if ( project->GetChild( i )->GetParent() != source )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void AddProperties( PObjectBase obj, UniqueLines* macros, std::vector< PProperty >* bitmaps )
+	{
+		for ( unsigned int i = 0; i < obj->GetPropertyCount(); i++ )
+		{
+			PProperty prop = obj->GetProperty( i );
+			switch ( prop->GetType() )
+			{
+				case PT_MACRO:
+				{
+					// Skip wx IDs
+					wxString value = prop->GetValue();
+					if ( !value.Contains( wxT("XRCID") ) )
+					{
+						macros->AddUnique( value );
+					}
+					break;
+				}
+				case PT_BITMAP:
+					bitmaps->push_back( prop );
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	bool IsPage( const wxString& type )
+	{
+		return ( type == wxT("notebookpage")		||
+				 type == wxT("flatnotebookpage")	||
+				 type == wxT("listbookpage")		||
+				 type == wxT("choicebookpage")		||
+				 type == wxT("simplebookpage")		||
+				 type == wxT("auinotebookpage") );
+	}
+}
+
+ConstructionNode::ConstructionNode( PObjectBase obj, bool widgetParent )
+:
+object( obj ),
+type( obj->GetObjectTypeName() ),
+kind( NODE_CHILDREN ),
+parentIsWidget( widgetParent ),
+isSizer( false )
+{
+	PObjectInfo info = obj->GetObjectInfo();
+
+	if ( ObjectDatabase::HasCppProperties( type ) )
+	{
+		kind = NODE_OBJECT;
+		isSizer = info->IsSubclassOf( wxT("sizer") );
+
+		children.reserve( obj->GetChildCount() );
+		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		{
+			children.push_back( ConstructionNode( obj->GetChild( i ), !isSizer ) );
+		}
+	}
+	else if ( info->IsSubclassOf( wxT("sizeritembase") ) )
+	{
+		// The child must be added to the sizer having in mind the
+		// child object type (there are 3 different routines)
+		kind = NODE_SIZERITEM;
+		PObjectBase child = obj->GetChild( 0 );
+		children.push_back( ConstructionNode( child, false ) );
+
+		PObjectInfo childInfo = child->GetObjectInfo();
+		if ( childInfo->IsSubclassOf( wxT("wxWindow") ) || wxT("CustomControl") == childInfo->GetClassName() )
+		{
+			addTemplate = wxT("window_add");
+		}
+		else if ( childInfo->IsSubclassOf( wxT("sizer") ) )
+		{
+			addTemplate = wxT("sizer_add");
+		}
+		else if ( childInfo->GetClassName() == wxT("spacer") )
+		{
+			addTemplate = wxT("spacer_add");
+		}
+		else
+		{
+			LogDebug( wxT("SizerItem child is not a Spacer and is not a subclass of wxWindow or of sizer.") );
+		}
+	}
+	else if ( IsPage( type ) )
+	{
+		kind = NODE_PAGE;
+		children.push_back( ConstructionNode( obj->GetChild( 0 ), false ) );
+	}
+	else if ( type == wxT("treelistctrlcolumn") )
+	{
+		kind = NODE_COLUMN;
+	}
+	else if ( type == wxT("tool") )
+	{
+		kind = NODE_TOOL;
+	}
+	else
+	{
+		children.reserve( obj->GetChildCount() );
+		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		{
+			children.push_back( ConstructionNode( obj->GetChild( i ), false ) );
+		}
+	}
+}
+
+ProjectAnalysis::Form::Form( PObjectBase form )
+:
+m_form( form )
+{
+	Analyze( form );
+
+	m_construction.reserve( form->GetChildCount() );
+	for ( unsigned int i = 0; i < form->GetChildCount(); i++ )
+	{
+		m_construction.push_back( ConstructionNode( form->GetChild( i ), true ) );
+	}
+}
+
+void ProjectAnalysis::Form::Analyze( PObjectBase obj )
+{
+	m_objects.push_back( obj );
+	AddProperties( obj, &m_macros, &m_bitmaps );
+
+	for ( unsigned int i = 0; i < obj->GetEventCount(); i++ )
+	{
+		PEvent event = obj->GetEvent( i );
+		if ( !event->GetValue().IsEmpty() )
+		{
+			m_events.push_back( event );
+		}
+	}
+
+	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+	{
+		Analyze( obj->GetChild( i ) );
+	}
+}
+
+ProjectAnalysis::ProjectAnalysis( PObjectBase project, FormMap* formCache )
+:
+m_project( project )
+{
+	ProfileScope profile( wxT("ProjectAnalysis::ProjectAnalysis") );
+
+	if ( !project )
+	{
+		return;
+	}
+
+	AddProperties( project, &m_macros, &m_bitmaps );
+
+	m_forms.reserve( project->GetChildCount() );
+	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
+	{
+		PObjectBase child = project->GetChild( i );
+		PForm form;
+		if ( formCache )
+		{
+			FormMap::iterator cached = formCache->find( child.get() );
+			if ( cached != formCache->end() )
+			{
+				form = cached->second;
+			}
+		}
+		if ( !form )
+		{
+			form.reset( new Form( child ) );
+			if ( formCache )
+			{
+				formCache->insert( FormMap::value_type( child.get(), form ) );
+			}
+		}
+
+		m_forms.push_back( form );
+		m_formIndex.insert( FormMap::value_type( child.get(), form ) );
+
+		std::vector< wxString >::const_iterator macro;
+		for ( macro = form->GetMacros().begin(); macro != form->GetMacros().end(); ++macro )
+		{
+			m_macros.AddUnique( *macro );
+		}
+		m_bitmaps.insert( m_bitmaps.end(), form->GetBitmaps().begin(), form->GetBitmaps().end() );
+	}
+}
+
+PProjectAnalysis ProjectAnalysis::Get( PObjectBase project )
+{
+	PObjectBase source = AppData()->GetProjectData();
+	if ( !project || !source || !IsCopyOf( project, source ) )
+	{
+		return PProjectAnalysis( new ProjectAnalysis( project ) );
+	}
+
+	unsigned long stamp = AppData()->GetChangeStamp();
+	if ( s_cache.source.lock() != source || s_cache.stamp != stamp )
+	{
+		s_cache.forms.clear();
+		s_cache.projects.clear();
+		s_cache.source = source;
+		s_cache.stamp = stamp;
+	}
+
+	std::vector< ObjectBase* > forms;
+	forms.reserve( project->GetChildCount() );
+	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
+	{
+		forms.push_back( project->GetChild( i ).get() );
+	}
+
+	PProjectAnalysis& analysis = s_cache.projects[ forms ];
+	if ( !analysis )
+	{
+		analysis.reset( new ProjectAnalysis( project, &s_cache.forms ) );
+	}
+
+	return analysis;
+}
+
+const ProjectAnalysis::Form& ProjectAnalysis::GetForm( PObjectBase form ) const
+{
+	FormMap::const_iterator it = m_formIndex.find( form.get() );
+	if ( it != m_formIndex.end() )
+	{
+		return *it->second;
+	}
+
+	THROW_WXFBEX( wxT("The object is not a form of the analysed project") );
+}
+
+const ProjectAnalysis::Form* ProjectAnalysis::FindForm( PObjectBase obj ) const
+{
+	for ( ; obj; obj = obj->GetParent() )
+	{
+		FormMap::const_iterator it = m_formIndex.find( obj.get() );
+		if ( it != m_formIndex.end() )
+		{
+			return it->second.get();
+		}
+	}
+	return NULL;
+}
+
+const wxString* ProjectAnalysis::Form::FindCode( PObjectBase obj, const wxString& key ) const
+{
+	CodeMap::const_iterator it = m_code.find( CodeMap::key_type( obj.get(), key ) );
+	return ( it != m_code.end() ? &it->second : NULL );
+}
+
+void ProjectAnalysis::Form::AddCode( PObjectBase obj, const wxString& key, const wxString& code ) const
+{
+	m_code[ CodeMap::key_type( obj.get(), key ) ] = code;
+}
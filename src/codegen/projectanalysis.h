@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECT_ANALYSIS__
+#define __PROJECT_ANALYSIS__
+
+#include "codegen.h"
+
+#include <map>
+
+/**
+* Language independent construction plan of one object, the lowered form of the object tree
+* that the code generators print the constructor code from.
+*
+* Deciding how an object is constructed needs its type name, the list of types with code
+* properties and walks of its base classes. The plan records the outcome once per form, so
+* each language only has to expand its own templates, whose results are cached in the
+* analysis of the form as well, see ProjectAnalysis::Form::FindCode().
+*/
+class ConstructionNode
+{
+public:
+	enum Kind
+	{
+		/// Object with code properties: construction and settings, then its children
+		NODE_OBJECT,
+		/// Sizer item: constructs its child, then adds it to the sizer with addTemplate
+		NODE_SIZERITEM,
+		/// Book page: constructs its child, then adds the page and applies the settings
+		NODE_PAGE,
+		/// Column of a tree list control: adds the column and applies the settings
+		NODE_COLUMN,
+		/// Toolbar tool without code properties
+		NODE_TOOL,
+		/// Generates nothing but its children
+		NODE_CHILDREN
+	};
+
+	PObjectBase object;
+	wxString type;
+	Kind kind;
+
+	/// The parent is a window, so a sizer has to be set to it
+	bool parentIsWidget;
+
+	/// NODE_OBJECT: the object is a sizer and its children are sizer items
+	bool isSizer;
+
+	/// NODE_SIZERITEM: "window_add", "sizer_add" or "spacer_add", empty if the item holds anything else
+	wxString addTemplate;
+
+	std::vector< ConstructionNode > children;
+
+	ConstructionNode( PObjectBase obj, bool widgetParent );
+};
+
+/**
+* Language independent summary of a project, built by a single walk of the object tree.
+*
+* The code generators read the macros, event handlers, bitmaps and object lists they need
+* from here instead of walking the tree again for each phase. The analyses of the project
+* open in the application, and of the copies of it the code panels generate from, are
+* cached until ApplicationData reports a change, each form being analysed only once, so
+* generating the code of all the languages after an edit only analyses the project once.
+*/
+class ProjectAnalysis
+{
+public:
+	/**
+	* Summary of one form (a top level object of the project).
+	*/
+	class Form
+	{
+	private:
+		PObjectBase m_form;
+		ObjectBaseVector m_objects;
+		UniqueLines m_macros;
+		EventVector m_events;
+		std::vector< PProperty > m_bitmaps;
+		std::vector< ConstructionNode > m_construction;
+
+		// Expanded templates of the objects of the form, by object and by language, template and options
+		typedef std::map< std::pair< ObjectBase*, wxString >, wxString > CodeMap;
+		mutable CodeMap m_code;
+
+		void Analyze( PObjectBase obj );
+
+	public:
+		explicit Form( PObjectBase form );
+
+		PObjectBase GetForm() const { return m_form; }
+
+		/// The form and all of its descendants, each object before its children
+		const ObjectBaseVector& GetObjects() const { return m_objects; }
+
+		/// Values of the PT_MACRO properties in order of first use, XRCID macros excluded
+		const std::vector< wxString >& GetMacros() const { return m_macros.GetLines(); }
+
+		/// Events with a handler, in the order of GetObjects()
+		const EventVector& GetEvents() const { return m_events; }
+
+		/// PT_BITMAP properties, in the order of GetObjects()
+		const std::vector< PProperty >& GetBitmaps() const { return m_bitmaps; }
+
+		/// Construction plan of the children of the form, the form itself is built by its own templates
+		const std::vector< ConstructionNode >& GetConstruction() const { return m_construction; }
+
+		/**
+		* Code of a template of an object of the form, as expanded by an earlier generation.
+		* @param key The language, the template and the options of the expansion.
+		* @return NULL if it was not expanded with this key yet.
+		*/
+		const wxString* FindCode( PObjectBase obj, const wxString& key ) const;
+
+		/// Keeps the code of a template of an object of the form for FindCode()
+		void AddCode( PObjectBase obj, const wxString& key, const wxString& code ) const;
+	};
+
+	typedef std::shared_ptr< const Form > PForm;
+	typedef std::map< ObjectBase*, PForm > FormMap;
+
+private:
+	PObjectBase m_project;
+	std::vector< PForm > m_forms;
+	FormMap m_formIndex;
+	UniqueLines m_macros;
+	std::vector< PProperty > m_bitmaps;
+
+public:
+	/**
+	* @param formCache Analyses of forms to reuse, the forms analysed here are added to it. Can be NULL.
+	*/
+	explicit ProjectAnalysis( PObjectBase project, FormMap* formCache = NULL );
+
+	/**
+	* Gets the analysis of a project. The analysis of the project open in the application, or
+	* of a copy of it sharing its properties and forms, is cached while the project is not
+	* modified, any other object tree is analysed on every call.
+	*/
+	static PProjectAnalysis Get( PObjectBase project );
+
+	PObjectBase GetProject() const { return m_project; }
+
+	/// One entry per child of the project, in the same order
+	const std::vector< PForm >& GetForms() const { return m_forms; }
+
+	/// The summary of a child of the project, throws a wxFBException if form is not one of them
+	const Form& GetForm( PObjectBase form ) const;
+
+	/// The summary of the form holding obj, NULL if obj is the project or not part of it
+	const Form* FindForm( PObjectBase obj ) const;
+
+	/// Macros of the project and all of its forms, in order of first use
+	const std::vector< wxString >& GetMacros() const { return m_macros.GetLines(); }
+
+	/// PT_BITMAP properties of the project and all of its forms
+	const std::vector< PProperty >& GetBitmaps() const { return m_bitmaps; }
+};
+
+#endif //__PROJECT_ANALYSIS__
@@ -26,207 +26,276 @@
 #include "xrccg.h"
 
 #include "../model/objectbase.h"
-#include "../utils/typeconv.h"
+#include "../utils/profiler.h"
 #include "codewriter.h"
+#include "xrcwriter.h"
+#include "xrsarchive.h"
 
 #include <ticpp.h>
 
+struct XrcCodeGenerator::PendingElement
+{
+	XrcElement element;
+	PendingElement* parent;
+	bool written;
+
+	explicit PendingElement( PendingElement* parentElement )
+	:
+	parent( parentElement ),
+	written( false )
+	{
+	}
+};
+
+XrcCodeGenerator::XrcCodeGenerator()
+:
+m_contextMenus( NULL ),
+m_compact( false ),
+m_archive( NULL )
+{
+}
+
 void XrcCodeGenerator::SetWriter( PCodeWriter cw )
 {
 	m_cw = cw;
 }
 
+void XrcCodeGenerator::SetCompact( bool compact )
+{
+	m_compact = compact;
+}
+
+void XrcCodeGenerator::SetArchive( XrsArchive* archive )
+{
+	m_archive = archive;
+}
+
 bool XrcCodeGenerator::GenerateCode( PObjectBase project )
 {
+	ProfileScope profile( wxT("XrcCodeGenerator::GenerateCode") );
+
 	m_cw->Clear();
-	m_contextMenus.clear();
 
-	ticpp::Document doc;
-	ticpp::Declaration decl( "1.0", "UTF-8", "yes" );
-	doc.LinkEndChild( &decl );
+	XrcStreamWriter out( m_cw.get(), 0, m_compact );
+	XrcStreamWriter contextMenus( NULL, 1, m_compact );
+	m_contextMenus = &contextMenus;
 
-	ticpp::Element element( "resource" );
-	element.SetAttribute( "xmlns", "http://www.wxwindows.org/wxxrc" );
-	element.SetAttribute( "version", "2.3.0.1" );
+	out.WriteDeclaration();
+	out.StartElement( wxT("resource") );
+	out.AddAttribute( wxT("xmlns"), wxT("http://www.wxwindows.org/wxxrc") );
+	out.AddAttribute( wxT("version"), wxT("2.3.0.1") );
 
 	// If project is not actually a "Project", generate it
 	if ( project->GetClassName() == wxT("Project") )
 	{
 		for( unsigned int i = 0; i < project->GetChildCount(); i++ )
 		{
-			ticpp::Element* child = GetElement( project->GetChild( i ) );
-			if ( child )
-			{
-				element.LinkEndChild( child );
-				delete child;
-			}
+			WriteObject( project->GetChild( i ), out, NULL );
 		}
 	}
 	else
 	{
-		ticpp::Element* child = GetElement( project );
-		if ( child )
-		{
-			element.LinkEndChild( child );
-			delete child;
-		}
+		WriteObject( project, out, NULL );
 	}
 
 	// generate context menus as top-level menus
-	for( std::vector<ticpp::Element*>::iterator it = m_contextMenus.begin(); it != m_contextMenus.end(); ++it )
-	{
-		element.LinkEndChild( *it );
-		delete *it;
-	}
+	out.AddMarkup( contextMenus.GetString() );
+	m_contextMenus = NULL;
 
-	doc.LinkEndChild( &element );
+	out.EndElement();
+	out.Flush();
 
-	TiXmlPrinter printer;
-	printer.SetIndent( "\t" );
+	return true;
+}
 
-	printer.SetLineBreak("\n");
+void XrcCodeGenerator::Open( PendingElement* pending, XrcStreamWriter& out )
+{
+	if ( pending && !pending->written )
+	{
+		Open( pending->parent, out );
+		pending->element.Write( out, false );
+		pending->written = true;
+	}
+}
 
-	doc.Accept( &printer );
-	const std::string& xrcFile = printer.Str();
+void XrcCodeGenerator::Close( PendingElement& pending, XrcStreamWriter& out )
+{
+	Open( &pending, out );
+	out.EndElement();
+}
 
-	m_cw->Write( _WXSTR( xrcFile ) );
+void XrcCodeGenerator::PackBitmaps( PObjectBase obj, XrcElement& element )
+{
+	// The files as ObjectToXrcFilter writes them, art provider bitmaps and bitmaps
+	// loaded from other resources are not files
+	std::set< wxString > files;
+	for ( unsigned int i = 0; i < obj->GetPropertyCount(); i++ )
+	{
+		PProperty prop = obj->GetProperty( i );
+		if ( PT_BITMAP != prop->GetType() )
+		{
+			continue;
+		}
 
-	return true;
+		wxString value = prop->GetValue();
+		if ( value.StartsWith( _("Load From File") ) || value.StartsWith( _("Load From Embedded File") ) )
+		{
+			wxString file = value.AfterFirst( wxT(';') ).Trim().Trim( false );
+			if ( !file.empty() )
+			{
+				files.insert( file );
+			}
+		}
+	}
 
+	if ( !files.empty() )
+	{
+		PackBitmapFiles( files, element );
+	}
 }
 
+void XrcCodeGenerator::PackBitmapFiles( const std::set< wxString >& files, XrcElement& element )
+{
+	for ( std::vector< XrcElement >::iterator child = element.children.begin(); child != element.children.end(); ++child )
+	{
+		if ( child->hasText && child->children.empty() && files.count( child->text ) != 0 )
+		{
+			const wxString entry = m_archive->AddFile( child->text );
+			if ( !entry.empty() )
+			{
+				child->text = entry;
+			}
+		}
+		else
+		{
+			PackBitmapFiles( files, *child );
+		}
+	}
+}
 
-ticpp::Element* XrcCodeGenerator::GetElement( PObjectBase obj, ticpp::Element* parent )
+bool XrcCodeGenerator::WriteObject( PObjectBase obj, XrcStreamWriter& out, PendingElement* parent )
 {
-	ticpp::Element *element = NULL;
+	PendingElement pending( parent );
+	XrcElementWriter writer( &pending.element );
 
 	IComponent *comp = obj->GetObjectInfo()->GetComponent();
-
-	if ( comp )
-		element = comp->ExportToXrc( obj.get() );
-
-	if ( element )
+	if ( comp && !comp->WriteXrc( obj.get(), &writer ) )
 	{
-		std::string class_name = element->GetAttribute( "class" );
-		if ( class_name == "__dummyitem__" )
+		// Components that only build a ticpp element
+		ticpp::Element* element = comp->ExportToXrc( obj.get() );
+		if ( element )
 		{
+			writer.AddElement( *element );
 			delete element;
-			element = NULL;
+		}
+	}
 
-			if ( obj->GetChildCount() > 0 )
-				element = GetElement( obj->GetChild( 0 ) );
+	if ( !writer.HasElement() )
+	{
+		if( obj->GetObjectTypeName() != wxT("nonvisual") )
+		{
+			// The componenet does not XRC
+			pending.element = XrcElement( wxT("object") );
+			pending.element.SetAttribute( wxT("class"), wxT("unknown") );
+			pending.element.SetAttribute( wxT("name"), obj->GetPropertyAsString( _( "name" ) ) );
+			Close( pending, out );
+			return true;
+		}
+		return false;
+	}
+
+	if ( m_archive )
+	{
+		PackBitmaps( obj, pending.element );
+	}
 
-			return element;
+	const wxString class_name = pending.element.GetAttribute( wxT("class") );
+	if ( class_name == wxT("__dummyitem__") )
+	{
+		if ( obj->GetChildCount() > 0 )
+		{
+			return WriteObject( obj->GetChild( 0 ), out, parent );
 		}
-		else if ( class_name == "spacer" )
+		return false;
+	}
+	else if ( class_name == wxT("spacer") )
+	{
+		// Dirty hack to replace the containing sizeritem with the spacer
+		if ( parent && !parent->written )
 		{
-			// Dirty hack to replace the containing sizeritem with the spacer
-			if ( parent )
+			parent->element.SetAttribute( wxT("class"), wxT("spacer") );
+			parent->element.children.insert( parent->element.children.end(), pending.element.children.begin(), pending.element.children.end() );
+			return false;
+		}
+	}
+	else if ( class_name == wxT("wxFrame") )
+	{
+		// Dirty hack to prevent sizer generation directly under a wxFrame
+		// If there is a sizer, the size property of the wxFrame is ignored
+		// when loading the xrc file at runtime
+		if (obj->GetPropertyAsInteger(_("xrc_skip_sizer")) != 0) {
+			for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
 			{
-				parent->SetAttribute( "class", "spacer" );
-				for ( ticpp::Node* child = element->FirstChild( false ); child; child = child->NextSibling( false ) )
-				{
-					parent->LinkEndChild( child->Clone().release() );
-				}
-				delete element;
-				return NULL;
-			}
+				bool written = false;
 
-		}
-		else if ( class_name == "wxFrame" )
-		{
-			// Dirty hack to prevent sizer generation directly under a wxFrame
-			// If there is a sizer, the size property of the wxFrame is ignored
-			// when loading the xrc file at runtime
-			if (obj->GetPropertyAsInteger(_("xrc_skip_sizer")) != 0) {
-				for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+				PObjectBase child = obj->GetChild( i );
+				if ( child->GetObjectInfo()->IsSubclassOf( wxT("sizer") ) )
 				{
-					ticpp::Element* aux = NULL;
-
-					PObjectBase child = obj->GetChild( i );
-					if ( child->GetObjectInfo()->IsSubclassOf( wxT("sizer") ) )
+					if ( child->GetChildCount() == 1 )
 					{
-						if ( child->GetChildCount() == 1 )
+						PObjectBase sizeritem = child->GetChild( 0 );
+						if ( sizeritem && sizeritem->GetChildCount() > 0 )
 						{
-							PObjectBase sizeritem = child->GetChild( 0 );
-							if ( sizeritem )
-							{
-								aux = GetElement( sizeritem->GetChild( 0 ), element );
-							}
+							written = WriteObject( sizeritem->GetChild( 0 ), out, &pending );
 						}
 					}
-
-					if ( !aux )
-					{
-						aux = GetElement( child, element );
-					}
-
-					if ( aux )
-					{
-						element->LinkEndChild( aux );
-						delete aux;
-					}
 				}
-				return element;
-			}
-		}
-		else if( class_name == "wxMenu" )
-		{
-			// Do not generate context menus assigned to forms or widgets
-			std::string parent_name = parent->GetAttribute( "class" );
-			if( (parent_name != "wxMenuBar") && (parent_name != "wxMenu") )
-			{
-				// insert context menu into vector for delayed processing (context menus will be generated as top-level menus)
-				for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+
+				if ( !written )
 				{
-					ticpp::Element *aux = GetElement( obj->GetChild( i ), element );
-					if ( aux )
-					{
-						element->LinkEndChild( aux );
-						delete aux;
-					}
+					WriteObject( child, out, &pending );
 				}
-
-				m_contextMenus.push_back( element );
-				return NULL;
 			}
+			Close( pending, out );
+			return true;
 		}
-		else if ( class_name == "wxCollapsiblePane" )
-		{
-			ticpp::Element *aux = new ticpp::Element( "object" );
-			aux->SetAttribute( "class", "panewindow" );
-
-			ticpp::Element *child = GetElement( obj->GetChild( 0 ), aux );
-
-			aux->LinkEndChild( child );
-			element->LinkEndChild( aux );
-
-			delete aux;
-			delete child;
-
-			return element;
-		}
-
-		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+	}
+	else if( class_name == wxT("wxMenu") )
+	{
+		// Do not generate context menus assigned to forms or widgets
+		wxString parent_name = ( parent ? parent->element.GetAttribute( wxT("class") ) : wxString() );
+		if( (parent_name != wxT("wxMenuBar")) && (parent_name != wxT("wxMenu")) )
 		{
-			ticpp::Element *aux = GetElement( obj->GetChild( i ), element );
-			if ( aux )
+			// write the context menu for delayed processing (context menus will be generated as top-level menus)
+			pending.parent = NULL;
+			for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
 			{
-				element->LinkEndChild( aux );
-				delete aux;
+				WriteObject( obj->GetChild( i ), *m_contextMenus, &pending );
 			}
+			Close( pending, *m_contextMenus );
+			return false;
 		}
 	}
-	else
+	else if ( class_name == wxT("wxCollapsiblePane") )
 	{
-		if( obj->GetObjectTypeName() != wxT("nonvisual") )
+		PendingElement pane( &pending );
+		pane.element = XrcElement( wxT("object") );
+		pane.element.SetAttribute( wxT("class"), wxT("panewindow") );
+
+		if ( obj->GetChildCount() > 0 )
 		{
-			// The componenet does not XRC
-			element = new ticpp::Element( "object" );
-			element->SetAttribute( "class", "unknown" );
-			element->SetAttribute( "name", _STDSTR( obj->GetPropertyAsString( _( "name" ) ) ) );
+			WriteObject( obj->GetChild( 0 ), out, &pane );
 		}
+
+		Close( pane, out );
+		Close( pending, out );
+		return true;
 	}
 
-	return element;
+	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+	{
+		WriteObject( obj->GetChild( i ), out, &pending );
+	}
+	Close( pending, out );
+	return true;
 }
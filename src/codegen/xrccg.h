@@ -28,25 +28,56 @@
 
 #include "codegen.h"
 
-namespace ticpp
-{
-	class Element;
-}
+class XrcElement;
+class XrcStreamWriter;
+class XrsArchive;
 
 /// XRC code generator.
 
 class XrcCodeGenerator : public CodeGenerator
 {
 private:
+	/// Element of an object, written when its first child is written or when it ends
+	struct PendingElement;
+
 	PCodeWriter m_cw;
-	std::vector<ticpp::Element*> m_contextMenus;
 
-	ticpp::Element* GetElement( PObjectBase obj, ticpp::Element* parent = NULL );
+	// Context menus are written at the end, as top-level menus
+	XrcStreamWriter* m_contextMenus;
+
+	bool m_compact;
+	XrsArchive* m_archive;
+
+	/**
+	* Writes the object and its children. Components write their element through
+	* IComponent::WriteXrc, or through IComponent::ExportToXrc if they don't support it.
+	* @return true if an element was written (or merged) in place of the object.
+	*/
+	bool WriteObject( PObjectBase obj, XrcStreamWriter& out, PendingElement* parent );
+
+	void Open( PendingElement* pending, XrcStreamWriter& out );
+	void Close( PendingElement& pending, XrcStreamWriter& out );
+
+	/**
+	* Adds the bitmap files of the element of an object to the archive, replacing their paths by
+	* the name of their entry. Only the texts which are the files of PT_BITMAP properties of the
+	* object are packed, the XRC names of these properties depend on the component.
+	*/
+	void PackBitmaps( PObjectBase obj, XrcElement& element );
+	void PackBitmapFiles( const std::set< wxString >& files, XrcElement& element );
 
 public:
+	XrcCodeGenerator();
+
 	/// Configures the code writer for the XML file.
 	void SetWriter( PCodeWriter cw );
 
+	/// Writes the XML without indentation nor line breaks between the elements.
+	void SetCompact( bool compact );
+
+	/// Collects the bitmaps referenced by the forms in an .xrs archive, the XRC refers to them by their entry.
+	void SetArchive( XrsArchive* archive );
+
 	/// Generates the XRC code for the project.
 	bool GenerateCode(PObjectBase project) override;
 };
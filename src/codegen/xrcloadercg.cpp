@@ -0,0 +1,358 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "xrcloadercg.h"
+
+#include "../model/objectbase.h"
+#include "../utils/profiler.h"
+#include "../utils/wxfbexception.h"
+#include "../utils/xmlreader.h"
+#include "codewriter.h"
+#include "xrccg.h"
+
+namespace
+{
+	// Node array of the generated code, the start of an element is followed by the index
+	// of its name, its attribute count and the indexes of the names and values of its attributes
+	const size_t NODE_END = 0;
+	const size_t NODE_START = 1;
+	const size_t NODE_TEXT = 2;
+
+	wxString ToIdentifier( const wxString& name )
+	{
+		wxString identifier;
+		for ( wxString::const_iterator c = name.begin(); c != name.end(); ++c )
+		{
+			const wxChar ch = *c;
+			const bool valid = ( ch >= wxT('a') && ch <= wxT('z') ) || ( ch >= wxT('A') && ch <= wxT('Z') ) ||
+							   ( ch >= wxT('0') && ch <= wxT('9') ) || ch == wxT('_');
+			identifier << ( valid ? ch : wxT('_') );
+		}
+		return identifier;
+	}
+
+	/// C string literal of UTF-8 text, bytes out of printable ASCII are written as octal escapes
+	wxString ToLiteral( const std::string& value )
+	{
+		wxString literal( wxT("\"") );
+		char previous = 0;
+		for ( std::string::const_iterator c = value.begin(); c != value.end(); ++c )
+		{
+			const unsigned char ch = static_cast< unsigned char >( *c );
+			switch ( ch )
+			{
+				case '"':	literal << wxT("\\\"");	break;
+				case '\\':	literal << wxT("\\\\");	break;
+				case '\n':	literal << wxT("\\n");	break;
+				case '\t':	literal << wxT("\\t");	break;
+				case '?':
+					// Avoid trigraphs
+					literal << ( previous == '?' ? wxT("\\?") : wxT("?") );
+					break;
+				default:
+					if ( ch < 0x20 || ch >= 0x7F )
+					{
+						literal << wxString::Format( wxT("\\%03o"), ch );
+					}
+					else
+					{
+						literal << static_cast< wxChar >( ch );
+					}
+					break;
+			}
+			previous = *c;
+		}
+		literal << wxT("\"");
+		return literal;
+	}
+}
+
+void XrcLoaderCodeGenerator::SetHeaderWriter( PCodeWriter cw )
+{
+	m_header = cw;
+}
+
+void XrcLoaderCodeGenerator::SetSourceWriter( PCodeWriter cw )
+{
+	m_source = cw;
+}
+
+size_t XrcLoaderCodeGenerator::AddString( const std::string& value )
+{
+	std::map< std::string, size_t >::const_iterator found = m_stringIndexes.find( value );
+	if ( found != m_stringIndexes.end() )
+	{
+		return found->second;
+	}
+
+	m_stringIndexes[ value ] = m_strings.size();
+	m_strings.push_back( value );
+	return m_strings.size() - 1;
+}
+
+void XrcLoaderCodeGenerator::ParseXrc( const wxString& xrc )
+{
+	const wxScopedCharBuffer data = xrc.utf8_str();
+	XmlReader reader( data.data(), data.data() + data.length() );
+
+	size_t depth = 0;
+	bool root = false;
+	XmlReader::NodeType type;
+	while ( ( type = reader.Next() ) != XmlReader::NODE_END_OF_DOCUMENT )
+	{
+		switch ( type )
+		{
+			case XmlReader::NODE_START:
+			{
+				if ( 0 == depth && root )
+				{
+					THROW_WXFBEX( _("The generated XRC has more than one root element") )
+				}
+				root = true;
+				++depth;
+
+				const XmlReader::Attributes& attributes = reader.GetAttributes();
+				m_nodes.push_back( NODE_START );
+				m_nodes.push_back( AddString( reader.GetName() ) );
+				m_nodes.push_back( attributes.size() );
+				for ( XmlReader::Attributes::const_iterator it = attributes.begin(); it != attributes.end(); ++it )
+				{
+					m_nodes.push_back( AddString( it->first ) );
+					m_nodes.push_back( AddString( it->second ) );
+				}
+				break;
+			}
+			case XmlReader::NODE_END:
+				if ( 0 == depth )
+				{
+					THROW_WXFBEX( _("The generated XRC closes an element which is not open") )
+				}
+				--depth;
+				m_nodes.push_back( NODE_END );
+				break;
+			case XmlReader::NODE_TEXT:
+				// wxXmlDocument drops the text which is only whitespace too
+				if ( depth > 0 && reader.GetText().find_first_not_of( " \t\n" ) != std::string::npos )
+				{
+					m_nodes.push_back( NODE_TEXT );
+					m_nodes.push_back( AddString( reader.GetText() ) );
+				}
+				break;
+			case XmlReader::NODE_END_OF_DOCUMENT:
+				break;
+		}
+	}
+
+	if ( depth > 0 || !root )
+	{
+		THROW_WXFBEX( _("The generated XRC is not a complete XML document") )
+	}
+}
+
+bool XrcLoaderCodeGenerator::GenerateCode( PObjectBase project )
+{
+	ProfileScope profile( wxT("XrcLoaderCodeGenerator::GenerateCode") );
+
+	wxString file = project->GetPropertyAsString( wxT("file") );
+	if ( file.empty() )
+	{
+		file = wxT("noname");
+	}
+
+	// The forms are described by the same XRC the XRC generator writes
+	PStringCodeWriter xrc( new StringCodeWriter );
+	XrcCodeGenerator codegen;
+	codegen.SetWriter( xrc );
+	codegen.SetCompact( true );
+	codegen.GenerateCode( project );
+
+	m_strings.clear();
+	m_stringIndexes.clear();
+	m_nodes.clear();
+	ParseXrc( xrc->GetString() );
+
+	const wxString function = wxT("InitXmlResource_") + ToIdentifier( file );
+	GenerateHeader( file, function );
+	GenerateSource( file, function );
+	return true;
+}
+
+void XrcLoaderCodeGenerator::GenerateHeader( const wxString& /*file*/, const wxString& function )
+{
+	m_header->Clear();
+	m_header->WriteLn( wxT("///////////////////////////////////////////////////////////////////////////") );
+	m_header->WriteLn( wxT("// C++ code generated with wxFormBuilder (version ") wxT(__DATE__) wxT(")") );
+	m_header->WriteLn( wxT("// http://www.wxformbuilder.org/") );
+	m_header->WriteLn( wxT("//") );
+	m_header->WriteLn( wxT("// PLEASE DO *NOT* EDIT THIS FILE!") );
+	m_header->WriteLn( wxT("///////////////////////////////////////////////////////////////////////////") );
+	m_header->WriteLn();
+	m_header->WriteLn( wxT("#pragma once") );
+	m_header->WriteLn();
+	m_header->WriteLn( wxT("/// Adds the forms of the project to wxXmlResource::Get(), without parsing any XML") );
+	m_header->WriteLn( wxT("bool ") + function + wxT("();") );
+}
+
+void XrcLoaderCodeGenerator::GenerateSource( const wxString& file, const wxString& function )
+{
+	m_source->Clear();
+	m_source->WriteLn( wxT("///////////////////////////////////////////////////////////////////////////") );
+	m_source->WriteLn( wxT("// C++ code generated with wxFormBuilder (version ") wxT(__DATE__) wxT(")") );
+	m_source->WriteLn( wxT("// http://www.wxformbuilder.org/") );
+	m_source->WriteLn( wxT("//") );
+	m_source->WriteLn( wxT("// PLEASE DO *NOT* EDIT THIS FILE!") );
+	m_source->WriteLn( wxT("///////////////////////////////////////////////////////////////////////////") );
+	m_source->WriteLn();
+	m_source->WriteLn( wxT("#include \"") + file + wxT("_xrc.h\"") );
+	m_source->WriteLn();
+	m_source->WriteLn( wxT("#include <wx/xml/xml.h>") );
+	m_source->WriteLn( wxT("#include <wx/xrc/xmlres.h>") );
+	m_source->WriteLn();
+	m_source->WriteLn( wxT("#include <vector>") );
+	m_source->WriteLn();
+
+	// wxXmlResource::LoadDocument appeared in wxWidgets 3.1.0
+	m_source->WriteLn( wxT("#if !wxCHECK_VERSION( 3, 1, 0 )") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("#error \"") + function + wxT(" needs wxWidgets 3.1.0 or later, generate an .xrc or .xrs file for older versions\"") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("#endif") );
+	m_source->WriteLn();
+	m_source->WriteLn( wxT("namespace") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+
+	m_source->WriteLn( wxT("// Names, attributes and text of the XRC, in UTF-8") );
+	m_source->WriteLn( wxT("const char* const strings[] =") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	for ( std::vector< std::string >::const_iterator it = m_strings.begin(); it != m_strings.end(); ++it )
+	{
+		m_source->WriteLn( ToLiteral( *it ) + wxT(",") );
+	}
+	m_source->Unindent();
+	m_source->WriteLn( wxT("};") );
+	m_source->WriteLn();
+
+	m_source->WriteLn( wxT("// Nodes in document order: 1 starts an element and is followed by its name, its attribute count") );
+	m_source->WriteLn( wxT("// and the names and values of its attributes, 2 is followed by a text, 0 ends an element") );
+	m_source->WriteLn( wxT("const unsigned int nodes[] =") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	const size_t perLine = 20;
+	for ( size_t i = 0; i < m_nodes.size(); i += perLine )
+	{
+		wxString line;
+		for ( size_t j = i; j < m_nodes.size() && j < i + perLine; ++j )
+		{
+			line << wxString::Format( wxT("%lu,"), static_cast< unsigned long >( m_nodes[j] ) );
+		}
+		m_source->WriteLn( line );
+	}
+	m_source->Unindent();
+	m_source->WriteLn( wxT("};") );
+	m_source->WriteLn();
+
+	m_source->WriteLn( wxT("void AppendChild( std::vector< wxXmlNode* >& parents, std::vector< wxXmlNode* >& lastChildren, wxXmlNode* node )") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("node->SetParent( parents.back() );") );
+	m_source->WriteLn( wxT("if ( lastChildren.back() )") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("lastChildren.back()->SetNext( node );") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->WriteLn( wxT("else") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("parents.back()->SetChildren( node );") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->WriteLn( wxT("lastChildren.back() = node;") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->WriteLn();
+
+	m_source->WriteLn( wxT("bool ") + function + wxT("()") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("wxXmlNode* root = NULL;") );
+	m_source->WriteLn( wxT("std::vector< wxXmlNode* > parents;") );
+	m_source->WriteLn( wxT("std::vector< wxXmlNode* > lastChildren;") );
+	m_source->WriteLn( wxT("for ( size_t i = 0; i < sizeof( nodes ) / sizeof( nodes[0] ); )") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("switch ( nodes[i++] )") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("case 1:") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("wxXmlNode* node = new wxXmlNode( wxXML_ELEMENT_NODE, wxString::FromUTF8( strings[ nodes[i++] ] ) );") );
+	m_source->WriteLn( wxT("for ( unsigned int count = nodes[i++]; count > 0; --count, i += 2 )") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("node->AddAttribute( wxString::FromUTF8( strings[ nodes[i] ] ), wxString::FromUTF8( strings[ nodes[i + 1] ] ) );") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->WriteLn( wxT("if ( parents.empty() )") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("root = node;") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->WriteLn( wxT("else") );
+	m_source->WriteLn( wxT("{") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("AppendChild( parents, lastChildren, node );") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->WriteLn( wxT("parents.push_back( node );") );
+	m_source->WriteLn( wxT("lastChildren.push_back( NULL );") );
+	m_source->WriteLn( wxT("break;") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->WriteLn( wxT("case 2:") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("AppendChild( parents, lastChildren, new wxXmlNode( wxXML_TEXT_NODE, wxEmptyString, wxString::FromUTF8( strings[ nodes[i++] ] ) ) );") );
+	m_source->WriteLn( wxT("break;") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("default:") );
+	m_source->Indent();
+	m_source->WriteLn( wxT("parents.pop_back();") );
+	m_source->WriteLn( wxT("lastChildren.pop_back();") );
+	m_source->WriteLn( wxT("break;") );
+	m_source->Unindent();
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+	m_source->WriteLn();
+	m_source->WriteLn( wxT("wxXmlDocument* doc = new wxXmlDocument;") );
+	m_source->WriteLn( wxT("doc->SetRoot( root );") );
+	m_source->WriteLn( wxT("return wxXmlResource::Get()->LoadDocument( doc, wxString::FromUTF8( ") + ToLiteral( std::string( ( file + wxT(".xrc") ).utf8_str() ) ) + wxT(" ) );") );
+	m_source->Unindent();
+	m_source->WriteLn( wxT("}") );
+}
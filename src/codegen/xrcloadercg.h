@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XRC_LOADER_CODE_GEN_
+#define _XRC_LOADER_CODE_GEN_
+
+#include "codegen.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+* Generates the XRC of the project as C++ code: a flat array describing its XML nodes, and
+* a function which builds the wxXmlDocument from the array and adds it to wxXmlResource::Get().
+*
+* The forms are then loaded with the usual wxXmlResource functions, by the same handlers,
+* but the application does not parse any XML. The XRC is checked when it is generated.
+*/
+class XrcLoaderCodeGenerator : public CodeGenerator
+{
+private:
+	PCodeWriter m_header;
+	PCodeWriter m_source;
+
+	std::vector< std::string > m_strings;
+	std::map< std::string, size_t > m_stringIndexes;
+	std::vector< size_t > m_nodes;
+
+	size_t AddString( const std::string& value );
+
+	/// Converts the XRC into the node array, throws wxFBException if it is not valid XML
+	void ParseXrc( const wxString& xrc );
+
+	void GenerateHeader( const wxString& file, const wxString& function );
+	void GenerateSource( const wxString& file, const wxString& function );
+
+public:
+	void SetHeaderWriter( PCodeWriter cw );
+	void SetSourceWriter( PCodeWriter cw );
+
+	/// Generates the loader of the project, the files are named after its "file" property.
+	bool GenerateCode( PObjectBase project ) override;
+};
+
+#endif //_XRC_LOADER_CODE_GEN_
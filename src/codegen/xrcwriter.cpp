@@ -0,0 +1,369 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "xrcwriter.h"
+
+#include "codewriter.h"
+
+#include <ticpp.h>
+
+namespace
+{
+	// Flush the text to the code writer in chunks of about this size
+	const size_t FLUSH_SIZE = 64 * 1024;
+
+	void ReplayElement( const TiXmlElement* element, IXrcWriter* writer )
+	{
+		writer->StartElement( wxString( element->Value(), wxConvUTF8 ) );
+
+		for ( const TiXmlAttribute* attribute = element->FirstAttribute(); attribute; attribute = attribute->Next() )
+		{
+			writer->AddAttribute( wxString( attribute->Name(), wxConvUTF8 ), wxString( attribute->Value(), wxConvUTF8 ) );
+		}
+
+		for ( const TiXmlNode* child = element->FirstChild(); child; child = child->NextSibling() )
+		{
+			if ( const TiXmlElement* childElement = child->ToElement() )
+			{
+				ReplayElement( childElement, writer );
+			}
+			else if ( const TiXmlText* text = child->ToText() )
+			{
+				writer->AddText( wxString( text->Value(), wxConvUTF8 ) );
+			}
+		}
+
+		writer->EndElement();
+	}
+}
+
+XrcElement::XrcElement( const wxString& elementName )
+:
+name( elementName ),
+hasText( false )
+{
+}
+
+wxString XrcElement::GetAttribute( const wxString& attribute ) const
+{
+	for ( size_t i = 0; i < attributes.size(); ++i )
+	{
+		if ( attributes[i].first == attribute )
+		{
+			return attributes[i].second;
+		}
+	}
+	return wxEmptyString;
+}
+
+void XrcElement::SetAttribute( const wxString& attribute, const wxString& value )
+{
+	for ( size_t i = 0; i < attributes.size(); ++i )
+	{
+		if ( attributes[i].first == attribute )
+		{
+			attributes[i].second = value;
+			return;
+		}
+	}
+	attributes.push_back( std::make_pair( attribute, value ) );
+}
+
+void XrcElement::Write( XrcStreamWriter& out, bool end ) const
+{
+	out.StartElement( name );
+	for ( size_t i = 0; i < attributes.size(); ++i )
+	{
+		out.AddAttribute( attributes[i].first, attributes[i].second );
+	}
+
+	if ( hasText )
+	{
+		out.AddText( text );
+	}
+
+	for ( size_t i = 0; i < children.size(); ++i )
+	{
+		children[i].Write( out );
+	}
+
+	if ( end )
+	{
+		out.EndElement();
+	}
+}
+
+XrcElementWriter::XrcElementWriter( XrcElement* element )
+:
+m_element( element ),
+m_started( false )
+{
+}
+
+bool XrcElementWriter::HasElement() const
+{
+	return m_started;
+}
+
+void XrcElementWriter::AddElement( const ticpp::Element& element )
+{
+	ReplayElement( element.GetTiXmlPointer(), this );
+}
+
+void XrcElementWriter::StartElement( const wxString& name )
+{
+	if ( m_open.empty() )
+	{
+		// A component writes a single object
+		*m_element = XrcElement( name );
+		m_started = true;
+		m_open.push_back( m_element );
+	}
+	else
+	{
+		// Only the children of the innermost element are modified while it is open,
+		// so the pointers to the open elements stay valid
+		XrcElement* parent = m_open.back();
+		parent->children.push_back( XrcElement( name ) );
+		m_open.push_back( &parent->children.back() );
+	}
+}
+
+void XrcElementWriter::AddAttribute( const wxString& name, const wxString& value )
+{
+	if ( !m_open.empty() )
+	{
+		m_open.back()->SetAttribute( name, value );
+	}
+}
+
+void XrcElementWriter::AddText( const wxString& text )
+{
+	if ( !m_open.empty() )
+	{
+		m_open.back()->text << text;
+		m_open.back()->hasText = true;
+	}
+}
+
+void XrcElementWriter::EndElement()
+{
+	if ( !m_open.empty() )
+	{
+		m_open.pop_back();
+	}
+}
+
+XrcStreamWriter::XrcStreamWriter( CodeWriter* cw, size_t baseDepth, bool compact )
+:
+m_cw( cw ),
+m_baseDepth( baseDepth ),
+m_tagOpen( false ),
+m_compact( compact )
+{
+}
+
+void XrcStreamWriter::Indent( size_t depth )
+{
+	if ( !m_compact )
+	{
+		m_buffer.append( m_baseDepth + depth, wxT('\t') );
+	}
+}
+
+void XrcStreamWriter::NewLine()
+{
+	if ( !m_compact )
+	{
+		m_buffer << wxT("\n");
+	}
+}
+
+void XrcStreamWriter::CloseStartTag( bool childElement )
+{
+	if ( m_open.empty() )
+	{
+		return;
+	}
+
+	if ( m_tagOpen )
+	{
+		m_buffer << wxT(">");
+		m_tagOpen = false;
+		if ( childElement )
+		{
+			NewLine();
+		}
+	}
+	else if ( childElement && !m_open.back().hasChildren )
+	{
+		// Text was written before, it is not kept on the line of the start tag then
+		NewLine();
+	}
+
+	if ( childElement )
+	{
+		m_open.back().hasChildren = true;
+	}
+}
+
+void XrcStreamWriter::Encode( const wxString& value )
+{
+	// Same entities as TiXmlBase::EncodeString
+	for ( wxString::const_iterator c = value.begin(); c != value.end(); ++c )
+	{
+		const wxChar ch = *c;
+		switch ( ch )
+		{
+			case wxT('&'):
+			{
+				wxString::const_iterator next = c + 1;
+				if ( next != value.end() && *next == wxT('#') && next + 1 != value.end() && *( next + 1 ) == wxT('x') )
+				{
+					// Character references are kept
+					for ( ; c != value.end() && *c != wxT(';'); ++c )
+					{
+						m_buffer << *c;
+					}
+					if ( c == value.end() )
+					{
+						return;
+					}
+					m_buffer << *c;
+				}
+				else
+				{
+					m_buffer << wxT("&amp;");
+				}
+				break;
+			}
+			case wxT('<'):  m_buffer << wxT("&lt;");   break;
+			case wxT('>'):  m_buffer << wxT("&gt;");   break;
+			case wxT('"'):  m_buffer << wxT("&quot;"); break;
+			case wxT('\''): m_buffer << wxT("&apos;"); break;
+			default:
+				if ( ch < 32 )
+				{
+					m_buffer << wxString::Format( wxT("&#x%02X;"), (unsigned int)ch );
+				}
+				else
+				{
+					m_buffer << ch;
+				}
+				break;
+		}
+	}
+}
+
+void XrcStreamWriter::WriteDeclaration()
+{
+	m_buffer << wxT("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>");
+	NewLine();
+}
+
+void XrcStreamWriter::StartElement( const wxString& name )
+{
+	CloseStartTag( true );
+
+	Indent( m_open.size() );
+	m_buffer << wxT("<") << name;
+
+	OpenElement element = { name, false };
+	m_open.push_back( element );
+	m_tagOpen = true;
+}
+
+void XrcStreamWriter::AddAttribute( const wxString& name, const wxString& value )
+{
+	if ( !m_tagOpen )
+	{
+		return;
+	}
+
+	const wxChar* quote = ( wxString::npos == value.find( wxT('"') ) ? wxT("\"") : wxT("'") );
+	m_buffer << wxT(" ");
+	Encode( name );
+	m_buffer << wxT("=") << quote;
+	Encode( value );
+	m_buffer << quote;
+}
+
+void XrcStreamWriter::AddText( const wxString& text )
+{
+	CloseStartTag( false );
+	Encode( text );
+}
+
+void XrcStreamWriter::EndElement()
+{
+	if ( m_open.empty() )
+	{
+		return;
+	}
+
+	const OpenElement& element = m_open.back();
+	if ( m_tagOpen )
+	{
+		m_buffer << ( m_compact ? wxT("/>") : wxT(" />") );
+		NewLine();
+		m_tagOpen = false;
+	}
+	else
+	{
+		if ( element.hasChildren )
+		{
+			Indent( m_open.size() - 1 );
+		}
+		m_buffer << wxT("</") << element.name << wxT(">");
+		NewLine();
+	}
+	m_open.pop_back();
+
+	if ( m_cw && m_buffer.length() >= FLUSH_SIZE )
+	{
+		Flush();
+	}
+}
+
+void XrcStreamWriter::AddMarkup( const wxString& markup )
+{
+	if ( markup.empty() )
+	{
+		return;
+	}
+
+	CloseStartTag( true );
+	m_buffer << markup;
+}
+
+void XrcStreamWriter::Flush()
+{
+	if ( m_cw && !m_buffer.empty() )
+	{
+		m_cw->Write( m_buffer );
+		m_buffer.clear();
+	}
+}
+
+const wxString& XrcStreamWriter::GetString() const
+{
+	return m_buffer;
+}
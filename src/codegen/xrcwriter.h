@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __XRC_WRITER__
+#define __XRC_WRITER__
+
+#include <component.h>
+
+#include <utility>
+#include <vector>
+
+class CodeWriter;
+
+namespace ticpp
+{
+	class Element;
+}
+
+class XrcStreamWriter;
+
+/**
+* XML element kept in memory until it is written, used for the element of a single object
+* (its attributes and properties) while the generator decides how to write it.
+*/
+class XrcElement
+{
+public:
+	wxString name;
+	std::vector< std::pair< wxString, wxString > > attributes;
+	wxString text;
+	bool hasText;
+	std::vector< XrcElement > children;
+
+	explicit XrcElement( const wxString& elementName = wxEmptyString );
+
+	wxString GetAttribute( const wxString& attribute ) const;
+	void SetAttribute( const wxString& attribute, const wxString& value );
+
+	/**
+	* Writes the element with its attributes, text and children.
+	* @param end If false the element is left open, so more children can be written.
+	*/
+	void Write( XrcStreamWriter& out, bool end = true ) const;
+};
+
+/**
+* Collects what a component writes through IXrcWriter into an XrcElement.
+*/
+class XrcElementWriter : public IXrcWriter
+{
+private:
+	XrcElement* m_element;
+	std::vector< XrcElement* > m_open;
+	bool m_started;
+
+public:
+	explicit XrcElementWriter( XrcElement* element );
+
+	/// A component wrote an element
+	bool HasElement() const;
+
+	/// Replays an element returned by IComponent::ExportToXrc
+	void AddElement( const ticpp::Element& element );
+
+	void StartElement( const wxString& name ) override;
+	void AddAttribute( const wxString& name, const wxString& value ) override;
+	void AddText( const wxString& text ) override;
+	void EndElement() override;
+};
+
+/**
+* Writes XML text as it is produced, formatted like TiXmlPrinter with tab indentation,
+* or without any whitespace between the elements in compact mode.
+*
+* The text is passed to the code writer in chunks, or kept in the writer if there is none.
+* Attributes have to be added before the text and children of an element.
+*/
+class XrcStreamWriter
+{
+private:
+	struct OpenElement
+	{
+		wxString name;
+		bool hasChildren;
+	};
+
+	CodeWriter* m_cw;
+	wxString m_buffer;
+	std::vector< OpenElement > m_open;
+	size_t m_baseDepth;
+	bool m_tagOpen;
+	bool m_compact;
+
+	void Indent( size_t depth );
+	void NewLine();
+	void CloseStartTag( bool childElement );
+	void Encode( const wxString& value );
+
+public:
+	/**
+	* @param cw Receives the text, if NULL it is available from GetString().
+	* @param baseDepth Indentation of the top level elements.
+	* @param compact Writes neither indentation nor line breaks.
+	*/
+	explicit XrcStreamWriter( CodeWriter* cw = NULL, size_t baseDepth = 0, bool compact = false );
+
+	void WriteDeclaration();
+
+	void StartElement( const wxString& name );
+	void AddAttribute( const wxString& name, const wxString& value );
+	void AddText( const wxString& text );
+	void EndElement();
+
+	/// Inserts elements already written by another writer, with the indentation of the children of the current element
+	void AddMarkup( const wxString& markup );
+
+	/// Passes the text written so far to the code writer
+	void Flush();
+
+	const wxString& GetString() const;
+};
+
+#endif //__XRC_WRITER__
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "xrsarchive.h"
+
+#include "../md5/md5.hh"
+#include "../utils/wxfbexception.h"
+#include "manifest.h"
+
+#include <wx/datetime.h>
+#include <wx/ffile.h>
+#include <wx/filename.h>
+#include <wx/mstream.h>
+#include <wx/zipstrm.h>
+
+namespace
+{
+	bool ReadFile( const wxString& path, std::vector< unsigned char >& data )
+	{
+		wxFFile file( path, wxT("rb") );
+		if ( !file.IsOpened() )
+		{
+			return false;
+		}
+
+		wxFileOffset length = file.Length();
+		if ( length < 0 )
+		{
+			return false;
+		}
+
+		data.resize( static_cast< size_t >( length ) );
+		return data.empty() || file.Read( &data[0], data.size() ) == data.size();
+	}
+
+	void PutEntry( wxZipOutputStream& zip, const wxString& name, const void* data, size_t size, bool compress )
+	{
+		// A fixed time keeps the archive identical when nothing changed
+		wxZipEntry* entry = new wxZipEntry( name, wxDateTime( 1, wxDateTime::Jan, 1980 ) );
+		entry->SetMethod( compress ? wxZIP_METHOD_DEFLATE : wxZIP_METHOD_STORE );
+		zip.PutNextEntry( entry );
+		zip.Write( data, size );
+	}
+}
+
+XrsArchive::XrsArchive( const wxString& basePath )
+:
+m_basePath( basePath )
+{
+}
+
+wxString XrsArchive::AddFile( const wxString& path )
+{
+	wxFileName fileName( path );
+	if ( !fileName.IsAbsolute() )
+	{
+		fileName.MakeAbsolute( m_basePath );
+	}
+	const wxString fullPath = fileName.GetFullPath();
+
+	std::map< wxString, wxString >::const_iterator known = m_namesByPath.find( fullPath );
+	if ( known != m_namesByPath.end() )
+	{
+		return known->second;
+	}
+
+	Entry entry;
+	if ( !fileName.FileExists() || !ReadFile( fullPath, entry.data ) )
+	{
+		return wxEmptyString;
+	}
+
+	const unsigned char empty = 0;
+	MD5 md5( entry.data.empty() ? &empty : &entry.data[0], static_cast< uint32_t >( entry.data.size() ) );
+	char* digest = md5.hex_digest();
+	const std::string hash( digest );
+	delete [] digest;
+
+	std::map< std::string, size_t >::const_iterator same = m_entriesByHash.find( hash );
+	if ( same != m_entriesByHash.end() )
+	{
+		const wxString& name = m_entries[ same->second ].name;
+		m_namesByPath[ fullPath ] = name;
+		return name;
+	}
+
+	entry.name = wxString::FromAscii( hash.c_str() );
+	if ( !fileName.GetExt().empty() )
+	{
+		entry.name << wxT(".") << fileName.GetExt().Lower();
+	}
+
+	m_entriesByHash[ hash ] = m_entries.size();
+	m_namesByPath[ fullPath ] = entry.name;
+	m_entries.push_back( entry );
+	return m_entries.back().name;
+}
+
+void XrsArchive::Write( const wxString& filename, const wxString& xrcName, const wxString& xrc ) const
+{
+	wxMemoryOutputStream buffer;
+	{
+		wxZipOutputStream zip( buffer );
+
+		const wxScopedCharBuffer utf8 = xrc.utf8_str();
+		PutEntry( zip, xrcName, utf8.data(), utf8.length(), true );
+
+		for ( std::vector< Entry >::const_iterator entry = m_entries.begin(); entry != m_entries.end(); ++entry )
+		{
+			// Images are compressed already, deflating them again only slows down loading
+			const wxString ext = entry->name.AfterLast( wxT('.') );
+			const bool compress = !( ext == wxT("png") || ext == wxT("jpg") || ext == wxT("jpeg") || ext == wxT("gif") );
+			PutEntry( zip, entry->name, entry->data.empty() ? NULL : &entry->data[0], entry->data.size(), compress );
+		}
+
+		if ( !zip.Close() )
+		{
+			THROW_WXFBEX( _("Unable to create the archive: ") << filename );
+		}
+	}
+
+	GenerationManifest::AddOutput( filename );
+
+	const size_t size = buffer.GetLength();
+	std::vector< unsigned char > content( size );
+	if ( size > 0 )
+	{
+		buffer.CopyTo( &content[0], size );
+	}
+
+	// Leave the archive untouched if it is the same
+	std::vector< unsigned char > current;
+	if ( wxFileExists( filename ) && ReadFile( filename, current ) && current == content )
+	{
+		return;
+	}
+
+	wxFFile file( filename, wxT("wb") );
+	if ( !file.IsOpened() || ( size > 0 && file.Write( &content[0], size ) != size ) )
+	{
+		THROW_WXFBEX( _("Unable to write file: ") << filename );
+	}
+}
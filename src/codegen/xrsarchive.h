@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __XRS_ARCHIVE__
+#define __XRS_ARCHIVE__
+
+#include <wx/string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+* Packs an XRC with the bitmaps it references into an .xrs file, the zip archive
+* wxXmlResource loads through wxFileSystem. Bitmaps with the same content are stored
+* once, named after the MD5 of their content.
+*/
+class XrsArchive
+{
+private:
+	struct Entry
+	{
+		wxString name;
+		std::vector< unsigned char > data;
+	};
+
+	wxString m_basePath;
+	std::vector< Entry > m_entries;
+	std::map< wxString, wxString > m_namesByPath;
+	std::map< std::string, size_t > m_entriesByHash;
+
+public:
+	/// @param basePath Directory of the bitmaps with a relative path.
+	explicit XrsArchive( const wxString& basePath );
+
+	/**
+	* Adds a bitmap to the archive.
+	* @return The name of its entry, empty if the path is not a readable file.
+	*/
+	wxString AddFile( const wxString& path );
+
+	/// Writes the archive, the XRC is stored as xrcName and the bitmaps next to it
+	void Write( const wxString& filename, const wxString& xrcName, const wxString& xrc ) const;
+};
+
+#endif //__XRS_ARCHIVE__
@@ -24,15 +24,22 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "maingui.h"
 
+#include "codegen/manifest.h"
 #include "model/objectbase.h"
 #include "rad/appdata.h"
+#include "rad/designer/visualeditor.h"
+#include "rad/iconatlas.h"
 #include "rad/mainframe.h"
+#include "rad/xrcpreview/xrcpreview.h"
 #include "utils/typeconv.h"
 #include "utils/wxfbexception.h"
 
 #include <wx/clipbrd.h>
 #include <wx/cmdline.h>
 #include <wx/config.h>
+#include <wx/evtloop.h>
+#include <wx/filename.h>
+#include <wx/process.h>
 #include <wx/stdpaths.h>
 #include <wx/sysopt.h>
 
@@ -72,6 +79,21 @@ static const wxCmdLineEntryDesc s_cmdLineDesc[] = {
 	  "Override the code_generation property from the passed file and generate the passed "
 	  "languages. Separate multiple languages with commas.",
 	  wxCMD_LINE_VAL_STRING, 0 },
+	{ wxCMD_LINE_OPTION, "d", "depfile",
+	  "Write a Make/Ninja dependency file listing the generated files and everything they were "
+	  "generated from to the passed path.",
+	  wxCMD_LINE_VAL_STRING, 0 },
+	{ wxCMD_LINE_SWITCH, "", "force", "Generate even if the manifest of the last generation is current.",
+	  wxCMD_LINE_VAL_STRING, 0 },
+	{ wxCMD_LINE_OPTION, "r", "render",
+	  "Render the forms of the passed file to PNG images in the passed directory. "
+	  "Needs a display, which can be virtual (e.g. Xvfb). Exits with code 8 if a form could not be rendered.",
+	  wxCMD_LINE_VAL_STRING, 0 },
+	{ wxCMD_LINE_OPTION, "f", "form", "Render only the form with the passed name.",
+	  wxCMD_LINE_VAL_STRING, 0 },
+	{ wxCMD_LINE_OPTION, "j", "jobs",
+	  "Number of worker processes used to render the forms in parallel.",
+	  wxCMD_LINE_VAL_NUMBER, 0 },
 	{ wxCMD_LINE_SWITCH, "h", "help", "Show this help message.", wxCMD_LINE_VAL_STRING,
 	  wxCMD_LINE_OPTION_HELP },
 	{ wxCMD_LINE_SWITCH, "v", "version", "Print version information.", wxCMD_LINE_VAL_STRING, 0 },
@@ -82,6 +104,167 @@ static const wxCmdLineEntryDesc s_cmdLineDesc[] = {
 
 IMPLEMENT_APP( MyApp )
 
+/**
+ * Renders forms in worker processes, at most a given number at a time.
+ * A new worker is started whenever one terminates, the event loop is left
+ * once the last one terminated.
+ */
+class RenderJobs
+{
+private:
+	wxEventLoopBase* m_loop;
+	wxString m_outputDir;
+	wxString m_projectFile;
+	std::vector< wxString > m_forms;
+	size_t m_next;
+	long m_jobs;
+	int m_running;
+	int m_failed;
+
+	/**
+	 * Worker process rendering one form.
+	 */
+	class RenderProcess : public wxProcess
+	{
+	private:
+		RenderJobs* m_owner;
+		wxString m_form;
+
+	public:
+		RenderProcess( RenderJobs* owner, const wxString& form )
+		:
+		m_owner( owner ),
+		m_form( form )
+		{
+		}
+
+		void OnTerminate( int, int status ) override
+		{
+			m_owner->OnTerminate( m_form, status );
+			delete this;
+		}
+	};
+
+	void OnTerminate( const wxString& form, int status )
+	{
+		--m_running;
+		if ( 0 != status )
+		{
+			++m_failed;
+			wxLogError( _("Rendering form '%s' failed with exit code %i."), form, status );
+		}
+		StartWorkers();
+	}
+
+	void StartWorkers()
+	{
+		while ( m_running < m_jobs && m_next < m_forms.size() )
+		{
+			const wxString& form = m_forms[ m_next++ ];
+			const wxString command = wxString::Format( wxT("\"%s\" --render=\"%s\" --form=\"%s\" \"%s\""),
+														wxStandardPaths::Get().GetExecutablePath(), m_outputDir, form, m_projectFile );
+
+			RenderProcess* process = new RenderProcess( this, form );
+			if ( 0 == ::wxExecute( command, wxEXEC_ASYNC, process ) )
+			{
+				wxLogError( _("Unable to start: %s"), command );
+				delete process;
+				++m_failed;
+				continue;
+			}
+			++m_running;
+		}
+
+		if ( 0 == m_running && m_loop->IsRunning() )
+		{
+			m_loop->Exit();
+		}
+	}
+
+public:
+	RenderJobs( wxEventLoopBase* loop, const wxString& outputDir, const wxString& projectFile,
+				const std::vector< wxString >& forms, long jobs )
+	:
+	m_loop( loop ),
+	m_outputDir( outputDir ),
+	m_projectFile( projectFile ),
+	m_forms( forms ),
+	m_next( 0 ),
+	m_jobs( jobs ),
+	m_running( 0 ),
+	m_failed( 0 )
+	{
+	}
+
+	/// Starts the first workers and dispatches events until the last one terminated
+	int Run()
+	{
+		StartWorkers();
+		if ( m_running > 0 )
+		{
+			m_loop->Run();
+		}
+		return m_failed;
+	}
+};
+
+/**
+ * Renders the forms of the loaded project to @a outputDir/<form name>.png.
+ * With more than one job every form is rendered by a separate instance of
+ * this executable, at most @a jobs at a time.
+ * @return false if there was no form to render or any of them could not be rendered.
+ */
+static bool RenderForms( MainFrame* frame, const wxString& projectFile, const wxString& outputDir, const wxString& formName, long jobs )
+{
+	std::vector< PObjectBase > forms;
+	PObjectBase project = AppData()->GetProjectData();
+	for ( unsigned int i = 0; i < project->GetChildCount(); ++i )
+	{
+		PObjectBase form = project->GetChild( i );
+		if ( formName.empty() || form->GetPropertyAsString( wxT("name") ) == formName )
+		{
+			forms.push_back( form );
+		}
+	}
+
+	if ( forms.empty() )
+	{
+		wxLogError( _("No form to render.") );
+		return false;
+	}
+
+	// Worker processes need an event loop to report their termination,
+	// the designer needs it to lay out and paint the forms
+	wxGUIEventLoop loop;
+
+	if ( jobs > 1 && forms.size() > 1 )
+	{
+		std::vector< wxString > names;
+		for ( size_t i = 0; i < forms.size(); ++i )
+		{
+			names.push_back( forms[i]->GetPropertyAsString( wxT("name") ) );
+		}
+
+		RenderJobs renderJobs( &loop, outputDir, projectFile, names, jobs );
+		return 0 == renderJobs.Run();
+	}
+
+	wxEventLoopActivator activator( &loop );
+	int failed = 0;
+
+	VisualEditor* editor = frame->GetVisualEditor();
+	for ( size_t i = 0; i < forms.size(); ++i )
+	{
+		wxFileName file( outputDir, forms[i]->GetPropertyAsString( wxT("name") ), wxT("png") );
+		if ( !editor->RenderForm( forms[i], file.GetFullPath() ) )
+		{
+			++failed;
+		}
+	}
+
+	return 0 == failed;
+}
+
 int MyApp::OnRun()
 {
 	// Abnormal Termination Handling
@@ -134,8 +317,27 @@ int MyApp::OnRun()
 	}
 
 	bool justGenerate = false;
+	wxString renderDir;
+	bool justRender = parser.Found( wxT("r"), &renderDir );
+	wxString renderForm;
+	parser.Found( wxT("f"), &renderForm );
+	long renderJobs = 1;
+	parser.Found( wxT("j"), &renderJobs );
 	wxString language;
 	bool hasLanguage = parser.Found( wxT("l"), &language );
+	wxString depfile;
+	bool hasDepfile = parser.Found( wxT("d"), &depfile );
+	bool forceGenerate = parser.Found( wxT("force") );
+	if ( !justRender && ( parser.Found( wxT("f") ) || parser.Found( wxT("j") ) ) )
+	{
+		wxLogError( _("The --form and --jobs options need --render.") );
+		return 1;
+	}
+	if ( renderJobs < 1 )
+	{
+		wxLogError( _("The number of jobs must be at least 1, not %ld."), renderJobs );
+		return 1;
+	}
 	if ( parser.Found( wxT("g") ) )
 	{
 		if ( projectToLoad.empty() )
@@ -157,6 +359,20 @@ int MyApp::OnRun()
 		// generate code
 		justGenerate = true;
 	}
+	else if ( justRender )
+	{
+		if ( projectToLoad.empty() )
+		{
+			wxLogError( _("You must pass a path to a project file. Nothing to render.") );
+			return 2;
+		}
+
+		if ( !wxFileName::Mkdir( renderDir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL ) )
+		{
+			wxLogError( _("Unable to create output directory: %s"), renderDir );
+			return 3;
+		}
+	}
 	else
 	{
 		delete wxLog::SetActiveTarget( new wxLogGui );
@@ -192,8 +408,21 @@ int MyApp::OnRun()
 		wxLogError( ex.what() );
 	}
 
+	// Nothing the generated files depend on changed since the last generation, so the
+	// plugins and the project don't even have to be loaded
+	GenerationManifest manifest( projectToLoad, wxString::FromAscii( VERSION ) + wxT(" ") + ( hasLanguage ? language : wxString( wxT("*") ) ) );
+	if ( justGenerate && !forceGenerate && manifest.IsCurrent() )
+	{
+		if ( hasDepfile && !manifest.WriteDepfile( depfile ) )
+		{
+			wxLogError( _("Unable to write the dependency file: %s"), depfile );
+			return 7;
+		}
+		return 0;
+	}
+
 	// If the project is already loaded in another instance, switch to that instance and quit
-	if ( !projectToLoad.empty() && !justGenerate )
+	if ( !projectToLoad.empty() && !justGenerate && !justRender )
 	{
 		if ( ::wxFileExists( projectToLoad ) )
 		{
@@ -251,7 +480,7 @@ int MyApp::OnRun()
 	config->SetPath( wxT("/") );
 
 	m_frame = new MainFrame( NULL ,wxID_ANY, (int)style, wxPoint( x, y ), wxSize( w, h ) );
-	if ( !justGenerate )
+	if ( !justGenerate && !justRender )
 	{
 		m_frame->Show( TRUE );
 		SetTopWindow( m_frame );
@@ -275,9 +504,13 @@ int MyApp::OnRun()
 
 	if ( !projectToLoad.empty() )
 	{
-		if ( AppData()->LoadProject( projectToLoad, justGenerate ) )
+		if ( AppData()->LoadProject( projectToLoad, justGenerate || justRender ) )
 		{
-			if ( justGenerate )
+			if ( justRender )
+			{
+				return RenderForms( m_frame, projectToLoad, renderDir, renderForm, renderJobs ) ? 0 : 8;
+			}
+			else if ( justGenerate )
 			{
 				if ( hasLanguage )
 				{
@@ -288,7 +521,23 @@ int MyApp::OnRun()
 						codeGen->SetValue( language );
 					}
 				}
-				AppData()->GenerateCode( false, true );
+				{
+					GenerationManifest::Recorder recorder( &manifest );
+					AppData()->GenerateCode( false, true );
+				}
+
+				// Without a complete manifest the next generation can't be skipped
+				manifest.CollectInputs( AppData()->GetProjectData() );
+				if ( !manifest.Save() && ::wxFileExists( manifest.GetPath() ) )
+				{
+					::wxRemoveFile( manifest.GetPath() );
+				}
+
+				if ( hasDepfile && !manifest.WriteDepfile( depfile ) )
+				{
+					wxLogError( _("Unable to write the dependency file: %s"), depfile );
+					return 7;
+				}
 				return 0;
 			}
 			else
@@ -303,7 +552,7 @@ int MyApp::OnRun()
 		}
 	}
 
-	if ( justGenerate )
+	if ( justGenerate || justRender )
 	{
 		return 6;
 	}
@@ -331,6 +580,8 @@ bool MyApp::OnInit()
 int MyApp::OnExit()
 {
 	MacroDictionary::Destroy();
+	XRCPreview::Destroy();
+	IconAtlas::Destroy();
 	AppDataDestroy();
 
 	if( !wxTheClipboard->IsOpened() )
@@ -26,6 +26,7 @@
 #include "database.h"
 
 #include "../rad/bitmaps.h"
+#include "../rad/iconatlas.h"
 #include "../utils/debug.h"
 #include "../utils/stringutils.h"
 #include "../utils/typeconv.h"
@@ -37,6 +38,15 @@
 #include <wx/filename.h>
 #include <wx/stdpaths.h>
 
+#ifdef __WXMSW__
+	#include <wx/msw/wrapwin.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <thread>
+
 //#define DEBUG_PRINT(x) cout << x
 
 #define OBJINFO_TAG "objectinfo"
@@ -65,11 +75,56 @@
 #include <dlfcn.h>
 #endif
 
-ObjectPackage::ObjectPackage(wxString name, wxString desc, wxBitmap icon)
+namespace
+{
+	/**
+	 * Component of a library built with version 1 of the plugin interface, whose vtable
+	 * ends before the functions appended since, see WXFB_PLUGIN_INTERFACE_VERSION.
+	 * Those are answered here as not supported instead of being called.
+	 */
+	class LegacyComponent : public IComponent
+	{
+	private:
+		IComponent* m_component;
+
+	public:
+		explicit LegacyComponent( IComponent* component )
+		:
+		m_component( component )
+		{
+		}
+
+		wxObject* Create( IObject* obj, wxObject* parent ) override { return m_component->Create( obj, parent ); }
+		void Cleanup( wxObject* obj ) override { m_component->Cleanup( obj ); }
+		void OnCreated( wxObject* wxobject, wxWindow* wxparent ) override { m_component->OnCreated( wxobject, wxparent ); }
+		void OnSelected( wxObject* wxobject ) override { m_component->OnSelected( wxobject ); }
+		ticpp::Element* ExportToXrc( IObject* obj ) override { return m_component->ExportToXrc( obj ); }
+		ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj ) override { return m_component->ImportFromXrc( xrcObj ); }
+		int GetComponentType() override { return m_component->GetComponentType(); }
+
+		bool WriteXrc( IObject*, IXrcWriter* ) override { return false; }
+		bool ReadXrc( ticpp::Element*, IXfbWriter* ) override { return false; }
+	};
+}
+
+ObjectPackage::ObjectPackage(wxString name, wxString desc, const wxString& iconFile)
 {
 	m_name = name;
 	m_desc = desc;
-	m_icon = icon;
+	m_iconFile = iconFile;
+}
+
+wxBitmap ObjectPackage::GetPackageIcon()
+{
+	if ( !m_icon.IsOk() )
+	{
+		m_icon = IconAtlas::Get( 16 )->GetIcon( m_iconFile );
+		if ( !m_icon.IsOk() )
+		{
+			m_icon = AppBitmaps::GetBitmap( wxT("unknown"), 16 );
+		}
+	}
+	return m_icon;
 }
 
 PObjectInfo ObjectPackage::GetObjectInfo(unsigned int idx)
@@ -585,145 +640,368 @@ bool IncludeInPalette(wxString /*type*/) {
 	return true;
 }
 
+void ObjectDatabase::PreloadDefinitionFiles( const std::vector< wxString >& files )
+{
+	// Paths are converted on the main thread, the workers only use TinyXML
+	std::vector< std::string > paths;
+	paths.reserve( files.size() );
+	for ( std::vector< wxString >::const_iterator file = files.begin(); file != files.end(); ++file )
+	{
+		paths.push_back( std::string( file->mb_str( wxConvFile ) ) );
+	}
+
+	std::vector< std::unique_ptr< ticpp::Document > > docs( files.size() );
+	TiXmlBase::SetCondenseWhiteSpace( true );
+
+	std::atomic< size_t > next( 0 );
+	auto worker = [ &paths, &docs, &next ]()
+	{
+		for ( size_t i = next++; i < paths.size(); i = next++ )
+		{
+			std::unique_ptr< ticpp::Document > doc( new ticpp::Document( paths[i] ) );
+			try
+			{
+				doc->LoadFile();
+
+				// Same check as XMLUtils::LoadXMLFile, which asks the user when it fails
+				ticpp::Declaration* declaration = doc->FirstChild()->ToDeclaration();
+				std::string encoding = declaration->Encoding();
+				std::transform( encoding.begin(), encoding.end(), encoding.begin(), ::tolower );
+				if ( encoding == "utf-8" || encoding == "utf8" )
+				{
+					docs[i] = std::move( doc );
+				}
+			}
+			catch ( ticpp::Exception& )
+			{
+				// Missing or invalid, reported when it is loaded
+			}
+		}
+	};
+
+	const size_t threadCount = std::min< size_t >( files.size(), std::max( 1u, std::thread::hardware_concurrency() ) );
+	std::vector< std::thread > threads;
+	for ( size_t i = 1; i < threadCount; ++i )
+	{
+		threads.push_back( std::thread( worker ) );
+	}
+	worker();
+	for ( std::vector< std::thread >::iterator thread = threads.begin(); thread != threads.end(); ++thread )
+	{
+		thread->join();
+	}
+
+	for ( size_t i = 0; i < files.size(); ++i )
+	{
+		if ( docs[i] )
+		{
+			m_preloadedFiles[ files[i] ] = std::move( docs[i] );
+		}
+	}
+}
+
+ticpp::Document& ObjectDatabase::LoadDefinitionFile( const wxString& file, ticpp::Document& doc )
+{
+	std::map< wxString, std::unique_ptr< ticpp::Document > >::iterator preloaded = m_preloadedFiles.find( file );
+	if ( preloaded != m_preloadedFiles.end() )
+	{
+		return *preloaded->second;
+	}
+
+	XMLUtils::LoadXMLFile( doc, true, file );
+	return doc;
+}
+
 void ObjectDatabase::LoadPlugins( PwxFBManager manager )
 {
+	// Code template file extensions and the language of their templates
+	struct CodeLanguage
+	{
+		const wxChar* ext;
+		const wxChar* name;
+	};
+	const CodeLanguage languages[] =
+	{
+		{ wxT("cppcode"), wxT("C++") },
+		{ wxT("pythoncode"), wxT("Python") },
+		{ wxT("phpcode"), wxT("PHP") },
+		{ wxT("luacode"), wxT("Lua") },
+	};
+
+	m_manager = manager;
+
+	// Plugin directories and their package files, sorted so the packages are always merged in the same order
+	struct PluginFiles
+	{
+		wxString path;
+		wxString iconPath;
+		std::vector< wxString > packages;
+	};
+	std::vector< PluginFiles > plugins;
+
+	wxDir pluginsDir;
+	if ( wxDir::Exists( m_pluginPath ) && pluginsDir.Open( m_pluginPath ) )
+	{
+		std::vector< wxString > pluginDirNames;
+		wxString pluginDirName;
+		bool moreDirectories = pluginsDir.GetFirst( &pluginDirName, wxEmptyString, wxDIR_DIRS | wxDIR_HIDDEN );
+		while ( moreDirectories )
+		{
+			pluginDirNames.push_back( pluginDirName );
+			moreDirectories = pluginsDir.GetNext( &pluginDirName );
+		}
+		std::sort( pluginDirNames.begin(), pluginDirNames.end() );
+
+		for ( std::vector< wxString >::const_iterator dirName = pluginDirNames.begin(); dirName != pluginDirNames.end(); ++dirName )
+		{
+			// Iterate through .xml files in the xml directory
+			PluginFiles plugin;
+			plugin.path = m_pluginPath + *dirName;
+			plugin.iconPath = plugin.path + wxFILE_SEP_PATH + wxT("icons");
+			wxString pluginXmlPath = plugin.path + wxFILE_SEP_PATH + wxT("xml");
+			if ( !wxDir::Exists( plugin.path ) || !wxDir::Exists( pluginXmlPath ) )
+			{
+				continue;
+			}
+
+			wxDir pluginXmlDir( pluginXmlPath );
+			if ( !pluginXmlDir.IsOpened() )
+			{
+				continue;
+			}
+
+			wxString packageXmlFile;
+			bool moreXmlFiles = pluginXmlDir.GetFirst( &packageXmlFile, wxT("*.xml"), wxDIR_FILES | wxDIR_HIDDEN );
+			while ( moreXmlFiles )
+			{
+				wxFileName nextXmlFile( pluginXmlPath + wxFILE_SEP_PATH + packageXmlFile );
+				if ( !nextXmlFile.IsAbsolute() )
+				{
+					nextXmlFile.MakeAbsolute();
+				}
+				plugin.packages.push_back( nextXmlFile.GetFullPath() );
+				moreXmlFiles = pluginXmlDir.GetNext( &packageXmlFile );
+			}
+			std::sort( plugin.packages.begin(), plugin.packages.end() );
+			plugins.push_back( plugin );
+		}
+	}
+
+	// Parse all the object description files at once, the objects are created from them below in the usual order.
+	// The code templates are only needed to generate code, they are loaded the first time a language is used.
+	std::vector< wxString > files;
+	files.push_back( m_xmlPath + wxT("default.xml") );
+	for ( std::vector< PluginFiles >::const_iterator plugin = plugins.begin(); plugin != plugins.end(); ++plugin )
+	{
+		files.insert( files.end(), plugin->packages.begin(), plugin->packages.end() );
+	}
+	PreloadDefinitionFiles( files );
+
 	// Load some default templates
-	LoadCodeGen( m_xmlPath + wxT("properties.cppcode") );
-	LoadCodeGen( m_xmlPath + wxT("properties.pythoncode") );
-	LoadCodeGen( m_xmlPath + wxT("properties.luacode") );
-	LoadCodeGen( m_xmlPath + wxT("properties.phpcode") );
+	for ( size_t lang = 0; lang < WXSIZEOF( languages ); ++lang )
+	{
+		DeferCodeGen( languages[lang].name, m_xmlPath + wxT("properties.") + languages[lang].ext );
+	}
 	LoadPackage( m_xmlPath + wxT("default.xml"), m_iconPath );
-	LoadCodeGen( m_xmlPath + wxT("default.cppcode") );
-	LoadCodeGen( m_xmlPath + wxT("default.pythoncode") );
-	LoadCodeGen( m_xmlPath + wxT("default.luacode") );
-	LoadCodeGen( m_xmlPath + wxT("default.phpcode") );
+	for ( size_t lang = 0; lang < WXSIZEOF( languages ); ++lang )
+	{
+		DeferCodeGen( languages[lang].name, m_xmlPath + wxT("default.") + languages[lang].ext );
+	}
 
 	// Map to temporarily hold plugins.
 	// Used to both set page order and to prevent two plugins with the same name.
 	typedef std::map< wxString, PObjectPackage > PackageMap;
 	PackageMap packages;
 
-	// Open plugins directory for iteration
-	if ( !wxDir::Exists( m_pluginPath ) )
+	for ( std::vector< PluginFiles >::const_iterator plugin = plugins.begin(); plugin != plugins.end(); ++plugin )
 	{
-		return;
+		std::map< wxString, PObjectPackage > packagesToSetup;
+		for ( std::vector< wxString >::const_iterator packageFile = plugin->packages.begin(); packageFile != plugin->packages.end(); ++packageFile )
+		{
+			try
+			{
+				PObjectPackage package = LoadPackage( *packageFile, plugin->iconPath );
+				if ( package )
+				{
+					// Load all packages, then setup all packages
+					// this allows multiple packages sharing one library
+					packagesToSetup[ *packageFile ] = package;
+				}
+			}
+			catch ( wxFBException& ex )
+			{
+				wxLogError( ex.what() );
+			}
+		}
+
+		std::map< wxString, PObjectPackage >::iterator packageIt;
+		for ( packageIt = packagesToSetup.begin(); packageIt != packagesToSetup.end(); ++packageIt )
+		{
+			// Setup the inheritance for base classes
+			wxFileName fullNextPluginPath( plugin->path );
+			if ( !fullNextPluginPath.IsAbsolute() )
+			{
+				fullNextPluginPath.MakeAbsolute();
+			}
+			wxFileName xmlFileName( packageIt->first );
+			try
+			{
+				SetupPackage( xmlFileName.GetFullPath(), fullNextPluginPath.GetFullPath() );
+
+				// The C++, Python, PHP and Lua code tempates
+				for ( size_t lang = 0; lang < WXSIZEOF( languages ); ++lang )
+				{
+					xmlFileName.SetExt( languages[lang].ext );
+					DeferCodeGen( languages[lang].name, xmlFileName.GetFullPath() );
+				}
+
+				std::pair< PackageMap::iterator, bool > addedPackage = packages.insert( PackageMap::value_type( packageIt->second->GetPackageName(), packageIt->second ) );
+				if ( !addedPackage.second )
+				{
+					addedPackage.first->second->AppendPackage( packageIt->second );
+					LogDebug( "Merged plugins named \"" + packageIt->second->GetPackageName() + "\"" );
+				}
+			}
+			catch ( wxFBException& ex )
+			{
+				wxLogError( ex.what() );
+			}
+		}
 	}
 
-	wxDir pluginsDir( m_pluginPath );
-	if ( !pluginsDir.IsOpened() )
+	m_preloadedFiles.clear();
+
+	// Add packages to final data structure
+	m_pkgs.reserve(packages.size());
+	for (auto& package : packages)
+	{
+		m_pkgs.push_back(package.second);
+	}
+
+	// Sort the macros registered so far for lookup, the libraries imported later rebuild the table
+	PMacroDictionary dic = MacroDictionary::GetInstance();
+	dic->Build();
+
+	// The library registering a macro may not be imported yet
+	dic->SetMissingMacroHandler( [this]( const wxString& macro ) { return LoadMacroLibraries( macro ); } );
+}
+
+void ObjectDatabase::LoadComponentLibrary( const wxString& library )
+{
+	std::map< wxString, wxString >::iterator pending = m_pendingLibraries.find( library );
+	if ( pending == m_pendingLibraries.end() )
 	{
 		return;
 	}
 
-	// Iterate through plugin directories and load the package from the xml subdirectory
-	wxString pluginDirName;
-	bool moreDirectories = pluginsDir.GetFirst( &pluginDirName, wxEmptyString, wxDIR_DIRS | wxDIR_HIDDEN );
-    while ( moreDirectories )
-    {
-    	// Iterate through .xml files in the xml directory
-    	wxString nextPluginPath = m_pluginPath + pluginDirName;
-    	wxString nextPluginXmlPath = nextPluginPath + wxFILE_SEP_PATH + wxT("xml");
-    	wxString nextPluginIconPath = nextPluginPath + wxFILE_SEP_PATH + wxT("icons");
-    	if ( wxDir::Exists( nextPluginPath ) )
-    	{
-    		if ( wxDir::Exists( nextPluginXmlPath ) )
-    		{
-				wxDir pluginXmlDir( nextPluginXmlPath );
-				if ( pluginXmlDir.IsOpened() )
-				{
-					std::map< wxString, PObjectPackage > packagesToSetup;
-					wxString packageXmlFile;
-					bool moreXmlFiles = pluginXmlDir.GetFirst( &packageXmlFile, wxT("*.xml"), wxDIR_FILES | wxDIR_HIDDEN );
-					while ( moreXmlFiles )
-					{
-						try
-						{
-							wxFileName nextXmlFile( nextPluginXmlPath + wxFILE_SEP_PATH + packageXmlFile );
-							if ( !nextXmlFile.IsAbsolute() )
-							{
-								nextXmlFile.MakeAbsolute();
-							}
-
-							PObjectPackage package = LoadPackage( nextXmlFile.GetFullPath(), nextPluginIconPath );
-							if ( package )
-							{
-								// Load all packages, then setup all packages
-								// this allows multiple packages sharing one library
-								packagesToSetup[ nextXmlFile.GetFullPath() ] = package;
-							}
-						}
-						catch ( wxFBException& ex )
-						{
-							wxLogError( ex.what() );
-						}
-						moreXmlFiles = pluginXmlDir.GetNext( &packageXmlFile );
-					}
+	wxString libPath = pending->second;
+	m_pendingLibraries.erase( pending );
 
-					std::map< wxString, PObjectPackage >::iterator packageIt;
-					for ( packageIt = packagesToSetup.begin(); packageIt != packagesToSetup.end(); ++packageIt )
-					{
-						// Setup the inheritance for base classes
-						wxFileName fullNextPluginPath( nextPluginPath );
-						if ( !fullNextPluginPath.IsAbsolute() )
-						{
-							fullNextPluginPath.MakeAbsolute();
-						}
-						wxFileName xmlFileName( packageIt->first );
-						try
-						{
-							SetupPackage( xmlFileName.GetFullPath(), fullNextPluginPath.GetFullPath(), manager );
+#ifdef __WXMSW__
+	// Allows plugin dependency dlls to be next to plugin dll in windows
+	::SetDllDirectory( libPath.wc_str() );
+#endif
+	try
+	{
+		ImportComponentLibrary( library, m_manager );
+	}
+	catch ( wxFBException& ex )
+	{
+		wxLogError( ex.what() );
+	}
+#ifdef __WXMSW__
+	::SetDllDirectory( NULL );
+#endif
 
-							// Load the C++ code tempates
-							xmlFileName.SetExt( wxT("cppcode") );
-							LoadCodeGen( xmlFileName.GetFullPath() );
+	// Whether it failed or not, the library won't provide any other component
+	for ( ObjectInfoMap::iterator it = m_objs.begin(); it != m_objs.end(); ++it )
+	{
+		if ( it->second->GetComponentLibrary() == library )
+		{
+			it->second->SetComponentLibrary( wxEmptyString );
+		}
+	}
+}
 
-							// Load the Python code tempates
-							xmlFileName.SetExt( wxT("pythoncode") );
-							LoadCodeGen( xmlFileName.GetFullPath() );
+bool ObjectDatabase::LoadMacroLibraries( const wxString& macro )
+{
+	// Only the macros declared in the XML files come from the libraries
+	if ( m_pendingLibraries.empty() || m_macroSet.find( macro ) == m_macroSet.end() )
+	{
+		return false;
+	}
 
-							// Load the PHP code tempates
-							xmlFileName.SetExt( wxT("phpcode") );
-							LoadCodeGen( xmlFileName.GetFullPath() );
+	LogDebug( "Importing the pending component libraries for macro " + macro );
+	while ( !m_pendingLibraries.empty() )
+	{
+		LoadComponentLibrary( m_pendingLibraries.begin()->first );
+	}
+	return true;
+}
 
-							// Load the Lua code tempates
-							xmlFileName.SetExt( wxT("luacode") );
-							LoadCodeGen( xmlFileName.GetFullPath() );
+void ObjectDatabase::DeferCodeGen( const wxString& language, const wxString& file )
+{
+	m_pendingTemplates[ language ].push_back( file );
 
-							std::pair< PackageMap::iterator, bool > addedPackage = packages.insert( PackageMap::value_type( packageIt->second->GetPackageName(), packageIt->second ) );
-							if ( !addedPackage.second )
-							{
-								addedPackage.first->second->AppendPackage( packageIt->second );
-                                LogDebug( "Merged plugins named \"" + packageIt->second->GetPackageName() + "\"" );
-							}
+	if ( wxFileName::FileExists( file ) )
+	{
+		m_definitionFiles.push_back( file );
+	}
+}
 
-						}
-						catch ( wxFBException& ex )
-						{
-							wxLogError( ex.what() );
-						}
-					}
-				}
-    		}
-    	}
+void ObjectDatabase::LoadCodeTemplates( const wxString& language )
+{
+	std::map< wxString, std::vector< wxString > >::iterator pending = m_pendingTemplates.find( language );
+	if ( pending == m_pendingTemplates.end() )
+	{
+		return;
+	}
 
-        moreDirectories = pluginsDir.GetNext( &pluginDirName );
-    }
+	std::vector< wxString > files;
+	files.swap( pending->second );
+	m_pendingTemplates.erase( pending );
+	if ( files.empty() )
+	{
+		return;
+	}
 
-	// Add packages to final data structure
-	m_pkgs.reserve(packages.size());
-	for (auto& package : packages)
+	PreloadDefinitionFiles( files );
+
+	// The property templates come first, they are merged into each class before its own templates
+	LoadCodeGen( files.front() );
+	for ( std::map< PObjectInfo, std::vector< PropertyType > >::iterator obj = m_classPropertyTypes.begin(); obj != m_classPropertyTypes.end(); ++obj )
 	{
-		m_pkgs.push_back(package.second);
+		for ( std::vector< PropertyType >::iterator ptype = obj->second.begin(); ptype != obj->second.end(); ++ptype )
+		{
+			PTLangTemplateMap::iterator propLangTemplates = m_propertyTypeTemplates.find( *ptype );
+			if ( propLangTemplates == m_propertyTypeTemplates.end() )
+			{
+				continue;
+			}
+
+			LangTemplateMap::iterator templates = propLangTemplates->second.find( language );
+			if ( templates != propLangTemplates->second.end() && templates->second )
+			{
+				obj->first->AddCodeInfo( language, templates->second );
+			}
+		}
+	}
+
+	for ( size_t i = 1; i < files.size(); ++i )
+	{
+		LoadCodeGen( files[i] );
 	}
+
+	m_preloadedFiles.clear();
 }
 
 void ObjectDatabase::SetupPackage(const wxString& file,
 #ifdef __WXMSW__
-                                  const wxString& path,
+                                  const wxString& path
 #else
-                                  const wxString& /*path*/,
+                                  const wxString& /*path*/
 #endif
-                                  PwxFBManager manager) {
+                                  ) {
 	#ifdef __WXMSW__
 		wxString libPath = path;
 	#else
@@ -745,36 +1023,26 @@ void ObjectDatabase::SetupPackage(const wxString& file,
 
 	try
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, true, file );
+		ticpp::Document loadedDoc;
+		ticpp::Document& doc = LoadDefinitionFile( file, loadedDoc );
 
 		ticpp::Element* root = doc.FirstChildElement( PACKAGE_TAG );
 
 		// get the library to import
 		std::string lib;
 		root->GetAttributeOrDefault( "lib", &lib, "" );
+		wxString fullLibPath;
 		if ( !lib.empty() )
 		{
-			// Allows plugin dependency dlls to be next to plugin dll in windows
-			wxString workingDir = ::wxGetCwd();
-			wxFileName::SetCwd( libPath );
-			try
+			// Imported by LoadComponentLibrary when one of its classes is used, made absolute
+			// because the working directory may have changed by then
+			wxFileName libFile( libPath + wxFILE_SEP_PATH + _WXSTR(lib) + wxver );
+			libFile.MakeAbsolute();
+			fullLibPath = libFile.GetFullPath();
+			if ( m_importedLibraries.insert( fullLibPath ).second )
 			{
-				wxString fullLibPath = libPath + wxFILE_SEP_PATH + _WXSTR(lib) + wxver;
-				if ( m_importedLibraries.insert( fullLibPath ).second )
-				{
-					ImportComponentLibrary( fullLibPath, manager );
-				}
+				m_pendingLibraries[ fullLibPath ] = libFile.GetPath();
 			}
-			catch ( ... )
-			{
-				// Put Cwd back
-				wxFileName::SetCwd( workingDir );
-				throw;
-			}
-
-			// Put Cwd back
-			wxFileName::SetCwd( workingDir );
 		}
 
 		ticpp::Element* elem_obj = root->FirstChildElement( OBJINFO_TAG, false );
@@ -797,6 +1065,10 @@ void ObjectDatabase::SetupPackage(const wxString& file,
 			elem_obj->GetAttribute( CLASS_TAG, &class_name );
 
 			PObjectInfo class_info = GetObjectInfo( _WXSTR(class_name) );
+			if ( class_info && !fullLibPath.empty() )
+			{
+				class_info->SetComponentLibrary( fullLibPath );
+			}
 
 			ticpp::Element* elem_base = elem_obj->FirstChildElement( "inherits", false );
 			while ( elem_base )
@@ -906,8 +1178,8 @@ void ObjectDatabase::LoadCodeGen( const wxString& file )
 {
 	try
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, true, file );
+		ticpp::Document loadedDoc;
+		ticpp::Document& doc = LoadDefinitionFile( file, loadedDoc );
 
 		// read the codegen element
 		ticpp::Element* elem_codegen = doc.FirstChildElement("codegen");
@@ -979,8 +1251,9 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 
 	try
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, true, file );
+		ticpp::Document loadedDoc;
+		ticpp::Document& doc = LoadDefinitionFile( file, loadedDoc );
+		m_definitionFiles.push_back( file );
 
 		ticpp::Element* root = doc.FirstChildElement( PACKAGE_TAG );
 
@@ -995,20 +1268,14 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 		// Icon Path Attribute
 		std::string pkgIconName;
 		root->GetAttributeOrDefault( ICON_TAG, &pkgIconName, "" );
-		wxString pkgIconPath = iconPath + wxFILE_SEP_PATH +  _WXSTR(pkgIconName);
-
-		wxBitmap pkg_icon;
-		if ( !pkgIconName.empty() && wxFileName::FileExists( pkgIconPath ) )
+		wxString pkgIconPath;
+		if ( !pkgIconName.empty() )
 		{
-			wxImage image( pkgIconPath, wxBITMAP_TYPE_ANY );
-			pkg_icon = wxBitmap( image.Scale( 16, 16 ) );
-		}
-		else
-		{
-			pkg_icon = AppBitmaps::GetBitmap( wxT("unknown"), 16 );
+			pkgIconPath = iconPath + wxFILE_SEP_PATH +  _WXSTR(pkgIconName);
+			IconAtlas::AddIconFile( pkgIconPath );
 		}
 
-		package = PObjectPackage ( new ObjectPackage( _WXSTR(pkg_name), _WXSTR(pkg_desc), pkg_icon ) );
+		package = PObjectPackage ( new ObjectPackage( _WXSTR(pkg_name), _WXSTR(pkg_desc), pkgIconPath ) );
 
 
 		ticpp::Element* elem_obj = root->FirstChildElement( OBJINFO_TAG, false );
@@ -1023,11 +1290,9 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 
 			std::string icon;
 			elem_obj->GetAttributeOrDefault( "icon", &icon, "" );
-			wxString iconFullPath = iconPath + wxFILE_SEP_PATH + _WXSTR(icon);
 
 			std::string smallIcon;
 			elem_obj->GetAttributeOrDefault( "smallIcon", &smallIcon, "" );
-			wxString smallIconFullPath = iconPath + wxFILE_SEP_PATH + _WXSTR(smallIcon);
 
 			std::string wxver;
 			elem_obj->GetAttributeOrDefault( WXVERSION_TAG, &wxver, "" );
@@ -1045,27 +1310,20 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 			bool startGroup;
 			elem_obj->GetAttributeOrDefault( "startgroup", &startGroup, false );
 
-			PObjectInfo obj_info( new ObjectInfo( _WXSTR(class_name), GetObjectType( _WXSTR(type) ), package, startGroup ) );
-
-			if ( !icon.empty() && wxFileName::FileExists( iconFullPath ) )
-			{
-				wxImage img( iconFullPath, wxBITMAP_TYPE_ANY );
-				obj_info->SetIconFile( wxBitmap( img.Scale( ICON_SIZE, ICON_SIZE ) ) );
-			}
-			else
-			{
-				obj_info->SetIconFile( AppBitmaps::GetBitmap( wxT("unknown"), ICON_SIZE ) );
-			}
+			PObjectInfo obj_info( new ObjectInfo( _WXSTR(class_name), GetObjectType( _WXSTR(type) ), package, startGroup, this ) );
 
-			if ( !smallIcon.empty() && wxFileName::FileExists( smallIconFullPath ) )
+			// The icons are decoded when they are shown
+			if ( !icon.empty() )
 			{
-				wxImage img( smallIconFullPath, wxBITMAP_TYPE_ANY );
-				obj_info->SetSmallIconFile( wxBitmap( img.Scale( SMALL_ICON_SIZE, SMALL_ICON_SIZE ) ) );
+				const wxString iconFile = iconPath + wxFILE_SEP_PATH + _WXSTR(icon);
+				obj_info->SetIconFile( iconFile );
+				IconAtlas::AddIconFile( iconFile );
 			}
-			else
+			if ( !smallIcon.empty() )
 			{
-				wxImage img = obj_info->GetIconFile().ConvertToImage();
-				obj_info->SetSmallIconFile( wxBitmap( img.Scale( SMALL_ICON_SIZE, SMALL_ICON_SIZE ) ) );
+				const wxString smallIconFile = iconPath + wxFILE_SEP_PATH + _WXSTR(smallIcon);
+				obj_info->SetSmallIconFile( smallIconFile );
+				IconAtlas::AddIconFile( smallIconFile );
 			}
 
 			// Parse the Properties
@@ -1224,18 +1482,10 @@ void ObjectDatabase::ParseProperties( ticpp::Element* elem_obj, PObjectInfo obj_
 		// add the PropertyInfo to the property
 		obj_info->AddPropertyInfo( prop_info );
 
-		// merge property code templates, once per property type
+		// property code templates are merged once per property type, when the templates of a language are loaded
 		if ( types->insert( ptype ).second )
 		{
-			LangTemplateMap& propLangTemplates = m_propertyTypeTemplates[ ptype ];
-			LangTemplateMap::iterator lang;
-			for ( lang = propLangTemplates.begin(); lang != propLangTemplates.end(); ++lang )
-			{
-				if ( lang->second )
-				{
-					obj_info->AddCodeInfo( lang->first, lang->second );
-				}
-			}
+			m_classPropertyTypes[ obj_info ].push_back( ptype );
 		}
 
 		elem_prop = elem_prop->NextSiblingElement( PROPERTY_TAG, false );
@@ -1364,6 +1614,10 @@ void ObjectDatabase::ImportComponentLibrary( wxString libfile, PwxFBManager mana
 	// Find the GetComponentLibrary function - all plugins must implement this
 	typedef IComponentLibrary* (*PFGetComponentLibrary)( IManager* manager );
 
+	// Only exported by plugins built with version 2 or later of the interface
+	typedef int (*PFGetPluginInterfaceVersion)();
+	PFGetPluginInterfaceVersion GetPluginInterfaceVersion = NULL;
+
 	#ifdef __WXMAC__
 		path += wxT(".dylib");
 
@@ -1394,6 +1648,9 @@ void ObjectDatabase::ImportComponentLibrary( wxString libfile, PwxFBManager mana
 		{
 			m_libs.push_back( handle );
 		}
+
+		GetPluginInterfaceVersion = (PFGetPluginInterfaceVersion) dlsym( handle, "GetPluginInterfaceVersion" );
+		dlerror(); // a missing version is not an error
 	#else
 
 		// Attempt to load the DLL
@@ -1413,6 +1670,11 @@ void ObjectDatabase::ImportComponentLibrary( wxString libfile, PwxFBManager mana
             THROW_WXFBEX( path << " is not a valid component library" )
 		}
 
+		if ( library->HasSymbol( wxT("GetPluginInterfaceVersion") ) )
+		{
+			GetPluginInterfaceVersion = (PFGetPluginInterfaceVersion)library->GetSymbol( wxT("GetPluginInterfaceVersion") );
+		}
+
 #endif
         LogDebug("[Database::ImportComponentLibrary] Importing " + path + " library");
 	// Get the component library
@@ -1421,11 +1683,22 @@ void ObjectDatabase::ImportComponentLibrary( wxString libfile, PwxFBManager mana
 	// Store the function to free the library
 	m_componentLibs[ FreeComponentLibrary ] = comp_lib;
 
+	const int interfaceVersion = ( GetPluginInterfaceVersion ? GetPluginInterfaceVersion() : 1 );
+	if ( interfaceVersion < WXFB_PLUGIN_INTERFACE_VERSION )
+	{
+		LogDebug( wxString::Format( wxT("%s was built with version %d of the plugin interface"), path, interfaceVersion ) );
+	}
+
 	// Import all of the components
 	for ( unsigned int i = 0; i < comp_lib->GetComponentCount(); i++ )
 	{
 		wxString class_name = comp_lib->GetComponentName( i );
 		IComponent* comp = comp_lib->GetComponent( i );
+		if ( interfaceVersion < 2 )
+		{
+			m_legacyComponents.push_back( std::shared_ptr< IComponent >( new LegacyComponent( comp ) ) );
+			comp = m_legacyComponents.back().get();
+		}
 
 		// Look for the class in the data read from the .xml files
 		PObjectInfo class_info = GetObjectInfo( class_name );
@@ -29,7 +29,10 @@
 #include "../utils/wxfbdefs.h"
 #include "types.h"
 
+#include <map>
+#include <memory>
 #include <set>
+#include <vector>
 #include <wx/dynlib.h>
 
 class ObjectDatabase;
@@ -40,6 +43,7 @@ typedef std::shared_ptr<ObjectDatabase> PObjectDatabase;
 
 namespace ticpp
 {
+	class Document;
 	class Element;
 }
 
@@ -52,6 +56,7 @@ class ObjectPackage
  private:
   wxString m_name;    // nombre del paquete
   wxString m_desc;  // breve descripción del paquete
+  wxString m_iconFile;
   wxBitmap m_icon;	// The icon for the notebook page
 
   // Vector con los objetos que están contenidos en el paquete
@@ -61,7 +66,7 @@ class ObjectPackage
   /**
    * Constructor.
    */
-  ObjectPackage(wxString name, wxString desc, wxBitmap icon);
+  ObjectPackage(wxString name, wxString desc, const wxString& iconFile);
 
   /**
    * Incluye en el paquete la información de un objeto.
@@ -79,9 +84,9 @@ class ObjectPackage
   wxString GetPackageDescription() { return m_desc; }
 
   /**
-   * Get Package Icon
+   * Get Package Icon, decoded through the icon atlas the first time.
    */
-  wxBitmap GetPackageIcon() { return m_icon; }
+  wxBitmap GetPackageIcon();
 
   /**
    * Obtiene el número de objetos incluidos en el paquete.
@@ -101,6 +106,7 @@ class ObjectPackage
 
 };
 
+class IComponent;
 class IComponentLibrary;
 
 /**
@@ -137,6 +143,9 @@ class ObjectDatabase
   PTMap m_propTypes;
   LibraryVector m_libs;
   ComponentLibraryMap m_componentLibs;
+
+  // Adapters of the components of libraries built with an older plugin interface
+  std::vector< std::shared_ptr< IComponent > > m_legacyComponents;
   ObjectTypeMap m_types; // register object types
 
   // para comprobar que no se nos han quedado macros sin añadir en las
@@ -149,6 +158,24 @@ class ObjectDatabase
   // used so libraries are only imported once, even if multiple libraries use them
   std::set< wxString > m_importedLibraries;
 
+  // Object description and code template files, in load order
+  std::vector< wxString > m_definitionFiles;
+
+  // Passed to the component libraries when they are imported
+  PwxFBManager m_manager;
+
+  // Component libraries not imported yet, the full path mapped to the directory to import them from
+  std::map< wxString, wxString > m_pendingLibraries;
+
+  // Code template files not loaded yet by language, in load order with the property templates first
+  std::map< wxString, std::vector< wxString > > m_pendingTemplates;
+
+  // Property types of each class, in the order their templates are merged into the class templates
+  std::map< PObjectInfo, std::vector< PropertyType > > m_classPropertyTypes;
+
+  // Definition files parsed by PreloadDefinitionFiles, by path, while the plugins are loaded
+  std::map< wxString, std::unique_ptr< ticpp::Document > > m_preloadedFiles;
+
   PTLangTemplateMap m_propertyTypeTemplates;
 
   /**
@@ -156,12 +183,30 @@ class ObjectDatabase
    */
   void InitPropertyTypes();
 
+  /**
+   * Parses the definition files in parallel, before the objects are created from them in order.
+   * Files which are not valid UTF-8 XML with a declaration are left to LoadDefinitionFile, which
+   * may ask the user to convert them.
+   */
+  void PreloadDefinitionFiles( const std::vector< wxString >& files );
+
+  /**
+   * The document of a definition file, preloaded or else loaded into doc.
+   * @throw wxFBException If the file could not be loaded.
+   */
+  ticpp::Document& LoadDefinitionFile( const wxString& file, ticpp::Document& doc );
+
   /**
    * Carga las plantillas de generación de código de un fichero
    * xml de código dado
    */
   void LoadCodeGen( const wxString& file );
 
+  /**
+   * Queues a code template file, loaded by LoadCodeTemplates the first time its language is used.
+   */
+  void DeferCodeGen( const wxString& language, const wxString& file );
+
   /**
    * Carga los objetos de un paquete con todas sus propiedades salvo
    * los objetos heredados
@@ -180,8 +225,9 @@ class ObjectDatabase
   /**
    * Incluye la información heredada de los objetos de un paquete.
    * En la segunda pasada configura cada paquete con sus objetos base.
+   * The component library is only registered, it is imported when one of its classes needs it.
    */
-  void SetupPackage( const wxString& file, const wxString& path, PwxFBManager manager );
+  void SetupPackage( const wxString& file, const wxString& path );
 
   /**
    * Determina si el tipo de objeto hay que incluirlo en la paleta de
@@ -240,6 +286,29 @@ class ObjectDatabase
    */
   void LoadPlugins( PwxFBManager manager );
 
+  /**
+   * Imports a component library registered by the plugins, if it was not imported yet.
+   * Errors are logged.
+   */
+  void LoadComponentLibrary( const wxString& library );
+
+  /**
+   * Imports the pending component libraries when the macro is declared by the plugins
+   * but was not registered yet, as its library was not needed so far.
+   * @return true if any library was imported.
+   */
+  bool LoadMacroLibraries( const wxString& macro );
+
+  /**
+   * Loads the code templates of a language, if they were not loaded yet.
+   */
+  void LoadCodeTemplates( const wxString& language );
+
+  /**
+   * Object description and code template files, the generated code depends on them.
+   */
+  const std::vector< wxString >& GetDefinitionFiles() const { return m_definitionFiles; }
+
   /**
    * Fabrica de objetos.
    * A partir del nombre de la clase se crea una nueva instancia de un objeto.
@@ -26,6 +26,8 @@
 #include "objectbase.h"
 
 #include "../rad/appdata.h"
+#include "../rad/bitmaps.h"
+#include "../rad/iconatlas.h"
 #include "../utils/debug.h"
 #include "../utils/stringutils.h"
 #include "../utils/typeconv.h"
@@ -94,39 +96,47 @@ bool Property::IsNull()
 void Property::SetDefaultValue()
 {
 	m_value = m_info->GetDefaultValue();
+	m_intRevision = 0;
 }
 
 void Property::SetValue(const wxFontContainer &font)
 {
 	m_value = TypeConv::FontToString( font );
+	m_intRevision = 0;
 }
 void Property::SetValue(const wxColour &colour)
 {
 	m_value = TypeConv::ColourToString( colour );
+	m_intRevision = 0;
 }
 void Property::SetValue(const wxString &str, bool format)
 {
 	m_value = (format ? TypeConv::TextToString(str) : str );
+	m_intRevision = 0;
 }
 
 void Property::SetValue(const wxPoint &point)
 {
 	m_value = TypeConv::PointToString(point);
+	m_intRevision = 0;
 }
 
 void Property::SetValue(const wxSize &size)
 {
 	m_value = TypeConv::SizeToString(size);
+	m_intRevision = 0;
 }
 
 void Property::SetValue(const int integer)
 {
 	m_value = StringUtils::IntToStr(integer);
+	m_intRevision = 0;
 }
 
 void Property::SetValue(const double val )
 {
 	m_value = TypeConv::FloatToString( val );
+	m_intRevision = 0;
 }
 
 wxFontContainer Property::GetValueAsFont()
@@ -161,11 +171,18 @@ int Property::GetValueAsInteger()
 	case PT_EDIT_OPTION:
 	case PT_OPTION:
 	case PT_MACRO:
-		result = TypeConv::GetMacroValue(m_value);
-		break;
 	case PT_BITLIST:
-		result = TypeConv::BitlistToInt(m_value);
+	{
+		// Parsed once per value, designer rebuilds read the styles of every widget
+		unsigned long revision = MacroDictionary::GetInstance()->GetRevision();
+		if ( m_intRevision != revision )
+		{
+			m_intValue = ( PT_BITLIST == GetType() ? TypeConv::BitlistToInt(m_value) : TypeConv::GetMacroValue(m_value) );
+			m_intRevision = revision;
+		}
+		result = m_intValue;
 		break;
+	}
 	default:
 		result = TypeConv::StringToInt(m_value);
 		break;
@@ -346,7 +363,54 @@ PEvent ObjectBase::GetEvent (unsigned int idx)
 
 void ObjectBase::AddProperty (PProperty prop)
 {
-	m_properties.insert( PropertyMap::value_type( prop->GetName(), prop ) );
+	if ( m_properties.insert( PropertyMap::value_type( prop->GetName(), prop ) ).second )
+	{
+		m_propertySlots.push_back( std::make_pair( prop.get(), prop->GetPropertyInfo().get() ) );
+	}
+}
+
+Property* ObjectBase::FindProperty( const PropertyKey& key )
+{
+	ObjectInfo::PropertySlot slot = { (size_t)-1, NULL };
+	if ( m_info->GetPropertySlot( key, &slot ) && slot.index < m_propertySlots.size() &&
+		m_propertySlots[ slot.index ].second == slot.info )
+	{
+		return m_propertySlots[ slot.index ].first;
+	}
+
+	// First lookup of the key in this class, or an object with other properties
+	Property* property = FindProperty( wxString::FromUTF8( key.GetName() ), &slot );
+	if ( property )
+	{
+		m_info->SetPropertySlot( key, slot );
+	}
+	return property;
+}
+
+Property* ObjectBase::FindProperty( const wxString& name, ObjectInfo::PropertySlot* slot )
+{
+	if ( slot->index < m_propertySlots.size() && m_propertySlots[ slot->index ].second == slot->info )
+	{
+		return m_propertySlots[ slot->index ].first;
+	}
+
+	PropertyMap::iterator it = m_properties.find( name );
+	if ( it == m_properties.end() )
+	{
+		return NULL;
+	}
+
+	Property* property = it->second.get();
+	for ( size_t i = 0; i < m_propertySlots.size(); ++i )
+	{
+		if ( m_propertySlots[i].first == property )
+		{
+			slot->index = i;
+			slot->info = m_propertySlots[i].second;
+			break;
+		}
+	}
+	return property;
 }
 
 void ObjectBase::AddEvent(PEvent event)
@@ -742,6 +806,110 @@ wxArrayString ObjectBase::GetPropertyAsArrayString(const wxString& pname)
 		return wxArrayString();
 }
 
+bool ObjectBase::IsNullByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->IsNull();
+	else
+		return true;
+}
+
+int ObjectBase::GetPropertyAsIntegerByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsInteger();
+	else
+		return 0;
+}
+
+wxFontContainer ObjectBase::GetPropertyAsFontByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsFont();
+	else
+		return wxFontContainer();
+}
+
+wxColour ObjectBase::GetPropertyAsColourByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsColour();
+	else
+		return wxColour();
+}
+
+wxString ObjectBase::GetPropertyAsStringByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsString();
+	else
+		return wxString();
+}
+
+wxPoint ObjectBase::GetPropertyAsPointByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsPoint();
+	else
+		return wxPoint();
+}
+
+wxSize ObjectBase::GetPropertyAsSizeByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsSize();
+	else
+		return wxDefaultSize;
+}
+
+wxBitmap ObjectBase::GetPropertyAsBitmapByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsBitmap();
+	else
+		return wxBitmap();
+}
+
+double ObjectBase::GetPropertyAsFloatByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsFloat();
+	else
+		return 0;
+}
+
+wxArrayInt ObjectBase::GetPropertyAsArrayIntByKey( const PropertyKey& key )
+{
+	wxArrayInt array;
+	Property* property = FindProperty( key );
+	if (property)
+	{
+		IntList il( property->GetValue(), property->GetType() == PT_UINTLIST );
+		for (unsigned int i=0; i < il.GetSize() ; i++)
+			array.Add(il.GetValue(i));
+	}
+
+	return array;
+}
+
+wxArrayString ObjectBase::GetPropertyAsArrayStringByKey( const PropertyKey& key )
+{
+	Property* property = FindProperty( key );
+	if (property)
+		return property->GetValueAsArrayString();
+	else
+		return wxArrayString();
+}
+
 wxString ObjectBase::GetChildFromParentProperty( const wxString& parentName, const wxString& childName )
 {
 	PProperty property = GetProperty( parentName );
@@ -753,7 +921,7 @@ wxString ObjectBase::GetChildFromParentProperty( const wxString& parentName, con
 
 ///////////////////////////////////////////////////////////////////////////////
 
-ObjectInfo::ObjectInfo(wxString class_name, PObjectType type, WPObjectPackage package, bool startGroup )
+ObjectInfo::ObjectInfo(wxString class_name, PObjectType type, WPObjectPackage package, bool startGroup, ObjectDatabase* database )
 {
 	m_class = class_name;
 	m_type = type;
@@ -762,6 +930,51 @@ ObjectInfo::ObjectInfo(wxString class_name, PObjectType type, WPObjectPackage pa
 	m_package = package;
 	m_category = PPropertyCategory( new PropertyCategory( m_class ) );
 	m_startGroup = startGroup;
+	m_database = database;
+}
+
+IComponent* ObjectInfo::GetComponent()
+{
+	if ( !m_component && !m_library.empty() && m_database )
+	{
+		// Asked once, importing the library sets the components of all its classes
+		wxString library;
+		library.swap( m_library );
+		m_database->LoadComponentLibrary( library );
+	}
+	return m_component;
+}
+
+wxBitmap ObjectInfo::GetIconFile()
+{
+	if ( !m_icon.IsOk() )
+	{
+		m_icon = IconAtlas::Get( ICON_SIZE )->GetIcon( m_iconFile );
+		if ( !m_icon.IsOk() )
+		{
+			m_icon = AppBitmaps::GetBitmap( wxT("unknown"), ICON_SIZE );
+		}
+	}
+	return m_icon;
+}
+
+wxBitmap ObjectInfo::GetSmallIconFile()
+{
+	if ( !m_smallIcon.IsOk() )
+	{
+		IconAtlas* atlas = IconAtlas::Get( SMALL_ICON_SIZE );
+		m_smallIcon = atlas->GetIcon( m_smallIconFile );
+		if ( !m_smallIcon.IsOk() )
+		{
+			// Without a small icon, the icon is scaled down
+			m_smallIcon = atlas->GetIcon( m_iconFile );
+		}
+		if ( !m_smallIcon.IsOk() )
+		{
+			m_smallIcon = AppBitmaps::GetBitmap( wxT("unknown"), SMALL_ICON_SIZE );
+		}
+	}
+	return m_smallIcon;
 }
 
 PObjectPackage ObjectInfo::GetPackage()
@@ -831,6 +1044,23 @@ PEventInfo ObjectInfo::GetEventInfo(unsigned int idx)
 	return result;
 }
 
+bool ObjectInfo::GetPropertySlot( const PropertyKey& key, PropertySlot* slot )
+{
+	std::map< const char*, PropertySlot >::iterator it = m_propertySlots.find( key.GetName() );
+	if ( it == m_propertySlots.end() )
+	{
+		return false;
+	}
+
+	*slot = it->second;
+	return true;
+}
+
+void ObjectInfo::SetPropertySlot( const PropertyKey& key, const PropertySlot& slot )
+{
+	m_propertySlots[ key.GetName() ] = slot;
+}
+
 void ObjectInfo::AddPropertyInfo( PPropertyInfo prop )
 {
 	m_properties.insert( PropertyInfoMap::value_type(prop->GetName(), prop) );
@@ -964,6 +1194,11 @@ void ObjectInfo::AddCodeInfo(wxString lang, PCodeInfo codeinfo)
 
 PCodeInfo ObjectInfo::GetCodeInfo(wxString lang)
 {
+	if ( m_database )
+	{
+		m_database->LoadCodeTemplates( lang );
+	}
+
 	PCodeInfo result;
 	std::map< wxString, PCodeInfo >::iterator it = m_codeTemp.find(lang);
 	if (it != m_codeTemp.end())
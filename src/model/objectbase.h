@@ -39,6 +39,8 @@
 #include <component.h>
 #include <list>
 
+class ObjectDatabase;
+
 ///////////////////////////////////////////////////////////////////////////////
 
 class OptionList
@@ -139,8 +141,16 @@ private:
 
 	wxString m_value;
 
+	// GetValueAsInteger() of a macro or bitlist value, converted with the macro revision
+	// m_intRevision (0 when there is none). Valid until the value or the macros change.
+	int m_intValue;
+	unsigned long m_intRevision;
+
 public:
 	Property(PPropertyInfo info, PObjectBase obj = PObjectBase())
+	:
+	m_intValue( 0 ),
+	m_intRevision( 0 )
 	{
 		m_object = obj;
 		m_info = info;
@@ -149,8 +159,8 @@ public:
 	PObjectBase GetObject() { return m_object.lock(); }
 	wxString GetName()                 { return m_info->GetName(); }
 	wxString GetValue()                { return m_value; }
-	void SetValue( wxString& val )     { m_value = val; }
-	void SetValue( const wxChar* val )       { m_value = val;	}
+	void SetValue( wxString& val )     { m_value = val; m_intRevision = 0; }
+	void SetValue( const wxChar* val )       { m_value = val; m_intRevision = 0; }
 
 	PPropertyInfo GetPropertyInfo() { return m_info; }
 	PropertyType  GetType()         { return m_info->GetType();  }
@@ -279,6 +289,8 @@ private:
 
 	ObjectBaseVector m_children;
 	PropertyMap      m_properties;
+	// Properties in the order they were added, with their descriptors, for PropertyKey lookups
+	std::vector< std::pair< Property*, PropertyInfo* > > m_propertySlots;
 	EventMap         m_events;
 	PObjectInfo      m_info;
 	bool m_expanded; // is expanded in the object tree, allows for saving to file
@@ -412,6 +424,19 @@ public:
 	*/
 	PProperty GetProperty (unsigned int idx); // throws ...;
 
+	/**
+	* Gets the property of a key, through the index of the property cached by the class.
+	* @return NULL if the object has no such property.
+	*/
+	Property* FindProperty( const PropertyKey& key );
+
+	/**
+	* Gets a property through a slot kept by the caller for the objects of a class.
+	* The property is found by name, and the slot updated, if the slot does not hold it.
+	* @return NULL if the object has no such property.
+	*/
+	Property* FindProperty( const wxString& name, ObjectInfo::PropertySlot* slot );
+
 	PEvent GetEvent (unsigned int idx); // throws ...;
 
 	/**
@@ -530,6 +555,18 @@ public:
 
 	wxArrayInt GetPropertyAsArrayInt(const wxString& pname) override;
 	wxArrayString GetPropertyAsArrayString(const wxString& pname) override;
+
+	bool IsNullByKey(const PropertyKey& key) override;
+	int GetPropertyAsIntegerByKey(const PropertyKey& key) override;
+	wxFontContainer GetPropertyAsFontByKey(const PropertyKey& key) override;
+	wxColour GetPropertyAsColourByKey(const PropertyKey& key) override;
+	wxString GetPropertyAsStringByKey(const PropertyKey& key) override;
+	wxPoint GetPropertyAsPointByKey(const PropertyKey& key) override;
+	wxSize GetPropertyAsSizeByKey(const PropertyKey& key) override;
+	wxBitmap GetPropertyAsBitmapByKey(const PropertyKey& key) override;
+	double GetPropertyAsFloatByKey(const PropertyKey& key) override;
+	wxArrayInt GetPropertyAsArrayIntByKey(const PropertyKey& key) override;
+	wxArrayString GetPropertyAsArrayStringByKey(const PropertyKey& key) override;
 	wxString GetChildFromParentProperty(const wxString& parentName,
 	                                    const wxString& childName) override;
 
@@ -565,7 +602,7 @@ public:
 	/**
 	* Constructor.
 	*/
-	ObjectInfo(wxString class_name, PObjectType type, WPObjectPackage package, bool startGroup = false );
+	ObjectInfo(wxString class_name, PObjectType type, WPObjectPackage package, bool startGroup = false, ObjectDatabase* database = NULL );
 
 	virtual ~ObjectInfo() {};
 
@@ -583,6 +620,19 @@ public:
 	PEventInfo GetEventInfo(wxString name);
 	PEventInfo GetEventInfo(unsigned int idx);
 
+	/**
+	* Index of a property in the objects of this class, found by the first lookup of a
+	* PropertyKey. The descriptor identifies the property at that index.
+	*/
+	struct PropertySlot
+	{
+		size_t index;
+		PropertyInfo* info;
+	};
+
+	bool GetPropertySlot( const PropertyKey& key, PropertySlot* slot );
+	void SetPropertySlot( const PropertyKey& key, const PropertySlot& slot );
+
 	/**
 	* Añade un descriptor de propiedad al descriptor de objeto.
 	*/
@@ -654,11 +704,14 @@ public:
 	void GetBaseClasses(std::vector<PObjectInfo> &classes, bool inherited = true);
 	unsigned int GetBaseClassCount(bool inherited = true);
 
-	void SetIconFile(wxBitmap icon) { m_icon = icon; };
-	wxBitmap GetIconFile() { return m_icon; }
+	/**
+	* The icons are decoded through the icon atlas the first time they are shown.
+	*/
+	void SetIconFile( const wxString& path ) { m_iconFile = path; }
+	wxBitmap GetIconFile();
 
-	void SetSmallIconFile(wxBitmap icon) { m_smallIcon = icon; };
-	wxBitmap GetSmallIconFile() { return m_smallIcon; }
+	void SetSmallIconFile( const wxString& path ) { m_smallIconFile = path; }
+	wxBitmap GetSmallIconFile();
 
 	void AddCodeInfo(wxString lang, PCodeInfo codeinfo);
 	PCodeInfo GetCodeInfo(wxString lang);
@@ -671,7 +724,26 @@ public:
 	* Le asigna un componente a la clase.
 	*/
 	void SetComponent(IComponent *c) { m_component = c; };
-	IComponent* GetComponent() { return m_component; };
+
+	/**
+	* The component of the class, importing its library the first time it is asked for.
+	*/
+	IComponent* GetComponent();
+
+	/**
+	* Library expected to provide the component, imported by GetComponent.
+	*/
+	void SetComponentLibrary( const wxString& library ) { m_library = library; }
+
+	/**
+	* Library still pending to provide the component, empty once it has been imported.
+	*/
+	const wxString& GetComponentLibrary() const { return m_library; }
+
+	/**
+	* Checks for a component without importing its library.
+	*/
+	bool HasComponent() { return m_component != NULL || !m_library.empty(); }
 
 private:
 	wxString m_class;         // nombre de la clase (tipo de objeto)
@@ -681,6 +753,8 @@ private:
 
 	PPropertyCategory m_category;
 
+	wxString m_iconFile;
+	wxString m_smallIconFile;
 	wxBitmap m_icon;
 	wxBitmap m_smallIcon; // The icon for the property grid toolbar
 	bool m_startGroup; // Place a separator in the palette toolbar just before this widget
@@ -692,10 +766,16 @@ private:
 	std::map< wxString, PPropertyInfo > m_properties;
 	std::map< wxString, PEventInfo >    m_events;
 
+	// Slots of the keys used by the plugins, by address of the key name (main thread only)
+	std::map< const char*, PropertySlot > m_propertySlots;
+
 	std::vector< PObjectInfo > m_base; // base classes
 	std::map< size_t, std::map< wxString, wxString > > m_baseClassDefaultPropertyValues;
 	IComponent* m_component;  // componente asociado a la clase los objetos del
 	// designer
+
+	ObjectDatabase* m_database; // Imports the library and loads the code templates on first use
+	wxString m_library;
 };
 
 #endif
@@ -26,9 +26,107 @@
 #include "xrcfilter.h"
 
 #include "../utils/debug.h"
+#include "../utils/stringutils.h"
 #include "../utils/typeconv.h"
+#include "../utils/wxfbexception.h"
+#include "../utils/xmlreader.h"
 #include "objectbase.h"
 
+#include <wx/fontmap.h>
+#include <wx/ffile.h>
+
+#include <memory>
+
+namespace
+{
+	void SetAttributes( const XmlReader& reader, TiXmlElement* element )
+	{
+		const XmlReader::Attributes& attributes = reader.GetAttributes();
+		for ( XmlReader::Attributes::const_iterator it = attributes.begin(); it != attributes.end(); ++it )
+		{
+			element->SetAttribute( it->first.c_str(), it->second.c_str() );
+		}
+	}
+}
+
+/**
+ * Sets the properties imported by IComponent::ReadXrc straight into an object, through
+ * the import table of its class. Without an object the properties are discarded.
+ */
+class XfbObjectWriter : public IXfbWriter
+{
+private:
+	XrcLoader* m_loader;
+	PObjectBase m_object;
+	XrcLoader::ImportTable* m_table;
+	size_t m_next;
+	std::vector< std::unique_ptr< XfbObjectWriter > > m_children;
+
+public:
+	XfbObjectWriter( XrcLoader* loader, PObjectBase object, XrcLoader::ImportTable* table )
+	:
+	m_loader( loader ),
+	m_object( object ),
+	m_table( table ),
+	m_next( 0 )
+	{
+	}
+
+	void SetProperty( const wxString& name, const wxString& value ) override
+	{
+		if ( !m_object )
+		{
+			return;
+		}
+
+		// Components write the properties in the same order for all the objects of a class,
+		// so the next entry of the table is usually the right one
+		std::vector< std::pair< wxString, ObjectInfo::PropertySlot > >& slots = m_table->slots;
+		size_t index = m_next;
+		if ( index >= slots.size() || slots[ index ].first != name )
+		{
+			for ( index = 0; index < slots.size() && slots[ index ].first != name; ++index )
+			{
+			}
+
+			if ( index == slots.size() )
+			{
+				ObjectInfo::PropertySlot slot = { (size_t)-1, NULL };
+				slots.push_back( std::make_pair( name, slot ) );
+			}
+		}
+		m_next = index + 1;
+
+		Property* property = m_object->FindProperty( name, &slots[ index ].second );
+		if ( property )
+		{
+			property->SetValue( value );
+		}
+		else if ( !value.empty() )
+		{
+			wxLogError( _("The property \"%s\" of class \"%s\" is not supported by this version of wxFormBuilder, its imported value is lost: %s"),
+						name.c_str(), m_object->GetClassName().c_str(), value.c_str() );
+		}
+	}
+
+	IXfbWriter* AddObject( const wxString& classname ) override
+	{
+		PObjectBase child;
+		XrcLoader::ImportTable* table = NULL;
+		if ( m_object )
+		{
+			child = m_loader->CreateObject( std::string( classname.mb_str( wxConvUTF8 ) ), m_object );
+			if ( child )
+			{
+				table = &m_loader->m_tables[ child->GetObjectInfo().get() ];
+			}
+		}
+
+		m_children.push_back( std::unique_ptr< XfbObjectWriter >( new XfbObjectWriter( m_loader, child, table ) ) );
+		return m_children.back().get();
+	}
+};
+
 PObjectBase XrcLoader::GetProject( ticpp::Document* xrcDoc )
 {
 	assert( m_objDb );
@@ -54,40 +152,98 @@ PObjectBase XrcLoader::GetProject( ticpp::Document* xrcDoc )
 	return project;
 }
 
-PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
+PObjectBase XrcLoader::GetProject( const wxString& path )
 {
-	// First, create the object by the name, the modify the properties
+	assert( m_objDb );
+	LogDebug( wxT( "[XrcFilter::GetProject] %s" ), path.c_str() );
 
-	std::string className = xrcObj->GetAttribute( "class" );
-	if ( parent->GetObjectTypeName() == wxT( "project" ) )
+	std::string data;
 	{
-		if ( className == "wxBitmap" )
+		wxFFile file( path, wxT( "rb" ) );
+		if ( !file.IsOpened() )
 		{
-			PProperty bitmapsProp = parent->GetProperty( _( "bitmaps" ) );
-			if ( bitmapsProp )
-			{
-				wxString value = bitmapsProp->GetValue();
-				wxString text = _WXSTR( xrcObj->GetText() );
-				text.Replace( wxT( "\'" ), wxT( "\'\'" ), true );
-				value << wxT( "\'" ) << text << wxT( "\' " );
-				bitmapsProp->SetValue( value );
-				return PObjectBase();
-			}
+			THROW_WXFBEX( _( "Unable to open the XRC file: " ) << path )
 		}
-		if ( className == "wxIcon" )
+
+		data.resize( (size_t)file.Length() );
+		if ( !data.empty() && file.Read( &data[0], data.size() ) != data.size() )
 		{
-			PProperty iconsProp = parent->GetProperty( _( "icons" ) );
-			if ( iconsProp )
+			THROW_WXFBEX( _( "Unable to read the XRC file: " ) << path )
+		}
+	}
+
+	XmlReader reader( data.data(), data.data() + data.size() );
+	XmlReader::NodeType type;
+	do
+	{
+		type = reader.Next();
+	}
+	while ( XmlReader::NODE_TEXT == type );
+
+	// Other encodings are converted by LoadXMLFile, once the user agrees
+	if ( !reader.HasDeclaration() ||
+		wxFontMapperBase::GetEncodingFromName( _WXSTR( reader.GetEncoding() ).Lower() ) != wxFONTENCODING_UTF8 )
+	{
+		data.clear();
+		ticpp::Document doc;
+		XMLUtils::LoadXMLFile( doc, false, path );
+		return GetProject( &doc );
+	}
+
+	PObjectBase project( m_objDb->CreateObject( "Project" ) );
+
+	if ( XmlReader::NODE_START != type || reader.GetName() != "resource" )
+	{
+		wxLogError( _( "Missing root element \"resource\"" ) );
+		return project;
+	}
+
+	while ( ( type = reader.Next() ) != XmlReader::NODE_END )
+	{
+		if ( XmlReader::NODE_END_OF_DOCUMENT == type )
+		{
+			THROW_WXFBEX( _( "The root element \"resource\" is not closed" ) )
+		}
+
+		if ( XmlReader::NODE_START == type )
+		{
+			if ( reader.GetName() == "object" )
 			{
-				wxString value = iconsProp->GetValue();
-				wxString text = _WXSTR( xrcObj->GetText() );
-				text.Replace( wxT( "\'" ), wxT( "\'\'" ), true );
-				value << wxT( "\'" ) << text << wxT( "\' " );
-				iconsProp->SetValue( value );
-				return PObjectBase();
+				ReadObject( reader, project );
+			}
+			else
+			{
+				reader.SkipElement();
 			}
 		}
+	}
+
+	return project;
+}
 
+XrcLoader::ImportTable* XrcLoader::GetImportTable( PObjectInfo info )
+{
+	IComponent* comp = info->GetComponent();
+	if ( !comp )
+	{
+		return NULL;
+	}
+
+	ImportTable& table = m_tables[ info.get() ];
+	if ( table.readXrc < 0 )
+	{
+		// Ask with an empty element, the properties written are discarded
+		ticpp::Element probe( "object" );
+		XfbObjectWriter writer( this, PObjectBase(), &table );
+		table.readXrc = ( comp->ReadXrc( &probe, &writer ) ? 1 : 0 );
+	}
+	return &table;
+}
+
+std::string XrcLoader::GetClassName( std::string className, PObjectBase parent )
+{
+	if ( parent->GetObjectTypeName() == wxT( "project" ) )
+	{
 		// Forms wxPanel, wxFrame, wxDialog are stored internally as Panel, Frame, and Dialog
 		// to prevent conflicts with wxPanel as a container
 		className = className.substr( 2, className.size() - 2 );
@@ -124,6 +280,182 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 		}
 	}
 
+	return className;
+}
+
+PObjectBase XrcLoader::CreateObject( const std::string& className, PObjectBase parent )
+{
+	PObjectBase container = parent;
+	PObjectBase newobject = m_objDb->CreateObject( className, parent );
+	if ( !newobject )
+	{
+		// Unable to create the object and add it to the parent - probably needs a sizer
+		PObjectBase newsizer = m_objDb->CreateObject( "wxBoxSizer", parent );
+		if ( !newsizer )
+		{
+			return PObjectBase();
+		}
+
+		// It is possible the CreateObject returns an "item" containing the object, e.g. SizerItem or SplitterItem
+		container = ( newsizer->GetChildCount() > 0 ? newsizer->GetChild( 0 ) : newsizer );
+		newobject = m_objDb->CreateObject( className, container );
+		if ( !newobject )
+		{
+			return PObjectBase();
+		}
+
+		parent->AddChild( newsizer );
+		newsizer->SetParent( parent );
+	}
+
+	container->AddChild( newobject );
+	newobject->SetParent( container );
+
+	if ( newobject->GetChildCount() > 0 )
+	{
+		return newobject->GetChild( 0 );
+	}
+	return newobject;
+}
+
+void XrcLoader::ReadObject( XmlReader& reader, PObjectBase parent )
+{
+	const std::string* xrcClass = reader.FindAttribute( "class" );
+	std::string className = ( xrcClass ? *xrcClass : std::string() );
+	int row = reader.GetRow();
+
+	// Bitmaps and icons of the project are not objects
+	ImportTable* table = NULL;
+	PObjectInfo objInfo;
+	if ( !( parent->GetObjectTypeName() == wxT( "project" ) && ( className == "wxBitmap" || className == "wxIcon" ) ) )
+	{
+		className = GetClassName( className, parent );
+		objInfo = m_objDb->GetObjectInfo( _WXSTR( className ) );
+		if ( objInfo )
+		{
+			table = GetImportTable( objInfo );
+		}
+	}
+
+	if ( !table || !table->readXrc )
+	{
+		// ImportFromXrc may look at the children, so load the whole object
+		ticpp::Element xrcObj( "object" );
+		SetAttributes( reader, xrcObj.GetTiXmlPointer() );
+		ReadElement( reader, xrcObj.GetTiXmlPointer() );
+		GetObject( &xrcObj, parent );
+		return;
+	}
+
+	PObjectBase object = CreateObject( className, parent );
+	if ( !object )
+	{
+		wxLogError( wxT( "CreateObject failed for class \"%s\", with parent \"%s\", found on line %i" ), _WXSTR( className ).c_str(), parent->GetClassName().c_str(), row );
+		reader.SkipElement();
+		return;
+	}
+
+	// The children are created as they are read, the component only gets their class and name
+	ticpp::Element xrcObj( "object" );
+	SetAttributes( reader, xrcObj.GetTiXmlPointer() );
+	while ( true )
+	{
+		XmlReader::NodeType type = reader.Next();
+		if ( XmlReader::NODE_END == type )
+		{
+			break;
+		}
+		else if ( XmlReader::NODE_END_OF_DOCUMENT == type )
+		{
+			THROW_WXFBEX( _( "The object found on line " ) << row << _( " is not closed" ) )
+		}
+		else if ( XmlReader::NODE_START == type )
+		{
+			TiXmlElement* child = new TiXmlElement( reader.GetName().c_str() );
+			SetAttributes( reader, child );
+			xrcObj.GetTiXmlPointer()->LinkEndChild( child );
+
+			if ( reader.GetName() == "object" )
+			{
+				ReadObject( reader, object );
+			}
+			else
+			{
+				ReadElement( reader, child );
+			}
+		}
+	}
+
+	XfbObjectWriter writer( this, object, table );
+	objInfo->GetComponent()->ReadXrc( &xrcObj, &writer );
+}
+
+void XrcLoader::ReadElement( XmlReader& reader, TiXmlElement* element )
+{
+	while ( true )
+	{
+		switch ( reader.Next() )
+		{
+			case XmlReader::NODE_START:
+			{
+				TiXmlElement* child = new TiXmlElement( reader.GetName().c_str() );
+				SetAttributes( reader, child );
+				element->LinkEndChild( child );
+				ReadElement( reader, child );
+				break;
+			}
+			case XmlReader::NODE_TEXT:
+				// As TinyXML, drop the text which is only whitespace
+				if ( reader.GetText().find_first_not_of( " \t\n\r" ) != std::string::npos )
+				{
+					element->LinkEndChild( new TiXmlText( reader.GetText().c_str() ) );
+				}
+				break;
+			case XmlReader::NODE_END:
+				return;
+			case XmlReader::NODE_END_OF_DOCUMENT:
+				THROW_WXFBEX( _( "Unexpected end of the XRC file, the element \"" ) << _WXSTR( element->ValueStr() ) << _( "\" is not closed" ) )
+		}
+	}
+}
+
+PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
+{
+	// First, create the object by the name, the modify the properties
+
+	std::string className = xrcObj->GetAttribute( "class" );
+	if ( parent->GetObjectTypeName() == wxT( "project" ) )
+	{
+		if ( className == "wxBitmap" )
+		{
+			PProperty bitmapsProp = parent->GetProperty( _( "bitmaps" ) );
+			if ( bitmapsProp )
+			{
+				wxString value = bitmapsProp->GetValue();
+				wxString text = _WXSTR( xrcObj->GetText() );
+				text.Replace( wxT( "\'" ), wxT( "\'\'" ), true );
+				value << wxT( "\'" ) << text << wxT( "\' " );
+				bitmapsProp->SetValue( value );
+				return PObjectBase();
+			}
+		}
+		if ( className == "wxIcon" )
+		{
+			PProperty iconsProp = parent->GetProperty( _( "icons" ) );
+			if ( iconsProp )
+			{
+				wxString value = iconsProp->GetValue();
+				wxString text = _WXSTR( xrcObj->GetText() );
+				text.Replace( wxT( "\'" ), wxT( "\'\'" ), true );
+				value << wxT( "\'" ) << text << wxT( "\' " );
+				iconsProp->SetValue( value );
+				return PObjectBase();
+			}
+		}
+	}
+
+	className = GetClassName( className, parent );
+
 	PObjectBase object;
 	PObjectInfo objInfo = m_objDb->GetObjectInfo( _WXSTR( className ) );
 	if ( objInfo )
@@ -133,6 +465,27 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 		{
 			wxLogError( _("No component found for class \"%s\", found on line %i."), _WXSTR( className ).c_str(), xrcObj->Row() );
 		}
+		else if ( GetImportTable( objInfo )->readXrc )
+		{
+			object = CreateObject( className, parent );
+			if ( !object )
+			{
+				wxLogError( wxT( "CreateObject failed for class \"%s\", with parent \"%s\", found on line %i" ), _WXSTR( className ).c_str(), parent->GetClassName().c_str(), xrcObj->Row() );
+			}
+			else
+			{
+				XfbObjectWriter writer( this, object, GetImportTable( objInfo ) );
+				comp->ReadXrc( xrcObj, &writer );
+
+				// Recursively import the children
+				ticpp::Element *element = xrcObj->FirstChildElement( "object", false );
+				while ( element )
+				{
+					GetObject( element, object );
+					element = element->NextSiblingElement( "object", false );
+				}
+			}
+		}
 		else
 		{
 			ticpp::Element *fbObj = comp->ImportFromXrc( xrcObj );
@@ -27,18 +27,45 @@
 #define __XRC_FILTER__
 
 #include "database.h"
+#include "objectbase.h"
 
 #include <ticpp.h>
 
+#include <map>
+#include <vector>
+
+class TiXmlElement;
+class XmlReader;
+
 /**
  * Filtro de importación de un fichero XRC.
  */
 class XrcLoader
 {
  private:
+  /**
+   * Import table of a class: the properties written by IComponent::ReadXrc, in the order
+   * the component writes them, with the slot of each property in the objects of the class.
+   */
+  struct ImportTable
+  {
+    int readXrc; // -1 until the component is asked whether it supports ReadXrc
+    std::vector< std::pair< wxString, ObjectInfo::PropertySlot > > slots;
+
+    ImportTable() : readXrc( -1 ) {}
+  };
+
+  friend class XfbObjectWriter;
+
   PObjectDatabase m_objDb;
+  std::map< ObjectInfo*, ImportTable > m_tables;
 
+  ImportTable* GetImportTable(PObjectInfo info);
+  std::string GetClassName(std::string className, PObjectBase parent);
+  PObjectBase CreateObject(const std::string& className, PObjectBase parent);
   PObjectBase GetObject(ticpp::Element *xrcObj, PObjectBase parent);
+  void ReadObject(XmlReader& reader, PObjectBase parent);
+  void ReadElement(XmlReader& reader, TiXmlElement* element);
 
  public:
 
@@ -48,6 +75,15 @@ class XrcLoader
    * Dado un árbol XML en formato XRC, crea el arbol de objetos asociado.
    */
   PObjectBase GetProject(ticpp::Document* xrcDoc);
+
+  /**
+   * Imports an XRC file in a single pass, without loading it as a document.
+   * The objects of components supporting IComponent::ReadXrc are created as they are
+   * read, with their properties set straight through the import table of the class.
+   * Other objects are loaded as elements, with their children, for ImportFromXrc.
+   * Files not encoded in UTF-8 are loaded as a document, which offers to convert them.
+   */
+  PObjectBase GetProject(const wxString& path);
 };
 
 #endif //__XRC_FILTER__
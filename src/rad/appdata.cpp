@@ -98,6 +98,28 @@ class InsertObjectCmd : public Command
 		InsertObjectCmd( ApplicationData *data, PObjectBase object, PObjectBase parent, int pos = -1 );
 };
 
+/**
+* Command for inserting several objects at once, undone as one.
+*/
+
+class InsertObjectsCmd : public Command
+{
+
+	private:
+		ApplicationData *m_data;
+		PObjectBase m_parent;
+		std::vector< PObjectBase > m_objects;
+		int m_pos;
+		PObjectBase m_oldSelected;
+
+	protected:
+		void DoExecute() override;
+		void DoRestore() override;
+
+	public:
+		InsertObjectsCmd( ApplicationData *data, const std::vector< PObjectBase >& objects, PObjectBase parent, int pos = -1 );
+};
+
 /**
 * Comando para borrar un objeto.
 */
@@ -277,6 +299,53 @@ void InsertObjectCmd::DoRestore()
 
 //-----------------------------------------------------------------------------
 
+InsertObjectsCmd::InsertObjectsCmd( ApplicationData *data, const std::vector< PObjectBase >& objects,
+                                    PObjectBase parent, int pos )
+		: m_data( data ), m_parent( parent ), m_objects( objects ), m_pos( pos )
+{
+	m_oldSelected = data->GetSelectedObject();
+}
+
+void InsertObjectsCmd::DoExecute()
+{
+	PObjectBase last;
+	int pos = m_pos;
+	for ( std::vector< PObjectBase >::iterator object = m_objects.begin(); object != m_objects.end(); ++object )
+	{
+		// The parent may limit the number of its children, the rest is left out
+		if ( !m_parent->AddChild( *object ) )
+			continue;
+
+		( *object )->SetParent( m_parent );
+
+		if ( pos >= 0 )
+			m_parent->ChangeChildPosition( *object, pos++ );
+
+		last = *object;
+	}
+
+	while ( last && last->GetObjectInfo()->GetObjectType()->IsItem() )
+		last = ( last->GetChildCount() > 0 ? last->GetChild( 0 ) : PObjectBase() );
+
+	if ( last )
+		m_data->SelectObject( last, false, false );
+}
+
+void InsertObjectsCmd::DoRestore()
+{
+	for ( std::vector< PObjectBase >::iterator object = m_objects.begin(); object != m_objects.end(); ++object )
+	{
+		if ( ( *object )->GetParent() == m_parent )
+		{
+			m_parent->RemoveChild( *object );
+			( *object )->SetParent( PObjectBase() );
+		}
+	}
+	m_data->SelectObject( m_oldSelected );
+}
+
+//-----------------------------------------------------------------------------
+
 RemoveObjectCmd::RemoveObjectCmd( ApplicationData *data, PObjectBase object )
 {
 	m_data = data;
@@ -468,6 +537,10 @@ ApplicationData::ApplicationData( const wxString &rootdir )
 		m_objDb( new ObjectDatabase() ),
 		m_manager( new wxFBManager ),
 		m_ipc( new wxFBIPC ),
+		m_transactionDepth( 0 ),
+		m_pendingSelection( false ),
+		m_pendingSelectionForce( false ),
+		m_changeStamp( 0 ),
 		m_fbpVerMajor( 1 ),
 		m_fbpVerMinor(15)
 {
@@ -547,6 +620,20 @@ void ApplicationData::BuildNameSet( PObjectBase obj, PObjectBase top, std::set<
 		BuildNameSet( obj, top->GetChild( i ), name_set );
 }
 
+void ApplicationData::BuildNameSet( const std::set< PObjectBase >& skip, PObjectBase top, std::set< wxString >& name_set )
+{
+	if ( skip.find( top ) != skip.end() )
+		return;
+
+	PProperty nameProp = top->GetProperty( wxT( "name" ) );
+
+	if ( nameProp )
+		name_set.insert( nameProp->GetValue() );
+
+	for ( unsigned int i = 0; i < top->GetChildCount(); i++ )
+		BuildNameSet( skip, top->GetChild( i ), name_set );
+}
+
 void ApplicationData::ResolveNameConflict( PObjectBase obj )
 {
 	while ( obj && obj->GetObjectInfo()->GetObjectType()->IsItem() )
@@ -816,6 +903,158 @@ void ApplicationData::CreateObject( wxString name )
 	}
 }
 
+unsigned int ApplicationData::CreateObjects( wxString name, unsigned int count, const wxString& namePattern, const wxString& labelPattern )
+{
+	if ( 0 == count )
+		return 0;
+
+	try
+	{
+		LogDebug( wxString::Format( wxT("[ApplicationData::CreateObjects] New %u "), count ) + name );
+
+		// The type checks of CreateObject() are done once, the other objects are copies of the first
+		PObjectBase parent = GetSelectedObject();
+		while ( parent )
+		{
+			PObjectBase obj = m_objDb->CreateObject( _STDSTR( name ), parent );
+			if ( obj )
+			{
+				std::vector< PObjectBase > objects;
+				objects.reserve( count );
+				objects.push_back( obj );
+				while ( objects.size() < count )
+					objects.push_back( m_objDb->CopyObject( obj ) );
+
+				return InsertObjects( objects, parent, CalcPositionOfInsertion( GetSelectedObject(), parent ), namePattern, labelPattern );
+			}
+
+			// Same as CreateObject(), try with the parent, which cannot be an item
+			parent = parent->GetParent();
+			while ( parent && parent->GetObjectInfo()->GetObjectType()->IsItem() )
+				parent = parent->GetParent();
+		}
+	}
+	catch ( wxFBException& ex )
+	{
+		wxLogError( ex.what() );
+	}
+
+	return 0;
+}
+
+unsigned int ApplicationData::InsertObjectCopies( PObjectBase obj, unsigned int count, const wxString& namePattern, const wxString& labelPattern )
+{
+	// Copy the item holding the object too, it has the layout settings
+	while ( obj && obj->GetParent() && obj->GetParent()->GetObjectInfo()->GetObjectType()->IsItem() )
+		obj = obj->GetParent();
+
+	if ( !obj || !obj->GetParent() || 0 == count )
+		return 0;
+
+	PObjectBase parent = obj->GetParent();
+
+	std::vector< PObjectBase > copies;
+	copies.reserve( count );
+	while ( copies.size() < count )
+		copies.push_back( m_objDb->CopyObject( obj ) );
+
+	return InsertObjects( copies, parent, (int)parent->GetChildPosition( obj ) + 1, namePattern, labelPattern );
+}
+
+unsigned int ApplicationData::InsertObjects( const std::vector< PObjectBase >& objects, PObjectBase parent, int pos,
+                                             const wxString& namePattern, const wxString& labelPattern )
+{
+	Transaction transaction( this );
+
+	PCommand command( new InsertObjectsCmd( this, objects, parent, pos ) );
+	Execute( command );
+
+	std::vector< PObjectBase > inserted;
+	for ( std::vector< PObjectBase >::const_iterator object = objects.begin(); object != objects.end(); ++object )
+	{
+		if ( ( *object )->GetParent() == parent )
+			inserted.push_back( *object );
+	}
+
+	if ( inserted.empty() )
+		return 0;
+
+	// One name set for all the objects, instead of one per object as ResolveNameConflict() does
+	PObjectBase top = inserted.front();
+	while ( top && top->GetObjectInfo()->GetObjectType()->IsItem() )
+		top = ( top->GetChildCount() > 0 ? top->GetChild( 0 ) : PObjectBase() );
+
+	top = ( top ? top->FindParentForm() : PObjectBase() );
+	if ( !top )
+		top = m_project;
+
+	std::set< wxString > name_set;
+	BuildNameSet( std::set< PObjectBase >( inserted.begin(), inserted.end() ), top, name_set );
+
+	for ( size_t i = 0; i < inserted.size(); ++i )
+	{
+		wxString number = wxString::Format( wxT("%lu"), (unsigned long)( i + 1 ) );
+
+		// The patterns only apply to the inserted object, not to the objects it holds
+		bool root = true;
+		std::vector< PObjectBase > pending( 1, inserted[i] );
+		while ( !pending.empty() )
+		{
+			PObjectBase obj = pending.back();
+			pending.pop_back();
+
+			for ( unsigned int child = obj->GetChildCount(); child > 0; --child )
+				pending.push_back( obj->GetChild( child - 1 ) );
+
+			if ( obj->GetObjectInfo()->GetObjectType()->IsItem() )
+				continue;
+
+			PProperty nameProp = obj->GetProperty( wxT( "name" ) );
+			if ( nameProp )
+			{
+				wxString originalName = nameProp->GetValue();
+				if ( root && !namePattern.empty() )
+				{
+					originalName = namePattern;
+					originalName.Replace( wxT( "%n" ), number );
+					originalName.Replace( wxT( "%s" ), nameProp->GetValue() );
+				}
+
+				wxString name = originalName;
+				for ( int suffix = 1; name_set.find( name ) != name_set.end(); ++suffix )
+					name = wxString::Format( wxT( "%s%i" ), originalName.c_str(), suffix );
+
+				name_set.insert( name );
+				nameProp->SetValue( name );
+			}
+
+			PProperty labelProp = obj->GetProperty( wxT( "label" ) );
+			if ( root && labelProp && !labelPattern.empty() )
+			{
+				wxString label = labelPattern;
+				label.Replace( wxT( "%n" ), number );
+				label.Replace( wxT( "%s" ), labelProp->GetValue() );
+				labelProp->SetValue( label );
+			}
+
+			root = false;
+		}
+	}
+
+	NotifyProjectRefresh();
+
+	PObjectBase selected = inserted.back();
+	while ( selected && selected->GetObjectInfo()->GetObjectType()->IsItem() )
+		selected = ( selected->GetChildCount() > 0 ? selected->GetChild( 0 ) : PObjectBase() );
+
+	if ( selected )
+		SelectObject( selected, true, true );
+
+	CheckProjectTree( m_project );
+
+	return (unsigned int)inserted.size();
+}
+
 void ApplicationData::RemoveObject( PObjectBase obj )
 {
 	DoRemoveObject( obj, false );
@@ -972,6 +1211,8 @@ void ApplicationData::CopyObject( PObjectBase obj )
 
 bool ApplicationData::PasteObject( PObjectBase parent, PObjectBase objToPaste )
 {
+	Transaction transaction( this );
+
 	try
 	{
 		PObjectBase clipboard;
@@ -1146,6 +1387,9 @@ void ApplicationData::InsertObject( PObjectBase obj, PObjectBase parent )
 
 void ApplicationData::MergeProject( PObjectBase project )
 {
+	// Every InsertObject() notifies a refresh, collect them into one
+	Transaction transaction( this );
+
 	// FIXME! comprobar obj se puede colgar de parent
 
 	for ( unsigned int i = 0; i < project->GetChildCount(); i++ )
@@ -2590,6 +2834,8 @@ void ApplicationData::MoveHierarchy( PObjectBase obj, bool up )
 
 void ApplicationData::Undo()
 {
+	Transaction transaction( this );
+
 	m_cmdProc.Undo();
 	m_modFlag = !m_cmdProc.IsAtSavePoint();
 	NotifyProjectRefresh();
@@ -2599,6 +2845,8 @@ void ApplicationData::Undo()
 
 void ApplicationData::Redo()
 {
+	Transaction transaction( this );
+
 	m_cmdProc.Redo();
 	m_modFlag = !m_cmdProc.IsAtSavePoint();
 	NotifyProjectRefresh();
@@ -2877,6 +3125,8 @@ void ApplicationData::CreateBoxSizerWithObject( PObjectBase obj )
 		parent = grandParent;
 	}
 
+	Transaction transaction( this );
+
 	// Must first cut the old object in case it is the only allowable object
 	PObjectBase clipboard = m_clipboard;
 	CutObject( obj );
@@ -2969,6 +3219,46 @@ void ApplicationData::RemoveHandler( wxEvtHandler* handler )
 	}
 }
 
+void ApplicationData::BeginTransaction()
+{
+	if ( 0 == m_transactionDepth++ )
+	{
+		m_changeSet.reset( new wxFBChangeSetEvent( wxEVT_FB_CHANGE_SET ) );
+		m_pendingSelection = false;
+		m_pendingSelectionForce = false;
+	}
+}
+
+void ApplicationData::CommitTransaction()
+{
+	if ( m_transactionDepth <= 0 )
+	{
+		LogDebug( wxT("CommitTransaction() without BeginTransaction()") );
+		return;
+	}
+
+	if ( --m_transactionDepth > 0 )
+	{
+		return;
+	}
+
+	// Take ownership first, handlers may open transactions of their own
+	std::unique_ptr< wxFBChangeSetEvent > changeSet( std::move( m_changeSet ) );
+	const bool pendingSelection = m_pendingSelection;
+	const bool pendingSelectionForce = m_pendingSelectionForce;
+	m_pendingSelection = false;
+
+	if ( changeSet && !changeSet->IsEmpty() )
+	{
+		NotifyEvent( *changeSet );
+	}
+
+	if ( pendingSelection && m_selObj )
+	{
+		NotifyObjectSelected( m_selObj, pendingSelectionForce );
+	}
+}
+
 void ApplicationData::NotifyEvent( wxFBEvent& event, bool forcedelayed )
 {
 
@@ -2998,6 +3288,8 @@ void ApplicationData::NotifyEvent( wxFBEvent& event, bool forcedelayed )
 
 void ApplicationData::NotifyProjectLoaded()
 {
+	++m_changeStamp;
+
 	wxFBEvent event( wxEVT_FB_PROJECT_LOADED );
 	NotifyEvent( event );
 }
@@ -3016,6 +3308,14 @@ void ApplicationData::NotifyObjectExpanded( PObjectBase obj )
 
 void ApplicationData::NotifyObjectSelected( PObjectBase obj, bool force )
 {
+	if ( IsInTransaction() )
+	{
+		// Only the final selection matters, m_selObj holds it
+		m_pendingSelection = true;
+		m_pendingSelectionForce = m_pendingSelectionForce || force;
+		return;
+	}
+
 	wxFBObjectEvent event( wxEVT_FB_OBJECT_SELECTED, obj );
 	if( force ) event.SetString( wxT("force") );
 
@@ -3024,24 +3324,60 @@ void ApplicationData::NotifyObjectSelected( PObjectBase obj, bool force )
 
 void ApplicationData::NotifyObjectCreated( PObjectBase obj )
 {
+	++m_changeStamp;
+
+	if ( IsInTransaction() && obj )
+	{
+		m_changeSet->AddFBObject( obj );
+		m_changeSet->SetStructureChanged();
+		return;
+	}
+
 	wxFBObjectEvent event( wxEVT_FB_OBJECT_CREATED, obj );
 	NotifyEvent( event, false );
 }
 
 void ApplicationData::NotifyObjectRemoved( PObjectBase obj )
 {
+	++m_changeStamp;
+
+	if ( IsInTransaction() )
+	{
+		m_changeSet->AddFBObject( obj );
+		m_changeSet->SetStructureChanged();
+		return;
+	}
+
 	wxFBObjectEvent event( wxEVT_FB_OBJECT_REMOVED, obj );
 	NotifyEvent( event, false );
 }
 
 void ApplicationData::NotifyPropertyModified( PProperty prop )
 {
+	++m_changeStamp;
+
+	if ( IsInTransaction() )
+	{
+		m_changeSet->AddFBProperty( prop );
+		m_changeSet->AddFBObject( prop->GetObject() );
+		return;
+	}
+
 	wxFBPropertyEvent event( wxEVT_FB_PROPERTY_MODIFIED, prop );
 	NotifyEvent( event );
 }
 
 void ApplicationData::NotifyEventHandlerModified( PEvent evtHandler )
 {
+	++m_changeStamp;
+
+	if ( IsInTransaction() )
+	{
+		m_changeSet->AddFBEventHandler( evtHandler );
+		m_changeSet->AddFBObject( evtHandler->GetObject() );
+		return;
+	}
+
 	wxFBEventHandlerEvent event( wxEVT_FB_EVENT_HANDLER_MODIFIED, evtHandler );
 	NotifyEvent( event );
 }
@@ -3058,6 +3394,14 @@ void ApplicationData::NotifyCodeGeneration( bool panelOnly, bool forcedelayed )
 
 void ApplicationData::NotifyProjectRefresh()
 {
+	++m_changeStamp;
+
+	if ( IsInTransaction() )
+	{
+		m_changeSet->SetStructureChanged();
+		return;
+	}
+
 	wxFBEvent event( wxEVT_FB_PROJECT_REFRESH );
 	NotifyEvent( event );
 }
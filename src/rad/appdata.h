@@ -41,6 +41,8 @@ class Property;
 
 class wxFBEvent;
 
+class wxFBChangeSetEvent;
+
 class wxFBManager;
 
 class wxFBIPC;
@@ -92,6 +94,19 @@ class ApplicationData
 
 		HandlerVector m_handlers;
 
+		// Nesting level of BeginTransaction()/CommitTransaction()
+		int m_transactionDepth;
+
+		// Changes collected while a transaction is open
+		std::unique_ptr< wxFBChangeSetEvent > m_changeSet;
+
+		// Selection requested while a transaction is open, notified on commit
+		bool m_pendingSelection;
+		bool m_pendingSelectionForce;
+
+		// Incremented on every modification of the project, see GetChangeStamp()
+		unsigned long m_changeStamp;
+
 		void NotifyEvent( wxFBEvent& event, bool forcedelayed = false );
 
 		// Notifican a cada observador el evento correspondiente
@@ -137,6 +152,20 @@ class ApplicationData
 		 */
 		void BuildNameSet( PObjectBase obj, PObjectBase top, std::set<wxString> &name_set );
 
+		/**
+		 * Names of the objects below top, the subtrees in skip excluded.
+		 */
+		void BuildNameSet( const std::set< PObjectBase >& skip, PObjectBase top, std::set< wxString >& name_set );
+
+		/**
+		 * Inserts objects below a parent as a single undoable command, names them from
+		 * one name set of their form and notifies one refresh.
+		 * @param pos Position of the first object, -1 to append them.
+		 * @return The number of objects inserted, the parent may not accept all of them.
+		 */
+		unsigned int InsertObjects( const std::vector< PObjectBase >& objects, PObjectBase parent, int pos,
+									const wxString& namePattern, const wxString& labelPattern );
+
 		/**
 		 * Calcula la posición donde deberá ser insertado el objeto.
 		 *
@@ -253,6 +282,44 @@ class ApplicationData
 
 		void RemoveHandler( wxEvtHandler* handler );
 
+		/**
+		Opens a notification transaction. Until the matching CommitTransaction(),
+		modifications are not notified one by one but collected into a single
+		wxFBChangeSetEvent. Transactions can be nested, only the outermost commit notifies.
+		*/
+		void BeginTransaction();
+
+		/**
+		Closes a transaction opened with BeginTransaction(). When the outermost
+		transaction is committed the collected change set is sent to all handlers,
+		followed by the last requested selection.
+		*/
+		void CommitTransaction();
+
+		bool IsInTransaction() const { return m_transactionDepth > 0; }
+
+		/**
+		Changes whenever the project is loaded, refreshed or modified, including inside transactions.
+		Lets derived data, like the analysis used by the code generators, be cached between notifications.
+		*/
+		unsigned long GetChangeStamp() const { return m_changeStamp; }
+
+		/**
+		Keeps a transaction open for the lifetime of the object.
+		*/
+		class Transaction
+		{
+		public:
+			explicit Transaction( ApplicationData* data ) : m_data( data ) { m_data->BeginTransaction(); }
+			~Transaction() { m_data->CommitTransaction(); }
+
+			Transaction( const Transaction& ) = delete;
+			Transaction& operator=( const Transaction& ) = delete;
+
+		private:
+			ApplicationData* m_data;
+		};
+
 		// Operaciones sobre los datos
 		bool LoadProject( const wxString &file, bool justGenerate = false );
 
@@ -287,6 +354,33 @@ class ApplicationData
 
 		void CreateObject( wxString name );
 
+		/**
+		Creates several objects of a class at once, like CreateObject() does for one,
+		as a single undoable command with one designer refresh.
+		@param name Class of the objects.
+		@param count Number of objects.
+		@param namePattern Name of each object, "%s" stands for the default name and "%n" for the
+		number of the object, from 1. Empty keeps the default names, numbered on conflict.
+		@param labelPattern Likewise for the label property, empty keeps the default labels.
+		@return The number of objects created.
+		*/
+		unsigned int CreateObjects( wxString name, unsigned int count,
+									const wxString& namePattern = wxEmptyString, const wxString& labelPattern = wxEmptyString );
+
+		/**
+		Inserts copies of an object after it, with all its children, as a single undoable command
+		with one designer refresh. An object held by an item, like a sizeritem, is copied with its item.
+		@param obj The object to copy.
+		@param count Number of copies.
+		@param namePattern Name of each copy, "%s" stands for the name of the copied object and "%n"
+		for the number of the copy, from 1. Empty keeps the name, numbered on conflict. The children
+		of the copies keep their names, numbered on conflict.
+		@param labelPattern Likewise for the label property of each copy, empty keeps the label.
+		@return The number of copies inserted.
+		*/
+		unsigned int InsertObjectCopies( PObjectBase obj, unsigned int count,
+										 const wxString& namePattern = wxEmptyString, const wxString& labelPattern = wxEmptyString );
+
 		void RemoveObject( PObjectBase obj );
 
 		void CutObject( PObjectBase obj );
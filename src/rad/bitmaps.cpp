@@ -34,14 +34,27 @@
 
 static std::map< wxString, wxBitmap > m_bitmaps;
 
+// Files of the icons not decoded yet
+static std::map< wxString, wxString > m_files;
+
 wxBitmap AppBitmaps::GetBitmap( wxString iconname, unsigned int size )
 {
 	std::map< wxString, wxBitmap >::iterator bitmap;
 	bitmap = m_bitmaps.find( iconname );
+	if ( bitmap == m_bitmaps.end() )
+	{
+		std::map< wxString, wxString >::iterator file = m_files.find( iconname );
+		if ( file != m_files.end() )
+		{
+			bitmap = m_bitmaps.insert( std::make_pair( iconname, wxBitmap( file->second, wxBITMAP_TYPE_ANY ) ) ).first;
+			m_files.erase( file );
+		}
+	}
+
 	wxBitmap bmp;
 	if ( bitmap != m_bitmaps.end() )
 	{
-		bmp = m_bitmaps[iconname];
+		bmp = bitmap->second;
 	}
 	else
 	{
@@ -74,7 +87,9 @@ void AppBitmaps::LoadBitmaps( wxString filepath, wxString iconpath )
 		{
 			wxString name = _WXSTR( elem->GetAttribute("name") );
 			wxString file = _WXSTR( elem->GetAttribute("file") );
-			m_bitmaps[name] = wxBitmap( iconpath + file, wxBITMAP_TYPE_ANY );
+			// Decoded by GetBitmap the first time the icon is used
+			m_bitmaps.erase( name );
+			m_files[name] = iconpath + file;
 
 			elem = elem->NextSiblingElement( "icon", false );
 		}
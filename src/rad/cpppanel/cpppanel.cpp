@@ -52,6 +52,7 @@ BEGIN_EVENT_TABLE ( CppPanel,  wxPanel )
 	EVT_FB_OBJECT_CREATED( CppPanel::OnObjectChange )
 	EVT_FB_OBJECT_REMOVED( CppPanel::OnObjectChange )
 	EVT_FB_OBJECT_SELECTED( CppPanel::OnObjectChange )
+	EVT_FB_CHANGE_SET( CppPanel::OnChangeSet )
 	EVT_FB_EVENT_HANDLER_MODIFIED( CppPanel::OnEventHandlerModified )
 
 	EVT_FIND( wxID_ANY, CppPanel::OnFind )
@@ -210,6 +211,13 @@ void CppPanel::OnEventHandlerModified( wxFBEventHandlerEvent& event )
 	OnCodeGeneration( event );
 }
 
+void CppPanel::OnChangeSet( wxFBChangeSetEvent& event )
+{
+	// Generate code to the panel only, once for the whole change set
+	event.SetId( 1 );
+	OnCodeGeneration( event );
+}
+
 void CppPanel::OnCodeGeneration( wxFBEvent& event )
 {
     PObjectBase objectToGenerate;
@@ -336,6 +344,9 @@ void CppPanel::OnCodeGeneration( wxFBEvent& event )
 		codegen.SetHeaderWriter( m_hCW );
 		codegen.SetSourceWriter( m_cppCW );
 
+		// The panel may show one form only, the files are written with the generated code
+		codegen.SetWriteEmbeddedFiles( false );
+
 		Freeze();
 
         wxStyledTextCtrl* cppEditor = m_cppPanel->GetTextCtrl();
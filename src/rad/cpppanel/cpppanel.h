@@ -41,6 +41,7 @@ class wxFindDialogEvent;
 class wxFBEvent;
 class wxFBPropertyEvent;
 class wxFBObjectEvent;
+class wxFBChangeSetEvent;
 class wxFBEventHandlerEvent;
 
 class CppPanel : public wxPanel
@@ -62,6 +63,7 @@ public:
 	void OnProjectRefresh( wxFBEvent& event );
 	void OnCodeGeneration( wxFBEvent& event );
 	void OnObjectChange( wxFBObjectEvent& event );
+	void OnChangeSet( wxFBChangeSetEvent& event );
 	void OnEventHandlerModified( wxFBEventHandlerEvent& event );
 
 	void OnFind( wxFindDialogEvent& event );
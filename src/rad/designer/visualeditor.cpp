@@ -26,6 +26,7 @@
 #include "visualeditor.h"
 
 #include "../../model/objectbase.h"
+#include "../../utils/profiler.h"
 #include "../../utils/typeconv.h"
 #include "../../utils/wxfbexception.h"
 #include "../appdata.h"
@@ -34,6 +35,21 @@
 #include "menubar.h"
 
 #include <wx/collpane.h>
+#include <wx/dcmemory.h>
+#include <wx/frame.h>
+#include <wx/image.h>
+
+#if defined( __WXMSW__ )
+	#include <wx/msw/wrapwin.h>
+	#ifndef PW_CLIENTONLY
+		#define PW_CLIENTONLY 0x00000001
+	#endif
+	#ifndef PW_RENDERFULLCONTENT
+		#define PW_RENDERFULLCONTENT 0x00000002
+	#endif
+#elif defined( __WXGTK__ )
+	#include <gtk/gtk.h>
+#endif
 
 #ifdef __WX24__
 #define wxFULL_REPAINT_ON_RESIZE 0
@@ -54,6 +70,7 @@ BEGIN_EVENT_TABLE(VisualEditor,wxScrolledWindow)
 	EVT_FB_PROPERTY_MODIFIED( VisualEditor::OnPropertyModified )
 	EVT_FB_PROJECT_REFRESH( VisualEditor::OnProjectRefresh )
 	EVT_FB_CODE_GENERATION( VisualEditor::OnProjectRefresh )
+	EVT_FB_CHANGE_SET( VisualEditor::OnChangeSet )
 
 	EVT_TIMER( ID_TIMER_SCAN, VisualEditor::OnAuiScaner )
 
@@ -425,6 +442,8 @@ void VisualEditor::ClearComponents( wxWindow* parent )
 */
 void VisualEditor::Create()
 {
+	ProfileScope profile( wxT("VisualEditor::Create") );
+
 #if !defined(__WXGTK__ )
 	if ( IsShown() )
 	{
@@ -450,6 +469,7 @@ void VisualEditor::Create()
 	// Clear all associations between ObjectBase and wxObjects
 	m_wxobjects.clear();
 	m_baseobjects.clear();
+	m_deferredPages.clear();
 
 	if( IsShown() )
 	{
@@ -718,13 +738,25 @@ void VisualEditor::Generate( PObjectBase obj, wxWindow* wxparent, wxObject* pare
 	PObjectInfo obj_info = obj->GetObjectInfo();
 	IComponent* comp = obj_info->GetComponent();
 
+	// The category of the timings, only filled in while profiling
+	wxString className;
+	if ( Profiler::IsEnabled() )
+	{
+		className = obj_info->GetClassName();
+	}
+	ProfileScope profile( wxT("VisualEditor::Generate"), className );
+
 	if ( NULL == comp )
 	{
 		THROW_WXFBEX( wxString::Format( wxT("Component for %s not found!"), obj->GetClassName().c_str() ) );
 	}
 
 	// Create Object
-	wxObject* createdObject = comp->Create( obj.get(), wxparent );
+	wxObject* createdObject;
+	{
+		ProfileScope profileCreate( wxT("IComponent::Create"), className );
+		createdObject = comp->Create( obj.get(), wxparent );
+	}
 	wxWindow* createdWindow = NULL;
 	wxSizer*  createdSizer  = NULL;
 	wxWindow* vobjWindow = nullptr;
@@ -791,13 +823,24 @@ void VisualEditor::Generate( PObjectBase obj, wxWindow* wxparent, wxObject* pare
 	// New wxparent for the window's children
 	wxWindow* new_wxparent = ( createdWindow ? createdWindow : wxparent );
 
-	// Recursively generate the children
-	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+	// Pages that are not on display stay empty until they are selected, see ExpandDeferredPages()
+	if ( createdWindow && !collpane && IsDeferredPage( obj ) )
 	{
-		Generate( obj->GetChild( i ), new_wxparent, createdObject );
+		m_deferredPages.insert( obj.get() );
+	}
+	else
+	{
+		// Recursively generate the children
+		for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+		{
+			Generate( obj->GetChild( i ), new_wxparent, createdObject );
+		}
 	}
 
-	comp->OnCreated( createdObject, wxparent );
+	{
+		ProfileScope profileOnCreated( wxT("IComponent::OnCreated"), className );
+		comp->OnCreated( createdObject, wxparent );
+	}
 
 	// Now push the event handler so that it will be the last one in the chain
 	if (vobjWindow && vobjHandler)
@@ -821,6 +864,140 @@ void VisualEditor::Generate( PObjectBase obj, wxWindow* wxparent, wxObject* pare
 	}
 }
 
+/**
+* Checks whether the children of a book or wizard page can be generated later.
+* Only plain container pages that are hidden behind another page qualify, the page
+* holding the current selection is always generated. The pages of a form fitted to
+* its contents are generated too, the size of the form depends on all of them.
+*/
+bool VisualEditor::IsDeferredPage( PObjectBase obj )
+{
+	PObjectBase item = obj->GetParent();
+	if ( !item || 0 == obj->GetChildCount() || !m_form )
+	{
+		return false;
+	}
+
+	wxSize formSize = m_form->GetPropertyAsSize( wxT("size") );
+	if ( formSize.GetWidth() == wxDefaultCoord || formSize.GetHeight() == wxDefaultCoord )
+	{
+		return false;
+	}
+
+	wxString type = obj->GetObjectTypeName();
+	wxString itemType = item->GetObjectTypeName();
+	bool wizardPage = ( type == wxT("wizardpagesimple") && itemType == wxT("wizard") );
+	bool bookPage = ( type == wxT("container") &&
+					( itemType == wxT("notebookpage") ||
+					  itemType == wxT("listbookpage") ||
+					  itemType == wxT("choicebookpage") ||
+					  itemType == wxT("simplebookpage") ||
+					  itemType == wxT("auinotebookpage") ||
+					  itemType == wxT("flatnotebookpage") ) );
+	if ( !wizardPage && !bookPage )
+	{
+		return false;
+	}
+
+	for ( PObjectBase selected = AppData()->GetSelectedObject(); selected; selected = selected->GetParent() )
+	{
+		if ( selected == obj )
+		{
+			return false;
+		}
+	}
+
+	// Books show the last page flagged with "select" (or the first one), wizards show the last page added
+	PObjectBase book = ( wizardPage ? item : item->GetParent() );
+	PObjectBase page = ( wizardPage ? obj : item );
+	if ( !book )
+	{
+		return false;
+	}
+
+	PObjectBase shown = ( wizardPage ? PObjectBase() : book->GetChild( 0 ) );
+	for ( unsigned int i = 0; i < book->GetChildCount(); i++ )
+	{
+		PObjectBase child = book->GetChild( i );
+		if ( wizardPage ? child->GetObjectTypeName() == wxT("wizardpagesimple") : child->GetPropertyAsInteger( wxT("select") ) != 0 )
+		{
+			shown = child;
+		}
+	}
+
+	return ( shown != page );
+}
+
+/**
+* Generates the children of the deferred pages on the path from obj up to the form,
+* and of the page of obj if it is a book page item, which the book switches to.
+* Outer pages are expanded first, nested books are created along with their page.
+* The form is laid out again, as the best size of the books changed.
+*/
+void VisualEditor::ExpandDeferredPages( PObjectBase obj )
+{
+	if ( m_deferredPages.empty() || !obj )
+	{
+		return;
+	}
+
+	std::vector< PObjectBase > path;
+	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+	{
+		if ( m_deferredPages.count( obj->GetChild( i ).get() ) != 0 )
+		{
+			path.push_back( obj->GetChild( i ) );
+		}
+	}
+	for ( PObjectBase parent = obj; parent; parent = parent->GetParent() )
+	{
+		path.push_back( parent );
+	}
+
+	bool expanded = false;
+	for ( std::vector< PObjectBase >::reverse_iterator page = path.rbegin(); page != path.rend(); ++page )
+	{
+		if ( 0 == m_deferredPages.erase( page->get() ) )
+		{
+			continue;
+		}
+
+		ObjectBaseMap::iterator it = m_baseobjects.find( page->get() );
+		wxWindow* window = ( it != m_baseobjects.end() ? wxDynamicCast( it->second, wxWindow ) : NULL );
+		if ( !window )
+		{
+			continue;
+		}
+
+		try
+		{
+			for ( unsigned int i = 0; i < (*page)->GetChildCount(); i++ )
+			{
+				Generate( (*page)->GetChild( i ), window, window );
+			}
+		}
+		catch ( wxFBException& ex )
+		{
+			wxLogError ( ex.what() );
+		}
+
+		for ( wxWindow* parent = window; parent && parent != m_back; parent = parent->GetParent() )
+		{
+			parent->InvalidateBestSize();
+		}
+		window->Layout();
+		window->Refresh();
+		expanded = true;
+	}
+
+	if ( expanded )
+	{
+		m_back->Layout();
+		m_back->Refresh();
+		UpdateVirtualSize();
+	}
+}
+
 void VisualEditor::SetupSizer( PObjectBase obj, wxSizer* sizer )
 {
 	wxSize minsize = obj->GetPropertyAsSize( wxT("minimum_size") );
@@ -1097,6 +1274,9 @@ void VisualEditor::OnObjectSelected( wxFBObjectEvent &event )
 		return;
 	}
 
+	// Build the hidden pages the selection lies on
+	ExpandDeferredPages( obj );
+
 	// highlight parent toolbar instead of its children
 	PObjectBase toolbar = obj->FindNearAncestor( wxT("toolbar") );
 	if( !toolbar ) toolbar = obj->FindNearAncestor( wxT("toolbar_form") );
@@ -1110,7 +1290,7 @@ void VisualEditor::OnObjectSelected( wxFBObjectEvent &event )
 		m_back->SetSelectedItem( NULL );
 		m_back->SetSelectedObject( PObjectBase() );
 		m_back->SetSelectedPanel( NULL );
-		m_back->Refresh();
+		m_back->UpdateHighlight();
 		return;
 	}
 
@@ -1256,7 +1436,7 @@ void VisualEditor::OnObjectSelected( wxFBObjectEvent &event )
 	m_back->SetSelectedItem( item );
 	m_back->SetSelectedObject( obj );
 	m_back->SetSelectedPanel( selPanel );
-	m_back->Refresh();
+	m_back->UpdateHighlight();
 }
 
 void VisualEditor::OnObjectCreated( wxFBObjectEvent &)
@@ -1289,6 +1469,183 @@ void VisualEditor::OnProjectRefresh( wxFBEvent &)
 	Create();
 }
 
+void VisualEditor::OnChangeSet( wxFBChangeSetEvent &event )
+{
+	// Property-only change sets are subject to the same filter as OnPropertyModified
+	if ( m_stopModifiedEvent && !event.IsStructureChanged() )
+	{
+		return;
+	}
+
+	// One rebuild for the whole set
+	PObjectBase aux = m_back->GetSelectedObject();
+	Create();
+	if ( aux && !event.IsStructureChanged() )
+	{
+		wxFBObjectEvent objEvent( wxEVT_FB_OBJECT_SELECTED, aux );
+		this->ProcessEvent( objEvent );
+	}
+	UpdateVirtualSize();
+}
+
+/**
+* Draws the contents of @a window, a child at the origin of the top level window @a frame,
+* into @a bitmap through the toolkit, so the pixels do not depend on the window being
+* visible on the screen.
+*/
+static bool CaptureWindow( wxWindow* frame, wxWindow* window, const wxSize& size, wxBitmap& bitmap )
+{
+#if defined( __WXMSW__ )
+	// Asks the windows to paint themselves into the bitmap, even when covered or off the screen
+	bitmap.Create( size.x, size.y, 24 );
+	wxMemoryDC memDC( bitmap );
+	memDC.SetBackground( *wxWHITE_BRUSH );
+	memDC.Clear();
+	const bool captured = ( ::PrintWindow( (HWND)frame->GetHWND(), (HDC)memDC.GetHDC(), PW_CLIENTONLY | PW_RENDERFULLCONTENT ) != 0 );
+	memDC.SelectObject( wxNullBitmap );
+	return captured;
+#elif defined( __WXGTK3__ )
+	// Runs the draw handlers of the widget and its children on an image surface
+	wxUnusedVar( frame );
+	cairo_surface_t* surface = cairo_image_surface_create( CAIRO_FORMAT_RGB24, size.x, size.y );
+	cairo_t* cr = cairo_create( surface );
+	cairo_set_source_rgb( cr, 1, 1, 1 );
+	cairo_paint( cr );
+	gtk_widget_draw( window->GetHandle(), cr );
+	cairo_destroy( cr );
+	cairo_surface_flush( surface );
+
+	const bool captured = ( cairo_surface_status( surface ) == CAIRO_STATUS_SUCCESS );
+	if ( captured )
+	{
+		wxImage image( size.x, size.y, false );
+		const unsigned char* data = cairo_image_surface_get_data( surface );
+		const int stride = cairo_image_surface_get_stride( surface );
+		unsigned char* rgb = image.GetData();
+		for ( int y = 0; y < size.y; ++y )
+		{
+			const guint32* row = reinterpret_cast< const guint32* >( data + y * stride );
+			for ( int x = 0; x < size.x; ++x, rgb += 3 )
+			{
+				rgb[0] = ( row[x] >> 16 ) & 0xff;
+				rgb[1] = ( row[x] >> 8 ) & 0xff;
+				rgb[2] = row[x] & 0xff;
+			}
+		}
+		bitmap = wxBitmap( image );
+	}
+	cairo_surface_destroy( surface );
+	return captured;
+#elif defined( __WXGTK__ )
+	// Redirects the drawing of the widget and its children to a pixmap, even when obscured
+	wxUnusedVar( frame );
+	GdkPixmap* pixmap = gtk_widget_get_snapshot( window->GetHandle(), NULL );
+	if ( !pixmap )
+	{
+		return false;
+	}
+
+	GdkPixbuf* pixbuf = gdk_pixbuf_get_from_drawable( NULL, pixmap, NULL, 0, 0, 0, 0, size.x, size.y );
+	g_object_unref( pixmap );
+	if ( !pixbuf )
+	{
+		return false;
+	}
+
+	wxImage image( size.x, size.y, false );
+	const guchar* data = gdk_pixbuf_get_pixels( pixbuf );
+	const int stride = gdk_pixbuf_get_rowstride( pixbuf );
+	const int channels = gdk_pixbuf_get_n_channels( pixbuf );
+	unsigned char* rgb = image.GetData();
+	for ( int y = 0; y < size.y; ++y )
+	{
+		const guchar* pixel = data + y * stride;
+		for ( int x = 0; x < size.x; ++x, pixel += channels, rgb += 3 )
+		{
+			rgb[0] = pixel[0];
+			rgb[1] = pixel[1];
+			rgb[2] = pixel[2];
+		}
+	}
+	g_object_unref( pixbuf );
+	bitmap = wxBitmap( image );
+	return true;
+#else
+	// Reading back a window through a wxDC is not reliable on the other ports
+	wxUnusedVar( frame );
+	wxUnusedVar( window );
+	wxUnusedVar( size );
+	wxUnusedVar( bitmap );
+	return false;
+#endif
+}
+
+bool VisualEditor::RenderForm( PObjectBase form, const wxString& file )
+{
+	if ( !form || !IsShown() )
+	{
+		return false;
+	}
+
+	// Selecting the form builds it in the designer
+	AppData()->SelectObject( form, true );
+	if ( m_form != form )
+	{
+		Create();
+	}
+	if ( m_form != form || !m_back->IsShown() )
+	{
+		wxLogError( _("Form '%s' could not be built in the designer."), form->GetPropertyAsString( wxT("name") ) );
+		return false;
+	}
+
+	// No selection outlines in the snapshot
+	m_back->SetSelectedSizer( NULL );
+	m_back->SetSelectedItem( NULL );
+	m_back->SetSelectedObject( PObjectBase() );
+	m_back->SetSelectedPanel( NULL );
+	Scroll( 0, 0 );
+
+	// The form is moved to a borderless top level window of its own, out of the
+	// visible area, so it is not clipped by the designer, and the toolkit draws
+	// it into a bitmap once it was shown and painted
+	const wxPoint position = m_back->GetPosition();
+	const wxSize size = m_back->GetSize();
+	wxFrame* offscreen = new wxFrame( NULL, wxID_ANY, wxEmptyString, wxPoint( -size.x - 100, -size.y - 100 ), size,
+										wxBORDER_NONE | wxFRAME_NO_TASKBAR | wxFRAME_TOOL_WINDOW );
+	m_back->Reparent( offscreen );
+	m_back->SetPosition( wxPoint( 0, 0 ) );
+	offscreen->SetClientSize( size );
+	offscreen->Show();
+
+	m_back->Layout();
+	m_back->Refresh();
+	m_back->Update();
+	::wxYield();
+
+	wxBitmap bitmap;
+	const bool captured = CaptureWindow( offscreen, m_back, size, bitmap );
+
+	m_back->Reparent( this );
+	m_back->SetPosition( position );
+	offscreen->Destroy();
+	UpdateVirtualSize();
+
+	if ( !captured || !bitmap.IsOk() )
+	{
+		wxLogError( _("Form '%s' could not be captured on this platform."), form->GetPropertyAsString( wxT("name") ) );
+		return false;
+	}
+
+	if ( !bitmap.SaveFile( file, wxBITMAP_TYPE_PNG ) )
+	{
+		wxLogError( _("Unable to save image: %s"), file );
+		return false;
+	}
+
+	return true;
+}
+
 void VisualEditor::OnAuiScaner(wxTimerEvent&) {
 	if( m_auimgr )
 	{
@@ -1310,15 +1667,13 @@ wxInnerFrame(parent, id, pos, size, style)
 	SetGrid( 10, 10 );
 	m_selSizer = NULL;
 	m_selItem = NULL;
-	m_actPanel = NULL;
+	m_highlightValid = false;
 	SetBackgroundColour( wxSystemSettings::GetColour( wxSYS_COLOUR_BTNFACE ) );
-
-	GetFrameContentPanel()->PushEventHandler(new HighlightPaintHandler(GetFrameContentPanel()));
 }
 
 DesignerWindow::~DesignerWindow()
 {
-    GetFrameContentPanel()->PopEventHandler( true );
+	SetSelectedPanel( NULL );
 }
 
 void DesignerWindow::SetGrid( int x, int y )
@@ -1327,6 +1682,32 @@ void DesignerWindow::SetGrid( int x, int y )
 	m_y = y;
 }
 
+void DesignerWindow::SetSelectedPanel( wxWindow *actPanel )
+{
+	if ( m_actPanel == actPanel )
+	{
+		return;
+	}
+
+	// Only the active panel is hooked, so nested panels do not need
+	// a paint handler each
+	if ( m_actPanel )
+	{
+		m_actPanel->Disconnect( wxEVT_PAINT, wxPaintEventHandler( DesignerWindow::OnActivePanelPaint ), NULL, this );
+		m_actPanel->Disconnect( wxEVT_SIZE, wxSizeEventHandler( DesignerWindow::OnActivePanelSize ), NULL, this );
+	}
+
+	m_actPanel = actPanel;
+
+	if ( m_actPanel )
+	{
+		m_actPanel->Connect( wxEVT_PAINT, wxPaintEventHandler( DesignerWindow::OnActivePanelPaint ), NULL, this );
+		m_actPanel->Connect( wxEVT_SIZE, wxSizeEventHandler( DesignerWindow::OnActivePanelSize ), NULL, this );
+	}
+
+	m_highlightValid = false;
+}
+
 void DesignerWindow::OnPaint(wxPaintEvent &event)
 {
 	// This paint event helps draw the selection boxes
@@ -1343,7 +1724,35 @@ void DesignerWindow::OnPaint(wxPaintEvent &event)
 	event.Skip();
 }
 
-void DesignerWindow::DrawRectangle( wxDC& dc, const wxPoint& point, const wxSize& size, PObjectBase object )
+void DesignerWindow::OnActivePanelPaint( wxPaintEvent &event )
+{
+	wxWindow* panel = m_actPanel;
+	if ( panel && event.GetEventObject() == panel )
+	{
+		if ( !m_highlightValid )
+		{
+			CalcHighlight();
+		}
+
+		// Nothing to do if the damaged area does not touch the outlines
+		if ( !m_highlight.empty() && panel->GetUpdateRegion().Contains( m_highlightBounds ) != wxOutRegion )
+		{
+			wxPaintDC dc( panel );
+			HighlightSelection( dc );
+		}
+	}
+
+	event.Skip();
+}
+
+void DesignerWindow::OnActivePanelSize( wxSizeEvent &event )
+{
+	// Children are laid out again, the outlines may move
+	m_highlightValid = false;
+	event.Skip();
+}
+
+wxRect DesignerWindow::GetHighlightRect( const wxPoint& point, const wxSize& size, PObjectBase object )
 {
 	bool isSizer = ( object->GetObjectInfo()->IsSubclassOf( wxT("sizer") ) || object->GetObjectInfo()->IsSubclassOf( wxT("gbsizer") ) );
 	int min = ( isSizer ? 0 : 1 );
@@ -1360,14 +1769,24 @@ void DesignerWindow::DrawRectangle( wxDC& dc, const wxPoint& point, const wxSize
 	int rightBorder = 	( flag & wxRIGHT ) 	== 0 ? min : border;
 	int leftBorder = 	( flag & wxLEFT ) 	== 0 ? min : border;
 
-	dc.DrawRectangle( 	point.x - leftBorder,
-						point.y - topBorder,
-						size.x + leftBorder + rightBorder,
-						size.y + topBorder + bottomBorder );
+	return wxRect( 	point.x - leftBorder,
+					point.y - topBorder,
+					size.x + leftBorder + rightBorder,
+					size.y + topBorder + bottomBorder );
 }
 
-void DesignerWindow::HighlightSelection( wxDC& dc )
+void DesignerWindow::CalcHighlight()
 {
+	m_highlight.clear();
+	m_highlightBounds = wxRect();
+	m_highlightPanel = m_actPanel;
+	m_highlightValid = true;
+
+	if ( !m_actPanel )
+	{
+		return;
+	}
+
 	// do not highlight if AUI is used in floating mode
 	VisualEditor *editor = wxDynamicCast( GetParent(), VisualEditor );
 	if( editor && editor->m_auimgr )
@@ -1387,6 +1806,11 @@ void DesignerWindow::HighlightSelection( wxDC& dc )
 
 	wxSize size;
 	PObjectBase object = m_selObj.lock();
+	if ( !object )
+	{
+		return;
+	}
+
 	if ( m_selSizer )
 	{
 		wxScrolledWindow* scrolwin = wxDynamicCast(m_selSizer->GetContainingWindow (), wxScrolledWindow);
@@ -1412,14 +1836,14 @@ void DesignerWindow::HighlightSelection( wxDC& dc )
 		}
 		size = m_selSizer->GetSize();
 
-		wxPen bluePen(*wxBLUE, 1, wxPENSTYLE_SOLID);
-		dc.SetPen( bluePen );
-		dc.SetBrush( *wxTRANSPARENT_BRUSH );
 		PObjectBase sizerParent = object->FindNearAncestorByBaseClass( wxT("sizer") );
 		if( !sizerParent ) sizerParent = object->FindNearAncestorByBaseClass( wxT("gbsizer") );
 		if ( sizerParent && sizerParent->GetParent() )
 		{
-			DrawRectangle( dc, point, size, sizerParent );
+			HighlightRect highlight;
+			highlight.rect = GetHighlightRect( point, size, sizerParent );
+			highlight.colour = *wxBLUE;
+			m_highlight.push_back( highlight );
 		}
 	}
 
@@ -1451,17 +1875,72 @@ void DesignerWindow::HighlightSelection( wxDC& dc )
 		}
 		else
 		{
-			return;
+			shown = false;
 		}
 
 		if ( shown )
 		{
-			wxPen redPen(*wxRED, 1, wxPENSTYLE_SOLID);
-			dc.SetPen( redPen );
-			dc.SetBrush( *wxTRANSPARENT_BRUSH );
-			DrawRectangle( dc, point, size, object );
+			HighlightRect highlight;
+			highlight.rect = GetHighlightRect( point, size, object );
+			highlight.colour = *wxRED;
+			m_highlight.push_back( highlight );
 		}
 	}
+
+	for ( std::vector< HighlightRect >::const_iterator it = m_highlight.begin(); it != m_highlight.end(); ++it )
+	{
+		m_highlightBounds.Union( it->rect );
+	}
+}
+
+void DesignerWindow::RefreshHighlightArea()
+{
+	wxWindow* panel = m_highlightPanel;
+	if ( !panel || m_highlight.empty() )
+	{
+		return;
+	}
+
+	// Outlines are one pixel wide on the edges of each rectangle
+	for ( std::vector< HighlightRect >::const_iterator it = m_highlight.begin(); it != m_highlight.end(); ++it )
+	{
+		const wxRect& rect = it->rect;
+		panel->RefreshRect( wxRect( rect.x, rect.y, rect.width, 1 ), false );
+		panel->RefreshRect( wxRect( rect.x, rect.GetBottom(), rect.width, 1 ), false );
+		panel->RefreshRect( wxRect( rect.x, rect.y, 1, rect.height ), false );
+		panel->RefreshRect( wxRect( rect.GetRight(), rect.y, 1, rect.height ), false );
+	}
+
+	// Outlines of the content panel may extend into the frame
+	if ( panel == GetFrameContentPanel() )
+	{
+		wxRect bounds = m_highlightBounds;
+		bounds.Offset( panel->GetPosition() );
+		RefreshRect( bounds, false );
+	}
+}
+
+void DesignerWindow::UpdateHighlight()
+{
+	// Erase the old outlines, then draw the new ones
+	RefreshHighlightArea();
+	CalcHighlight();
+	RefreshHighlightArea();
+}
+
+void DesignerWindow::HighlightSelection( wxDC& dc )
+{
+	if ( !m_highlightValid )
+	{
+		CalcHighlight();
+	}
+
+	dc.SetBrush( *wxTRANSPARENT_BRUSH );
+	for ( std::vector< HighlightRect >::const_iterator it = m_highlight.begin(); it != m_highlight.end(); ++it )
+	{
+		dc.SetPen( wxPen( it->colour, 1, wxPENSTYLE_SOLID ) );
+		dc.DrawRectangle( it->rect );
+	}
 }
 
 wxMenu* DesignerWindow::GetMenuFromObject(PObjectBase menu)
@@ -1614,28 +2093,3 @@ void DesignerWindow::SetFrameWidgets(PObjectBase menubar, wxWindow *toolbar, wxW
 	contentPanel->SetSizer(dummySizer, false);
 	contentPanel->Layout();
 }
-
-
-BEGIN_EVENT_TABLE(DesignerWindow::HighlightPaintHandler,wxEvtHandler)
-  EVT_PAINT(DesignerWindow::HighlightPaintHandler::OnPaint)
-END_EVENT_TABLE()
-
-
-DesignerWindow::HighlightPaintHandler::HighlightPaintHandler(wxWindow *win)
-{
-  m_window = win;
-}
-
-void DesignerWindow::HighlightPaintHandler::OnPaint(wxPaintEvent &event)
-{
-	wxWindow *aux = m_window;
-	while (!aux->IsKindOf(CLASSINFO(DesignerWindow))) aux = aux->GetParent();
-	DesignerWindow *dsgnWin = (DesignerWindow*) aux;
-	if (dsgnWin->GetActivePanel() == m_window)
-	{
-		wxPaintDC dc(m_window);
-		dsgnWin->HighlightSelection(dc);
-	}
-
-	event.Skip();
-}
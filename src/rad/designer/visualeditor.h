@@ -30,6 +30,10 @@
 #include "visualobj.h"
 
 #include <forms/wizard.h>
+
+#include <wx/weakref.h>
+#include <set>
+
 /**
  * Extends the wxInnerFrame to show the object highlight
  */
@@ -41,24 +45,30 @@ class DesignerWindow : public wxInnerFrame
    wxSizer *m_selSizer;
    wxObject *m_selItem;
    WPObjectBase m_selObj;
-   wxWindow *m_actPanel;
 
-   void DrawRectangle(wxDC& dc, const wxPoint& point, const wxSize& size, PObjectBase object);
+   // Panel the highlight is drawn on, cleared automatically when it is destroyed
+   wxWeakRef< wxWindow > m_actPanel;
 
-   DECLARE_CLASS(DesignerWindow)
-
-   // Augh!, this class is needed to paint the highlight in the
-   // frame content panel.
-   class HighlightPaintHandler : public wxEvtHandler
+   // Highlight overlay: outlines in client coordinates of m_highlightPanel,
+   // computed once per selection change instead of on every paint
+   struct HighlightRect
    {
-      DECLARE_EVENT_TABLE()
+      wxRect rect;
+      wxColour colour;
+   };
+   std::vector< HighlightRect > m_highlight;
+   wxRect m_highlightBounds;
+   wxWeakRef< wxWindow > m_highlightPanel;
+   bool m_highlightValid;
 
-      wxWindow *m_window;
+   wxRect GetHighlightRect(const wxPoint& point, const wxSize& size, PObjectBase object);
+   void CalcHighlight();
+   void RefreshHighlightArea();
 
-     public:
-       HighlightPaintHandler(wxWindow *win);
-       void OnPaint(wxPaintEvent &event);
-   };
+   void OnActivePanelPaint(wxPaintEvent &event);
+   void OnActivePanelSize(wxSizeEvent &event);
+
+   DECLARE_CLASS(DesignerWindow)
 
  protected:
 
@@ -69,16 +79,21 @@ class DesignerWindow : public wxInnerFrame
      long style = 0, const wxString &name = wxT("designer_win"));
 	~DesignerWindow() override;
    void SetGrid(int x, int y);
-   void SetSelectedSizer(wxSizer *sizer) { m_selSizer = sizer; }
-   void SetSelectedItem(wxObject *item) { m_selItem = item; }
-   void SetSelectedObject(PObjectBase object) { m_selObj = object; }
-   void SetSelectedPanel(wxWindow *actPanel) { m_actPanel = actPanel; }
+   void SetSelectedSizer(wxSizer *sizer) { m_selSizer = sizer; m_highlightValid = false; }
+   void SetSelectedItem(wxObject *item) { m_selItem = item; m_highlightValid = false; }
+   void SetSelectedObject(PObjectBase object) { m_selObj = object; m_highlightValid = false; }
+   void SetSelectedPanel(wxWindow *actPanel);
    wxSizer *GetSelectedSizer() { return m_selSizer; }
    wxObject* GetSelectedItem() { return m_selItem; }
    PObjectBase GetSelectedObject() { return m_selObj.lock(); }
    wxWindow* GetActivePanel() { return m_actPanel; }
    static wxMenu* GetMenuFromObject(PObjectBase menu);
    void SetFrameWidgets(PObjectBase menubar, wxWindow *toolbar, wxWindow* statusbar, wxWindow *auipanel);
+   /**
+    * Recomputes the highlight after the selection changed and repaints
+    * only the areas covered by the previous and the new outlines.
+    */
+   void UpdateHighlight();
    void HighlightSelection(wxDC& dc);
    void OnPaint(wxPaintEvent &event);
 };
@@ -86,6 +101,7 @@ class DesignerWindow : public wxInnerFrame
 class wxFBEvent;
 class wxFBPropertyEvent;
 class wxFBObjectEvent;
+class wxFBChangeSetEvent;
 
 class VisualEditor : public wxScrolledWindow
 {
@@ -96,6 +112,10 @@ class VisualEditor : public wxScrolledWindow
   typedef std::map< ObjectBase*, wxObject* > ObjectBaseMap;
   ObjectBaseMap m_baseobjects;
 
+  // Book and wizard pages whose children have not been generated yet
+  typedef std::set< ObjectBase* > ObjectBaseSet;
+  ObjectBaseSet m_deferredPages;
+
   DesignerWindow *m_back;
   wxPanel *m_auipanel;
 
@@ -114,6 +134,7 @@ class VisualEditor : public wxScrolledWindow
 
  protected:
   void Generate( PObjectBase obj, wxWindow* parent, wxObject* parentObject );
+  bool IsDeferredPage( PObjectBase obj );
   void SetupWindow( PObjectBase obj, wxWindow* window );
   void SetupSizer( PObjectBase obj, wxSizer* sizer );
   void Create();
@@ -139,6 +160,21 @@ class VisualEditor : public wxScrolledWindow
 
   void UpdateVirtualSize();
 
+  /**
+   * Builds the hidden book and wizard pages which @a obj lies on, or which it shows
+   * when it is a book page item. Called when the selection or the shown page changes.
+   */
+  void ExpandDeferredPages( PObjectBase obj );
+
+  /**
+   * Builds @a form in the designer, lays it out and saves a snapshot of it,
+   * without the selection highlight, as a PNG image.
+   * The editor must be shown. The toolkit draws the form into the image, which
+   * works off the screen and in any X session (e.g. Xvfb), on Windows and GTK only.
+   * @return false if the form could not be built, captured or the image not saved.
+   */
+  bool RenderForm( PObjectBase form, const wxString& file );
+
   PObjectBase GetObjectBase( wxObject* wxobject );
   wxObject* GetWxObject( PObjectBase baseobject );
 
@@ -159,6 +195,7 @@ class VisualEditor : public wxScrolledWindow
   void OnObjectRemoved ( wxFBObjectEvent &event );
   void OnPropertyModified ( wxFBPropertyEvent &event );
   void OnProjectRefresh ( wxFBEvent &event);
+  void OnChangeSet ( wxFBChangeSetEvent &event );
 };
 
 #endif //__VISUAL_EDITOR__
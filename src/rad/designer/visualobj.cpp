@@ -36,7 +36,6 @@ using namespace TypeConv;
 BEGIN_EVENT_TABLE( VObjEvtHandler, wxEvtHandler )
 	EVT_LEFT_DOWN( VObjEvtHandler::OnLeftClick )
 	EVT_RIGHT_DOWN( VObjEvtHandler::OnRightClick )
-	EVT_PAINT( VObjEvtHandler::OnPaint )
 	EVT_SET_CURSOR( VObjEvtHandler::OnSetCursor )
 END_EVENT_TABLE()
 
@@ -116,23 +115,6 @@ void VObjEvtHandler::OnRightClick(wxMouseEvent &event)
 	::wxPostEvent(m_window->GetParent(), event);
 }
 
-void VObjEvtHandler::OnPaint(wxPaintEvent &event)
-{
-/*	PObjectBase wo = boost::shared_dynamic_cast<ObjectBase>(m_object.lock());
-	if (wo->IsContainer())
-	{ TODO: what this check is for? */
-		wxWindow *aux = m_window;
-		while (!aux->IsKindOf(CLASSINFO(DesignerWindow))) aux = aux->GetParent();
-		DesignerWindow *dsgnWin = (DesignerWindow*) aux;
-		if (dsgnWin->GetActivePanel() == m_window)
-		{
-			wxPaintDC dc(m_window);
-			dsgnWin->HighlightSelection(dc);
-		}
-/*	}*/
-	event.Skip();
-}
-
 void VObjEvtHandler::OnSetCursor(wxSetCursorEvent &event)
 {
 	wxCoord x = event.GetX(), y = event.GetY();
@@ -48,7 +48,6 @@ class VObjEvtHandler : public wxEvtHandler
    VObjEvtHandler(wxWindow *win, PObjectBase obj);
    void OnLeftClick(wxMouseEvent &event);
    void OnRightClick(wxMouseEvent &event);
-   void OnPaint(wxPaintEvent &event);
    void OnSetCursor(wxSetCursorEvent &event);
 };
 
@@ -0,0 +1,338 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "iconatlas.h"
+
+#include "../md5/md5.hh"
+#include "../utils/debug.h"
+
+#include <wx/ffile.h>
+#include <wx/file.h>
+#include <wx/filename.h>
+#include <wx/image.h>
+#include <wx/mstream.h>
+#include <wx/stdpaths.h>
+
+#include <cstring>
+
+namespace
+{
+	// Version of the cache file format, files of other versions are ignored
+	const char ATLAS_MAGIC[8] = { 'W', 'X', 'F', 'B', 'I', 'C', 'O', '2' };
+	const size_t HASH_LENGTH = 32;
+
+	bool ReadFile( const wxString& path, std::vector< unsigned char >& data )
+	{
+		wxFFile file( path, wxT("rb") );
+		if ( !file.IsOpened() )
+		{
+			return false;
+		}
+
+		wxFileOffset length = file.Length();
+		if ( length < 0 )
+		{
+			return false;
+		}
+
+		data.resize( static_cast< size_t >( length ) );
+		return data.empty() || file.Read( &data[0], data.size() ) == data.size();
+	}
+
+	wxString GetCacheDir()
+	{
+	#if wxCHECK_VERSION(3, 1, 0)
+		wxFileName dir( wxStandardPaths::Get().GetUserDir( wxStandardPaths::Dir_Cache ), wxEmptyString );
+		dir.AppendDir( wxT("wxformbuilder") );
+	#else
+		wxFileName dir( wxStandardPaths::Get().GetUserLocalDataDir(), wxEmptyString );
+		dir.AppendDir( wxT("cache") );
+	#endif
+		return dir.GetPath();
+	}
+}
+
+IconAtlas::AtlasMap IconAtlas::s_atlases;
+std::set< wxString > IconAtlas::s_iconFiles;
+
+IconAtlas::IconAtlas( int size )
+:
+m_size( size ),
+m_modified( false )
+{
+	m_cacheFile = GetCacheDir() + wxFILE_SEP_PATH + wxString::Format( wxT("icons%d.atlas"), size );
+	Load();
+}
+
+IconAtlas* IconAtlas::Get( int size )
+{
+	AtlasMap::iterator atlas = s_atlases.find( size );
+	if ( atlas == s_atlases.end() )
+	{
+		atlas = s_atlases.insert( AtlasMap::value_type( size, new IconAtlas( size ) ) ).first;
+	}
+	return atlas->second;
+}
+
+void IconAtlas::Destroy()
+{
+	for ( AtlasMap::iterator atlas = s_atlases.begin(); atlas != s_atlases.end(); ++atlas )
+	{
+		IconAtlas* current = atlas->second;
+		bool save = current->m_modified;
+		for ( size_t cell = 0; !save && cell < current->m_hashes.size(); ++cell )
+		{
+			save = !current->IsKept( cell );
+		}
+		if ( save )
+		{
+			current->Save();
+		}
+		delete current;
+	}
+	s_atlases.clear();
+}
+
+void IconAtlas::AddIconFile( const wxString& path )
+{
+	s_iconFiles.insert( path );
+}
+
+void IconAtlas::Load()
+{
+	std::vector< unsigned char > data;
+	if ( !wxFileName::FileExists( m_cacheFile ) || !ReadFile( m_cacheFile, data ) )
+	{
+		return;
+	}
+
+	// magic, icon size, icon count, the hash and file of each icon, then the RGB and alpha of the icons one below the other
+	const size_t headerLength = sizeof( ATLAS_MAGIC ) + 2 * sizeof( wxUint32 );
+	if ( data.size() < headerLength || memcmp( &data[0], ATLAS_MAGIC, sizeof( ATLAS_MAGIC ) ) != 0 )
+	{
+		return;
+	}
+
+	wxUint32 size = 0;
+	wxUint32 count = 0;
+	memcpy( &size, &data[ sizeof( ATLAS_MAGIC ) ], sizeof( size ) );
+	memcpy( &count, &data[ sizeof( ATLAS_MAGIC ) + sizeof( size ) ], sizeof( count ) );
+
+	const size_t pixels = static_cast< size_t >( m_size ) * m_size * count;
+	bool valid = ( size == static_cast< wxUint32 >( m_size ) );
+
+	const unsigned char* pos = &data[0] + headerLength;
+	const unsigned char* end = &data[0] + data.size();
+	std::vector< std::string > hashes;
+	std::vector< wxString > files;
+	for ( size_t i = 0; valid && i < count; ++i )
+	{
+		wxUint32 length = 0;
+		if ( static_cast< size_t >( end - pos ) < HASH_LENGTH + sizeof( length ) )
+		{
+			valid = false;
+			break;
+		}
+		hashes.push_back( std::string( pos, pos + HASH_LENGTH ) );
+		pos += HASH_LENGTH;
+		memcpy( &length, pos, sizeof( length ) );
+		pos += sizeof( length );
+		if ( static_cast< size_t >( end - pos ) < length )
+		{
+			valid = false;
+			break;
+		}
+		files.push_back( wxString::FromUTF8( reinterpret_cast< const char* >( pos ), length ) );
+		pos += length;
+	}
+
+	if ( !valid || static_cast< size_t >( end - pos ) != pixels * 4 )
+	{
+		LogDebug( "Ignoring the icon atlas " + m_cacheFile + ", it does not match its header" );
+		return;
+	}
+
+	m_hashes.swap( hashes );
+	m_files.swap( files );
+	for ( size_t i = 0; i < count; ++i )
+	{
+		m_cells[ m_hashes[i] ] = i;
+		if ( !m_files[i].empty() )
+		{
+			m_fileCells[ m_files[i] ] = i;
+		}
+	}
+	m_rgb.assign( pos, pos + pixels * 3 );
+	pos += pixels * 3;
+	m_alpha.assign( pos, pos + pixels );
+}
+
+void IconAtlas::Save() const
+{
+	if ( !wxFileName::Mkdir( GetCacheDir(), wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL ) )
+	{
+		return;
+	}
+
+	// The cache is replaced at once, a running instance never reads half of it
+	wxTempFile file( m_cacheFile );
+	if ( !file.IsOpened() )
+	{
+		return;
+	}
+
+	// Only the cells of the icon files of the loaded packages are kept, the atlas does not grow with every icon ever seen
+	std::vector< size_t > kept;
+	for ( size_t cell = 0; cell < m_hashes.size(); ++cell )
+	{
+		if ( IsKept( cell ) )
+		{
+			kept.push_back( cell );
+		}
+	}
+
+	const size_t pixels = static_cast< size_t >( m_size ) * m_size;
+	const wxUint32 size = m_size;
+	const wxUint32 count = static_cast< wxUint32 >( kept.size() );
+	file.Write( ATLAS_MAGIC, sizeof( ATLAS_MAGIC ) );
+	file.Write( &size, sizeof( size ) );
+	file.Write( &count, sizeof( count ) );
+	for ( std::vector< size_t >::const_iterator cell = kept.begin(); cell != kept.end(); ++cell )
+	{
+		const wxScopedCharBuffer path = m_files[ *cell ].utf8_str();
+		const wxUint32 length = static_cast< wxUint32 >( path.length() );
+		file.Write( m_hashes[ *cell ].data(), m_hashes[ *cell ].size() );
+		file.Write( &length, sizeof( length ) );
+		file.Write( path.data(), length );
+	}
+	for ( std::vector< size_t >::const_iterator cell = kept.begin(); cell != kept.end(); ++cell )
+	{
+		file.Write( &m_rgb[ *cell * pixels * 3 ], pixels * 3 );
+	}
+	for ( std::vector< size_t >::const_iterator cell = kept.begin(); cell != kept.end(); ++cell )
+	{
+		file.Write( &m_alpha[ *cell * pixels ], pixels );
+	}
+
+	if ( !file.Commit() )
+	{
+		LogDebug( "Could not write the icon atlas " + m_cacheFile );
+	}
+}
+
+bool IconAtlas::IsKept( size_t cell ) const
+{
+	return !m_files[ cell ].empty() && s_iconFiles.find( m_files[ cell ] ) != s_iconFiles.end();
+}
+
+void IconAtlas::SetCellFile( size_t cell, const wxString& path )
+{
+	if ( m_files[ cell ] == path )
+	{
+		return;
+	}
+
+	// A file has a single cell, the cell of its former content is dropped when saving
+	std::map< wxString, size_t >::iterator previous = m_fileCells.find( path );
+	if ( previous != m_fileCells.end() )
+	{
+		m_files[ previous->second ].clear();
+	}
+	if ( !m_files[ cell ].empty() )
+	{
+		m_fileCells.erase( m_files[ cell ] );
+	}
+
+	m_files[ cell ] = path;
+	m_fileCells[ path ] = cell;
+	m_modified = true;
+}
+
+void IconAtlas::AddCell( const std::string& hash, const wxString& path, wxImage& image )
+{
+	const size_t pixels = static_cast< size_t >( m_size ) * m_size;
+
+	m_cells[ hash ] = m_hashes.size();
+	m_hashes.push_back( hash );
+	m_files.push_back( wxEmptyString );
+	SetCellFile( m_hashes.size() - 1, path );
+	m_rgb.insert( m_rgb.end(), image.GetData(), image.GetData() + pixels * 3 );
+	m_alpha.insert( m_alpha.end(), image.GetAlpha(), image.GetAlpha() + pixels );
+	m_modified = true;
+}
+
+wxImage IconAtlas::GetCell( size_t cell ) const
+{
+	const size_t pixels = static_cast< size_t >( m_size ) * m_size;
+
+	wxImage image( m_size, m_size, false );
+	memcpy( image.GetData(), &m_rgb[ cell * pixels * 3 ], pixels * 3 );
+	image.SetAlpha();
+	memcpy( image.GetAlpha(), &m_alpha[ cell * pixels ], pixels );
+	return image;
+}
+
+wxBitmap IconAtlas::GetIcon( const wxString& path )
+{
+	std::vector< unsigned char > data;
+	if ( !wxFileName::FileExists( path ) || !ReadFile( path, data ) || data.empty() )
+	{
+		return wxNullBitmap;
+	}
+
+	MD5 md5( &data[0], static_cast< uint32_t >( data.size() ) );
+	char* digest = md5.hex_digest();
+	const std::string hash( digest );
+	delete [] digest;
+
+	std::map< std::string, size_t >::const_iterator cell = m_cells.find( hash );
+	if ( cell != m_cells.end() )
+	{
+		// Files with the same content share a cell, it only follows a file when its own was dropped
+		if ( !IsKept( cell->second ) )
+		{
+			SetCellFile( cell->second, path );
+		}
+		return wxBitmap( GetCell( cell->second ) );
+	}
+
+	// Not in the cache yet, decode the file once
+	wxMemoryInputStream stream( &data[0], data.size() );
+	wxImage image;
+	if ( !image.LoadFile( stream, wxBITMAP_TYPE_ANY ) )
+	{
+		return wxNullBitmap;
+	}
+
+	if ( image.GetWidth() != m_size || image.GetHeight() != m_size )
+	{
+		image = image.Scale( m_size, m_size );
+	}
+
+	// Masks become alpha, every cell has the same layout
+	if ( !image.HasAlpha() )
+	{
+		image.InitAlpha();
+	}
+
+	AddCell( hash, path, image );
+	return wxBitmap( image );
+}
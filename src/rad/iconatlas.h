@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __ICON_ATLAS__
+#define __ICON_ATLAS__
+
+#include <wx/bitmap.h>
+#include <wx/string.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+class wxImage;
+
+/**
+* Component icons scaled to one size, packed one below the other into a single image
+* cached in the user cache directory. Icons are found by the MD5 of their file, so the
+* cache survives moving the plugins and an edited icon is decoded again.
+* Icons missing from the atlas are decoded from their file the first time they are
+* asked for. Each cell remembers the file it was decoded from; when saving, the cells of
+* files no loaded package declares any more, or replaced by a newer content of their file, are dropped.
+*/
+class IconAtlas
+{
+private:
+	typedef std::map< int, IconAtlas* > AtlasMap;
+	static AtlasMap s_atlases;
+	static std::set< wxString > s_iconFiles;
+
+	int m_size;
+	wxString m_cacheFile;
+	std::map< std::string, size_t > m_cells;
+	std::map< wxString, size_t > m_fileCells;
+	std::vector< std::string > m_hashes;
+	std::vector< wxString > m_files;
+	std::vector< unsigned char > m_rgb;
+	std::vector< unsigned char > m_alpha;
+	bool m_modified;
+
+	explicit IconAtlas( int size );
+
+	void Load();
+	void Save() const;
+	bool IsKept( size_t cell ) const;
+	void SetCellFile( size_t cell, const wxString& path );
+	void AddCell( const std::string& hash, const wxString& path, wxImage& image );
+	wxImage GetCell( size_t cell ) const;
+
+public:
+	/// The atlas of the icons of a size, loaded from the cache the first time
+	static IconAtlas* Get( int size );
+
+	/// Saves the atlases which changed or hold icons of files no package declares, and frees them
+	static void Destroy();
+
+	/// Declares an icon file of a loaded package, its cell is kept when the atlases are saved
+	static void AddIconFile( const wxString& path );
+
+	/**
+	* The icon of an image file, scaled to the size of the atlas.
+	* @return An invalid bitmap if the file could not be loaded.
+	*/
+	wxBitmap GetIcon( const wxString& path );
+};
+
+#endif //__ICON_ATLAS__
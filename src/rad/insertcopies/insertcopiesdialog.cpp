@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "insertcopiesdialog.h"
+
+#include <wx/sizer.h>
+#include <wx/spinctrl.h>
+#include <wx/stattext.h>
+#include <wx/textctrl.h>
+
+InsertCopiesDialog::InsertCopiesDialog( wxWindow* parent, const wxString& objectName )
+:
+wxDialog( parent, wxID_ANY, _("Insert Copies of ") + objectName )
+{
+	wxBoxSizer* topSizer = new wxBoxSizer( wxVERTICAL );
+	wxFlexGridSizer* fieldSizer = new wxFlexGridSizer( 2, 5, 5 );
+	fieldSizer->AddGrowableCol( 1 );
+
+	fieldSizer->Add( new wxStaticText( this, wxID_ANY, _("Copies:") ), 0, wxALIGN_CENTER_VERTICAL );
+	m_count = new wxSpinCtrl( this, wxID_ANY, wxEmptyString, wxDefaultPosition, wxDefaultSize, wxSP_ARROW_KEYS, 1, 1000, 1 );
+	fieldSizer->Add( m_count, 0, wxEXPAND );
+
+	fieldSizer->Add( new wxStaticText( this, wxID_ANY, _("Names:") ), 0, wxALIGN_CENTER_VERTICAL );
+	m_namePattern = new wxTextCtrl( this, wxID_ANY );
+	fieldSizer->Add( m_namePattern, 0, wxEXPAND );
+
+	fieldSizer->Add( new wxStaticText( this, wxID_ANY, _("Labels:") ), 0, wxALIGN_CENTER_VERTICAL );
+	m_labelPattern = new wxTextCtrl( this, wxID_ANY );
+	fieldSizer->Add( m_labelPattern, 0, wxEXPAND );
+
+	topSizer->Add( fieldSizer, 0, wxEXPAND | wxALL, 10 );
+
+	wxStaticText* help = new wxStaticText( this, wxID_ANY,
+		_("In the patterns, %s stands for the name or label of the copied object and %n for the number of the copy.\n"
+		  "Leave a pattern empty to keep the names, numbered on conflict, or the labels. "
+		  "The children of the copies keep their names, numbered on conflict.") );
+	help->Wrap( 350 );
+	topSizer->Add( help, 0, wxLEFT | wxRIGHT | wxBOTTOM, 10 );
+
+	topSizer->Add( CreateStdDialogButtonSizer( wxOK | wxCANCEL ), 0, wxEXPAND | wxALL, 10 );
+
+	SetSizerAndFit( topSizer );
+	m_count->SetFocus();
+}
+
+unsigned int InsertCopiesDialog::GetCount() const
+{
+	return (unsigned int)m_count->GetValue();
+}
+
+wxString InsertCopiesDialog::GetNamePattern() const
+{
+	return m_namePattern->GetValue();
+}
+
+wxString InsertCopiesDialog::GetLabelPattern() const
+{
+	return m_labelPattern->GetValue();
+}
@@ -0,0 +1,48 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __INSERT_COPIES_DIALOG__
+#define __INSERT_COPIES_DIALOG__
+
+#include <wx/dialog.h>
+
+class wxSpinCtrl;
+class wxTextCtrl;
+
+/**
+ * Asks for the number of copies of the selected object and the patterns of their names and labels.
+ */
+class InsertCopiesDialog : public wxDialog
+{
+private:
+	wxSpinCtrl* m_count;
+	wxTextCtrl* m_namePattern;
+	wxTextCtrl* m_labelPattern;
+
+public:
+	InsertCopiesDialog( wxWindow* parent, const wxString& objectName );
+
+	unsigned int GetCount() const;
+	wxString GetNamePattern() const;
+	wxString GetLabelPattern() const;
+};
+
+#endif //__INSERT_COPIES_DIALOG__
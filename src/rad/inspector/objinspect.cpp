@@ -31,6 +31,7 @@
 #include "wxfbadvprops.h"
 
 #include "../../utils/debug.h"
+#include "../../utils/profiler.h"
 #include "../../utils/typeconv.h"
 #include "../../utils/wxfbexception.h"
 
@@ -69,6 +70,7 @@ BEGIN_EVENT_TABLE(ObjectInspector, wxPanel)
 	EVT_FB_PROJECT_REFRESH( ObjectInspector::OnProjectRefresh )
 	EVT_FB_PROPERTY_MODIFIED( ObjectInspector::OnPropertyModified )
 	EVT_FB_EVENT_HANDLER_MODIFIED( ObjectInspector::OnEventHandlerModified )
+	EVT_FB_CHANGE_SET( ObjectInspector::OnChangeSet )
 	EVT_CHILD_FOCUS( ObjectInspector::OnChildFocus )
 END_EVENT_TABLE()
 
@@ -120,6 +122,8 @@ void ObjectInspector::SavePosition()
 
 void ObjectInspector::Create( bool force )
 {
+	ProfileScope profile( wxT("ObjectInspector::Create") );
+
 	PObjectBase sel_obj = AppData()->GetSelectedObject();
 	if ( sel_obj && ( sel_obj != m_currentSel || force ) )
 	{
@@ -922,6 +926,12 @@ void ObjectInspector::OnProjectRefresh( wxFBEvent& )
 	Create( true );
 }
 
+void ObjectInspector::OnChangeSet( wxFBChangeSetEvent& )
+{
+	// Rebuild the grids once instead of updating them value by value
+	Create( true );
+}
+
 void ObjectInspector::OnEventHandlerModified( wxFBEventHandlerEvent& event )
 {
 	PEvent e = event.GetFBEventHandler();
@@ -41,6 +41,7 @@
 class wxFBEventHandlerEvent;
 class wxFBPropertyEvent;
 class wxFBObjectEvent;
+class wxFBChangeSetEvent;
 class wxFBEvent;
 
 enum {
@@ -160,6 +161,7 @@ public:
     void OnProjectRefresh( wxFBEvent& event );
     void OnPropertyModified( wxFBPropertyEvent& event );
     void OnEventHandlerModified( wxFBEventHandlerEvent& event );
+    void OnChangeSet( wxFBChangeSetEvent& event );
 
     void AutoGenerateId( PObjectBase objectChanged, PProperty propChanged, wxString reason );
     wxPropertyGridManager* CreatePropertyGridManager( wxWindow *parent, wxWindowID id );
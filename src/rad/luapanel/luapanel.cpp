@@ -51,6 +51,7 @@ BEGIN_EVENT_TABLE ( LuaPanel,  wxPanel )
 	EVT_FB_OBJECT_CREATED( LuaPanel::OnObjectChange )
 	EVT_FB_OBJECT_REMOVED( LuaPanel::OnObjectChange )
 	EVT_FB_OBJECT_SELECTED( LuaPanel::OnObjectChange )
+	EVT_FB_CHANGE_SET( LuaPanel::OnChangeSet )
 	EVT_FB_EVENT_HANDLER_MODIFIED( LuaPanel::OnEventHandlerModified )
 
 	EVT_FIND( wxID_ANY, LuaPanel::OnFind )
@@ -155,6 +156,13 @@ void LuaPanel::OnEventHandlerModified( wxFBEventHandlerEvent& event )
 	OnCodeGeneration( event );
 }
 
+void LuaPanel::OnChangeSet( wxFBChangeSetEvent& event )
+{
+	// Generate code to the panel only, once for the whole change set
+	event.SetId( 1 );
+	OnCodeGeneration( event );
+}
+
 void LuaPanel::OnCodeGeneration( wxFBEvent& event )
 {
     PObjectBase objectToGenerate;
@@ -48,6 +48,7 @@ class wxFindDialogEvent;
 class wxFBEvent;
 class wxFBPropertyEvent;
 class wxFBObjectEvent;
+class wxFBChangeSetEvent;
 class wxFBEventHandlerEvent;
 
 class LuaPanel : public wxPanel
@@ -66,6 +67,7 @@ public:
 	void OnProjectRefresh( wxFBEvent& event );
 	void OnCodeGeneration( wxFBEvent& event );
 	void OnObjectChange( wxFBObjectEvent& event );
+	void OnChangeSet( wxFBChangeSetEvent& event );
 	void OnEventHandlerModified( wxFBEventHandlerEvent& event );
 
 	void OnFind( wxFindDialogEvent& event );
@@ -26,6 +26,7 @@
 #include "mainframe.h"
 
 #include "../model/xrcfilter.h"
+#include "../utils/profiler.h"
 #include "../utils/stringutils.h"
 #include "../utils/wxfbexception.h"
 #include "about.h"
@@ -35,10 +36,12 @@
 #include "cpppanel/cpppanel.h"
 #include "designer/visualeditor.h"
 #include "geninheritclass/geninhertclass.h"
+#include "insertcopies/insertcopiesdialog.h"
 #include "inspector/objinspect.h"
 #include "luapanel/luapanel.h"
 #include "objecttree/objecttree.h"
 #include "palette.h"
+#include "perfpanel/perfpanel.h"
 #include "phppanel/phppanel.h"
 #include "pythonpanel/pythonpanel.h"
 #include "title.h"
@@ -88,6 +91,8 @@ enum
 
 	ID_PREVIEW_XRC,
 	ID_GEN_INHERIT_CLS,
+	ID_PERFORMANCE,
+	ID_INSERT_COPIES,
 
 	// The preference dialog must use wxID_PREFERENCES for wxMAC
 	//ID_SETTINGS_GLOBAL, // For the future preference dialogs
@@ -142,6 +147,8 @@ EVT_MENU( ID_GEN_INHERIT_CLS, MainFrame::OnGenInhertedClass )
 EVT_MENU( ID_CLIPBOARD_COPY, MainFrame::OnClipboardCopy )
 EVT_MENU( ID_CLIPBOARD_PASTE, MainFrame::OnClipboardPaste )
 EVT_MENU( ID_WINDOW_SWAP, MainFrame::OnWindowSwap )
+EVT_MENU( ID_PERFORMANCE, MainFrame::OnPerformance )
+EVT_MENU( ID_INSERT_COPIES, MainFrame::OnInsertCopies )
 
 EVT_UPDATE_UI( ID_CLIPBOARD_PASTE, MainFrame::OnClipboardPasteUpdateUI )
 EVT_CLOSE( MainFrame::OnClose )
@@ -156,6 +163,7 @@ EVT_FB_PROJECT_REFRESH( MainFrame::OnProjectRefresh )
 EVT_FB_PROJECT_SAVED( MainFrame::OnProjectSaved )
 EVT_FB_PROPERTY_MODIFIED( MainFrame::OnPropertyModified )
 EVT_FB_EVENT_HANDLER_MODIFIED( MainFrame::OnEventHandlerModified )
+EVT_FB_CHANGE_SET( MainFrame::OnChangeSet )
 
 EVT_MENU( ID_FIND, MainFrame::OnFindDialog )
 EVT_FIND( wxID_ANY, MainFrame::OnFind )
@@ -287,6 +295,7 @@ m_findDialog( NULL )
 	// Init. m_cpp and m_xrc first
 	m_cpp = NULL;
 	m_xrc = NULL;
+	m_perf = NULL;
 	m_python = NULL;
 	m_lua = NULL;
 	m_php = NULL;
@@ -616,13 +625,10 @@ void MainFrame::OnImportXrc( wxCommandEvent &)
 
 		try
 		{
-			ticpp::Document doc;
-			XMLUtils::LoadXMLFile( doc, false, dialog->GetPath() );
-
 			XrcLoader xrc;
 			xrc.SetObjectDatabase( AppData()->GetObjectDatabase() );
 
-			PObjectBase project = xrc.GetProject( &doc );
+			PObjectBase project = xrc.GetProject( dialog->GetPath() );
 
 			if ( project )
 			{
@@ -880,6 +886,26 @@ void MainFrame::OnProjectRefresh( wxFBEvent& )
 	UpdateFrame();
 }
 
+void MainFrame::OnChangeSet( wxFBChangeSetEvent& event )
+{
+	wxString message;
+	message.Printf( wxT( "%u object(s) modified." ), (unsigned int)event.GetFBObjects().size() );
+	GetStatusBar()->SetStatusText( message );
+
+	if ( event.IsStructureChanged() )
+	{
+		PObjectBase project = AppData()->GetProjectData();
+
+		if ( project )
+		{
+			wxString objDetails = wxString::Format( wxT( "Name: %s | Class: %s" ), project->GetPropertyAsString( wxT( "name" ) ).c_str(), project->GetClassName().c_str() );
+			GetStatusBar()->SetStatusText( objDetails, STATUS_FIELD_OBJECT );
+		}
+	}
+
+	UpdateFrame();
+}
+
 void MainFrame::OnUndo( wxCommandEvent &)
 {
 	AppData()->Undo();
@@ -991,6 +1017,8 @@ void MainFrame::UpdateFrame()
 	menuEdit->Enable( ID_DELETE, copy );
 	toolbar->EnableTool( ID_DELETE, copy );
 
+	menuEdit->Enable( ID_INSERT_COPIES, copy );
+
 	menuEdit->Enable( ID_MOVE_UP, copy );
 	menuEdit->Enable( ID_MOVE_DOWN, copy );
 	menuEdit->Enable( ID_MOVE_LEFT, copy );
@@ -1106,6 +1134,22 @@ void MainFrame::OnDelete ( wxCommandEvent &)
 	UpdateFrame();
 }
 
+void MainFrame::OnInsertCopies( wxCommandEvent& )
+{
+	PObjectBase obj = AppData()->GetSelectedObject();
+	if ( !obj )
+	{
+		return;
+	}
+
+	InsertCopiesDialog dialog( this, obj->GetPropertyAsString( wxT("name") ) );
+	if ( dialog.ShowModal() == wxID_OK )
+	{
+		AppData()->InsertObjectCopies( obj, dialog.GetCount(), dialog.GetNamePattern(), dialog.GetLabelPattern() );
+		UpdateFrame();
+	}
+}
+
 void MainFrame::OnPaste ( wxCommandEvent &)
 {
 	wxWindow *focusedWindow = wxWindow::FindFocus();
@@ -1248,6 +1292,25 @@ void MainFrame::OnXrcPreview( wxCommandEvent& WXUNUSED( e ) )
 
 }
 
+void MainFrame::OnPerformance( wxCommandEvent& e )
+{
+	if ( e.IsChecked() )
+	{
+		Profiler::Enable();
+		if ( !m_perf )
+		{
+			m_perf = new PerformancePanel( m_notebook, wxID_ANY );
+			m_notebook->AddPage( m_perf, wxT( "Performance" ), true );
+		}
+	}
+	else if ( m_perf )
+	{
+		Profiler::Enable( false );
+		m_notebook->DeletePage( m_notebook->GetPageIndex( m_perf ) );
+		m_perf = NULL;
+	}
+}
+
 void MainFrame::OnGenInhertedClass( wxCommandEvent& WXUNUSED( e ) )
 {
 	wxString filePath;
@@ -1499,6 +1562,7 @@ wxMenuBar * MainFrame::CreateFBMenuBar()
 	menuEdit->Append( ID_CUT, wxT( "Cut \tCtrl+X" ), wxT( "Cut selected object" ) );
 	menuEdit->Append( ID_PASTE, wxT( "&Paste \tCtrl+V" ), wxT( "Paste on selected object" ) );
 	menuEdit->Append( ID_DELETE, wxT( "&Delete \tCtrl+D" ), wxT( "Delete selected object" ) );
+	menuEdit->Append( ID_INSERT_COPIES, wxT( "&Insert Copies...\tCtrl+Shift+D" ), wxT( "Insert copies of the selected object after it" ) );
 	menuEdit->AppendSeparator();
 	menuEdit->Append( ID_CLIPBOARD_COPY, wxT("Copy Object To Clipboard\tCtrl+Shift+C"), wxT("Copy Object to Clipboard") );
 	menuEdit->Append( ID_CLIPBOARD_PASTE, wxT("Paste Object From Clipboard\tCtrl+Shift+V"), wxT("Paste Object from Clipboard") );
@@ -1523,6 +1587,8 @@ wxMenuBar * MainFrame::CreateFBMenuBar()
 	menuView->Append( ID_PREVIEW_XRC, wxT( "&XRC Window\tF5" ), wxT( "Show a preview of the XRC window" ) );
 	menuView->AppendSeparator();
 	menuView->Append( ID_WINDOW_SWAP, wxT( "&Swap The Editor and Properties Window\tF12" ), wxT( "Swap The Editor and Properties Window" ) );
+	menuView->AppendSeparator();
+	menuView->AppendCheckItem( ID_PERFORMANCE, wxT( "&Performance Monitor" ), wxT( "Show timings of designer rebuilds and code generation" ) );
 
 	wxMenu *menuTools = new wxMenu;
 	menuTools->Append( ID_GEN_INHERIT_CLS, wxT( "&Generate Inherited Class\tF6" ), wxT( "Creates the needed files and class for proper inheritance of your designed GUI" ) );
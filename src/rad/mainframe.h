@@ -33,6 +33,7 @@
 
 class wxFBEvent;
 class wxFBObjectEvent;
+class wxFBChangeSetEvent;
 class wxFBPropertyEvent;
 class wxFBEventHandlerEvent;
 
@@ -41,6 +42,7 @@ class PythonPanel;
 class LuaPanel;
 class PHPPanel;
 class XrcPanel;
+class PerformancePanel;
 class ObjectTree;
 class ObjectInspector;
 class wxFbPalette;
@@ -78,6 +80,7 @@ class MainFrame : public wxFrame
   LuaPanel *m_lua;
   PHPPanel *m_php;
   XrcPanel *m_xrc;
+  PerformancePanel *m_perf;
   int m_style;
 
   // Save which page is selected
@@ -129,6 +132,7 @@ class MainFrame : public wxFrame
   void OnPaste (wxCommandEvent &event);
   void OnCut (wxCommandEvent &event);
   void OnDelete (wxCommandEvent &event);
+  void OnInsertCopies(wxCommandEvent& event);
   void OnClipboardCopy(wxCommandEvent& e);
   void OnClipboardPaste(wxCommandEvent& e);
   void OnClipboardPasteUpdateUI( wxUpdateUIEvent& e );
@@ -143,6 +147,7 @@ class MainFrame : public wxFrame
   void OnXrcPreview(wxCommandEvent& e);
   void OnGenInhertedClass(wxCommandEvent& e);
   void OnWindowSwap(wxCommandEvent& e);
+  void OnPerformance(wxCommandEvent& e);
 
   void OnAuiNotebookPageChanged( wxAuiNotebookEvent& event );
 
@@ -156,6 +161,7 @@ class MainFrame : public wxFrame
   void OnEventHandlerModified( wxFBEventHandlerEvent& event );
   void OnCodeGeneration( wxFBEvent& event );
   void OnProjectRefresh( wxFBEvent& event );
+  void OnChangeSet( wxFBChangeSetEvent& event );
 
   void OnSplitterChanged( wxSplitterEvent &event );
 
@@ -176,4 +182,6 @@ class MainFrame : public wxFrame
   void OnFindClose( wxFindDialogEvent& event );
 
   bool SaveWarning();
+
+  VisualEditor* GetVisualEditor() { return m_visualEdit; }
   };
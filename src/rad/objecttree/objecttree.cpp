@@ -26,11 +26,14 @@
 #include "objecttree.h"
 
 #include "../../model/objectbase.h"
+#include "../../utils/profiler.h"
 #include "../appdata.h"
 #include "../bitmaps.h"
+#include "../insertcopies/insertcopiesdialog.h"
 #include "../menueditor.h"
 #include "../wxfbevent.h"
 
+#include <wx/app.h>
 #include <wx/imaglist.h>
 
 BEGIN_EVENT_TABLE( ObjectTree, wxPanel )
@@ -46,6 +49,7 @@ BEGIN_EVENT_TABLE( ObjectTree, wxPanel )
 	EVT_FB_OBJECT_REMOVED( ObjectTree::OnObjectRemoved )
 	EVT_FB_PROPERTY_MODIFIED( ObjectTree::OnPropertyModified )
 	EVT_FB_PROJECT_REFRESH( ObjectTree::OnProjectRefresh )
+	EVT_FB_CHANGE_SET( ObjectTree::OnChangeSet )
 
 END_EVENT_TABLE()
 
@@ -121,6 +125,8 @@ PObjectBase ObjectTree::GetObjectFromTreeItem( wxTreeItemId item )
 
 void ObjectTree::RebuildTree()
 {
+	ProfileScope profile( wxT("ObjectTree::RebuildTree") );
+
 	m_tcObjects->Freeze();
 
 	Disconnect( wxID_ANY, wxEVT_COMMAND_TREE_ITEM_EXPANDED, wxTreeEventHandler( ObjectTree::OnExpansionChange ) );
@@ -349,7 +355,15 @@ int ObjectTree::GetImageIndex (wxString name)
 
 	IconIndexMap::iterator it = m_iconIdx.find(name);
 	if (it != m_iconIdx.end())
+	{
+		// The icon is added to the list the first time the class is shown
+		if ( it->second < 0 )
+		{
+			PObjectInfo info = AppData()->GetObjectDatabase()->GetObjectInfo( name );
+			it->second = ( info ? m_iconList->Add( info->GetIconFile() ) : 0 );
+		}
 		index = it->second;
+	}
 
 	return index;
 }
@@ -374,13 +388,11 @@ void ObjectTree::UpdateItem(wxTreeItemId id, PObjectBase obj)
 void ObjectTree::Create()
 {
 	// Cramos la lista de iconos obteniendo los iconos de los paquetes.
-	unsigned int index = 0;
 	m_iconList = new wxImageList(ICON_SIZE,ICON_SIZE);
 
 	{
 		wxBitmap icon = AppBitmaps::GetBitmap(wxT("project"), ICON_SIZE);
-		m_iconList->Add(icon);
-		m_iconIdx.insert(IconIndexMap::value_type( wxT("_default_"),index++));
+		m_iconIdx.insert(IconIndexMap::value_type( wxT("_default_"), m_iconList->Add(icon) ));
 	}
 
 	unsigned int pkg_count = AppData()->GetPackageCount();
@@ -392,8 +404,7 @@ void ObjectTree::Create()
 		for (j=0;j<pkg->GetObjectCount();j++)
 		{
 			wxString comp_name(pkg->GetObjectInfo(j)->GetClassName());
-			m_iconList->Add( pkg->GetObjectInfo(j)->GetIconFile() );
-			m_iconIdx.insert(IconIndexMap::value_type(comp_name,index++));
+			m_iconIdx.insert(IconIndexMap::value_type(comp_name,-1));
 		}
 	}
 
@@ -546,6 +557,29 @@ void ObjectTree::OnProjectRefresh ( wxFBEvent &)
 	RebuildTree();
 }
 
+void ObjectTree::OnChangeSet ( wxFBChangeSetEvent &event )
+{
+	if ( event.IsStructureChanged() )
+	{
+		RebuildTree();
+		return;
+	}
+
+	// Only the labels can have changed
+	const std::vector< PProperty >& properties = event.GetFBProperties();
+	for ( std::vector< PProperty >::const_iterator prop = properties.begin(); prop != properties.end(); ++prop )
+	{
+		if ( (*prop)->GetName() == wxT("name") )
+		{
+			ObjectItemMap::iterator it = m_map.find( (*prop)->GetObject() );
+			if ( it != m_map.end() )
+			{
+				UpdateItem( it->second, it->first );
+			}
+		}
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 ObjectTreeItemData::ObjectTreeItemData(PObjectBase obj) : m_object(obj)
@@ -564,6 +598,7 @@ enum {
 	MENU_COPY,
 	MENU_MOVE_NEW_BOXSIZER,
 	MENU_DELETE,
+	MENU_INSERT_COPIES,
 };
 
 
@@ -578,6 +613,7 @@ ItemPopupMenu::ItemPopupMenu(PObjectBase obj) : m_object(obj) {
 	Append(MENU_PASTE,      wxT("Paste\tCtrl+V"));
 	AppendSeparator();
 	Append(MENU_DELETE,     wxT("Delete\tCtrl+D"));
+	Append(MENU_INSERT_COPIES, wxT("Insert Copies...\tCtrl+Shift+D"));
 	AppendSeparator();
 	Append(MENU_MOVE_UP,    wxT("Move Up\tAlt+Up"));
 	Append(MENU_MOVE_DOWN,  wxT("Move Down\tAlt+Down"));
@@ -607,6 +643,13 @@ void ItemPopupMenu::OnMenuEvent (wxCommandEvent & event)
 	case MENU_DELETE:
 		AppData()->RemoveObject(m_object);
 		break;
+	case MENU_INSERT_COPIES:
+		{
+			InsertCopiesDialog dialog(wxTheApp->GetTopWindow(), m_object->GetPropertyAsString(wxT("name")));
+			if (dialog.ShowModal() == wxID_OK)
+				AppData()->InsertObjectCopies(m_object, dialog.GetCount(), dialog.GetNamePattern(), dialog.GetLabelPattern());
+		}
+		break;
 	case MENU_MOVE_UP:
 		AppData()->MovePosition(m_object,false);
 		break;
@@ -680,6 +723,7 @@ void ItemPopupMenu::OnUpdateEvent(wxUpdateUIEvent& e)
 	case MENU_CUT:
 	case MENU_COPY:
 	case MENU_DELETE:
+	case MENU_INSERT_COPIES:
 	case MENU_MOVE_UP:
 	case MENU_MOVE_DOWN:
 	case MENU_MOVE_LEFT:
@@ -34,6 +34,7 @@
 class wxFBEvent;
 class wxFBPropertyEvent;
 class wxFBObjectEvent;
+class wxFBChangeSetEvent;
 
 class ObjectTree : public wxPanel
 {
@@ -87,6 +88,7 @@ public:
   void OnObjectRemoved ( wxFBObjectEvent &event );
   void OnPropertyModified ( wxFBPropertyEvent &event );
   void OnProjectRefresh ( wxFBEvent &event);
+  void OnChangeSet ( wxFBChangeSetEvent &event );
   void OnKeyDown ( wxTreeEvent &event);
 
   void AddCustomKeysHandler(CustomKeysEvtHandler *h) { m_tcObjects->PushEventHandler(h); };
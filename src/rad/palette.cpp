@@ -29,6 +29,7 @@
 #include "../utils/debug.h"
 #include "appdata.h"
 #include "auitabart.h"
+#include "bitmaps.h"
 
 #include <map>
 #include <vector>
@@ -52,6 +53,7 @@ BEGIN_EVENT_TABLE( wxFbPalette, wxPanel )
 	#endif
 	EVT_SPIN_UP(wxID_ANY, wxFbPalette::OnSpinUp)
 	EVT_SPIN_DOWN(wxID_ANY, wxFbPalette::OnSpinDown)
+	EVT_AUINOTEBOOK_PAGE_CHANGED(wxID_ANY, wxFbPalette::OnPageChanged)
 END_EVENT_TABLE()
 
 wxFbPalette::wxFbPalette( wxWindow *parent, int id )
@@ -59,8 +61,12 @@ wxFbPalette::wxFbPalette( wxWindow *parent, int id )
 {
 }
 
-void wxFbPalette::PopulateToolbar( PObjectPackage pkg, wxAuiToolBar *toolbar )
+void wxFbPalette::PopulateToolbar( PObjectPackage pkg, wxAuiToolBar *toolbar, PendingIcons* pending )
 {
+	// Every tool has the same size, the icons are set when the page is opened
+	wxBitmap placeholder = AppBitmaps::GetBitmap( wxT("unknown"), ICON_SIZE );
+	pending->toolbar = toolbar;
+
 	unsigned int j = 0;
 	while ( j < pkg->GetObjectCount() )
 	{
@@ -69,7 +75,7 @@ void wxFbPalette::PopulateToolbar( PObjectPackage pkg, wxAuiToolBar *toolbar )
 		{
 			toolbar->AddSeparator();
 		}
-		if ( NULL == info->GetComponent() )
+		if ( !info->HasComponent() )
 		{
 			LogDebug(_("Missing Component for Class \"" + info->GetClassName() + "\" of Package \"" + pkg->GetPackageName() + "\".") );
 		}
@@ -77,14 +83,14 @@ void wxFbPalette::PopulateToolbar( PObjectPackage pkg, wxAuiToolBar *toolbar )
 		{
 			wxString widget( info->GetClassName() );
 
-			wxBitmap icon = info->GetIconFile();
+			pending->tools.push_back( std::make_pair( nextId, info ) );
 
 			#ifdef __WXMAC__
-				wxBitmapButton* button = new wxBitmapButton( toolbar, nextId++, icon );
+				wxBitmapButton* button = new wxBitmapButton( toolbar, nextId++, placeholder );
 				button->SetToolTip( widget );
 				toolbar->AddControl( button );
 			#else
-				toolbar->AddTool(nextId++, widget, icon, widget);
+				toolbar->AddTool(nextId++, widget, placeholder, widget);
 			#endif
 
 			toolbar->Realize();
@@ -171,7 +177,7 @@ void wxFbPalette::Create()
 
 		wxAuiToolBar *toolbar = new wxAuiToolBar( panel, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxAUI_TB_DEFAULT_STYLE | wxAUI_TB_OVERFLOW | wxNO_BORDER );
 		toolbar->SetToolBitmapSize( wxSize( 22, 22 ) );
-		PopulateToolbar(page.second, toolbar);
+		PopulateToolbar(page.second, toolbar, &m_pendingIcons[ panel ]);
 		m_tv.push_back( toolbar );
 
 		sizer->Add( toolbar, 1, wxEXPAND, 0 );
@@ -197,6 +203,47 @@ void wxFbPalette::Create()
 	SetMinSize( minsize );
 	Layout();
 	Fit();
+
+	if ( m_notebook->GetSelection() != wxNOT_FOUND )
+	{
+		LoadPageIcons( m_notebook->GetPage( m_notebook->GetSelection() ) );
+	}
+}
+
+void wxFbPalette::LoadPageIcons( wxWindow* page )
+{
+	std::map< wxWindow*, PendingIcons >::iterator pending = m_pendingIcons.find( page );
+	if ( pending == m_pendingIcons.end() )
+	{
+		return;
+	}
+
+	wxAuiToolBar* toolbar = pending->second.toolbar;
+	std::vector< std::pair< int, PObjectInfo > >::iterator tool;
+	for ( tool = pending->second.tools.begin(); tool != pending->second.tools.end(); ++tool )
+	{
+		#ifdef __WXMAC__
+			wxBitmapButton* button = wxDynamicCast( toolbar->FindWindow( tool->first ), wxBitmapButton );
+			if ( button )
+			{
+				button->SetBitmapLabel( tool->second->GetIconFile() );
+			}
+		#else
+			toolbar->SetToolBitmap( tool->first, tool->second->GetIconFile() );
+		#endif
+	}
+	toolbar->Refresh();
+
+	m_pendingIcons.erase( pending );
+}
+
+void wxFbPalette::OnPageChanged( wxAuiNotebookEvent& event )
+{
+	if ( event.GetSelection() != wxNOT_FOUND )
+	{
+		LoadPageIcons( m_notebook->GetPage( event.GetSelection() ) );
+	}
+	event.Skip();
 }
 
 void wxFbPalette::OnSpinUp( wxSpinEvent& )
@@ -207,23 +254,79 @@ void wxFbPalette::OnSpinDown( wxSpinEvent& )
 {
 }
 
+void wxFbPalette::RemoveMissingTools()
+{
+	PObjectDatabase database = AppData()->GetObjectDatabase();
+	for ( unsigned int i = 0; i < m_tv.size(); i++ )
+	{
+		wxAuiToolBar* toolbar = m_tv[i];
+		bool removed = false;
+		for ( int index = toolbar->GetToolCount() - 1; index >= 0; --index )
+		{
+			wxAuiToolBarItem* tool = toolbar->FindToolByIndex( index );
+			wxString name;
+			#ifdef __WXMAC__
+				wxWindow* button = tool->GetWindow();
+				if ( button && button->GetToolTip() )
+				{
+					name = button->GetToolTip()->GetTip();
+				}
+			#else
+				name = tool->GetShortHelp();
+			#endif
+			if ( name.empty() )
+			{
+				continue;
+			}
+
+			PObjectInfo info = database->GetObjectInfo( name );
+			if ( info && !info->HasComponent() )
+			{
+				LogDebug( wxT("Removing tool of class \"") + name + wxT("\" without component.") );
+				toolbar->DeleteByIndex( index );
+				removed = true;
+			}
+		}
+		if ( removed )
+		{
+			toolbar->Realize();
+			toolbar->Refresh();
+		}
+	}
+}
+
 void wxFbPalette::OnButtonClick( wxCommandEvent &event )
 {
+	wxString name;
 	#ifdef __WXMAC__
 		wxWindow* win = dynamic_cast< wxWindow* >( event.GetEventObject() );
 		if ( win != 0 )
 		{
-			AppData()->CreateObject( win->GetToolTip()->GetTip() );
+			name = win->GetToolTip()->GetTip();
 		}
 	#else
 		for ( unsigned int i = 0; i < m_tv.size(); i++ )
 		{
 			if ( m_tv[i]->GetToolIndex( event.GetId() ) != wxNOT_FOUND )
 			{
-				wxString name = m_tv[i]->GetToolShortHelp( event.GetId() );
-				AppData()->CreateObject( name );
-				return;
+				name = m_tv[i]->GetToolShortHelp( event.GetId() );
+				break;
 			}
 		}
 	#endif
+	if ( name.empty() )
+	{
+		return;
+	}
+
+	// The tools of a library are shown before it is imported, drop those it did not provide
+	PObjectInfo info = AppData()->GetObjectDatabase()->GetObjectInfo( name );
+	if ( info && !info->GetComponent() )
+	{
+		wxLogError( _("Missing Component for Class \"%s\"."), name );
+		RemoveMissingTools();
+		return;
+	}
+
+	AppData()->CreateObject( name );
 }
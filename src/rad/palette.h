@@ -37,12 +37,30 @@ typedef std::vector<wxAuiToolBar*> ToolbarVector;
 class wxFbPalette : public wxPanel
 {
  private:
+  // Tools of a page showing a placeholder until the page is opened
+  struct PendingIcons
+  {
+    wxAuiToolBar* toolbar;
+    std::vector< std::pair< int, PObjectInfo > > tools;
+  };
+
   ToolbarVector m_tv;
   wxAuiNotebook *m_notebook;
   static wxWindowID nextId;
   std::vector<int> m_posVector;
+  std::map< wxWindow*, PendingIcons > m_pendingIcons;
+
+  void PopulateToolbar(PObjectPackage pkg, wxAuiToolBar *toolbar, PendingIcons* pending);
 
-  void PopulateToolbar(PObjectPackage pkg, wxAuiToolBar *toolbar);
+  /**
+   * Decodes the icons of a page the first time it is shown.
+   */
+  void LoadPageIcons( wxWindow* page );
+
+  /**
+   * Removes the tools of the classes whose library did not provide them.
+   */
+  void RemoveMissingTools();
 
   DECLARE_EVENT_TABLE()
 
@@ -59,6 +77,7 @@ class wxFbPalette : public wxPanel
   void OnSpinUp(wxSpinEvent& e);
   void OnSpinDown(wxSpinEvent& e);
   void OnButtonClick(wxCommandEvent &event);
+  void OnPageChanged(wxAuiNotebookEvent& event);
 };
 /*
 class PaletteButton : public wxBitmapButton
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "perfpanel.h"
+
+#include "../../utils/profiler.h"
+
+#include <wx/button.h>
+#include <wx/checkbox.h>
+#include <wx/filedlg.h>
+#include <wx/listctrl.h>
+#include <wx/log.h>
+#include <wx/sizer.h>
+
+namespace
+{
+	wxString FormatMs( long long usec )
+	{
+		return wxString::Format( wxT("%.3f"), usec / 1000.0 );
+	}
+}
+
+PerformancePanel::PerformancePanel( wxWindow* parent, int id )
+:
+wxPanel( parent, id ),
+m_timer( this )
+{
+	wxBoxSizer* topSizer = new wxBoxSizer( wxVERTICAL );
+	wxBoxSizer* buttonSizer = new wxBoxSizer( wxHORIZONTAL );
+
+	m_record = new wxCheckBox( this, wxID_ANY, _("Record") );
+	m_record->SetValue( Profiler::IsEnabled() );
+	buttonSizer->Add( m_record, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5 );
+
+	wxButton* reset = new wxButton( this, wxID_ANY, _("Reset") );
+	buttonSizer->Add( reset, 0, wxALL, 5 );
+
+	wxButton* exportTrace = new wxButton( this, wxID_ANY, _("Export Trace...") );
+	buttonSizer->Add( exportTrace, 0, wxALL, 5 );
+
+	topSizer->Add( buttonSizer, 0, wxEXPAND, 0 );
+
+	m_list = new wxListCtrl( this, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxLC_SINGLE_SEL );
+	m_list->InsertColumn( 0, _("Scope"), wxLIST_FORMAT_LEFT, 220 );
+	m_list->InsertColumn( 1, _("Class"), wxLIST_FORMAT_LEFT, 160 );
+	m_list->InsertColumn( 2, _("Calls"), wxLIST_FORMAT_RIGHT, 70 );
+	m_list->InsertColumn( 3, _("Total (ms)"), wxLIST_FORMAT_RIGHT, 90 );
+	m_list->InsertColumn( 4, _("Average (ms)"), wxLIST_FORMAT_RIGHT, 90 );
+	m_list->InsertColumn( 5, _("Max (ms)"), wxLIST_FORMAT_RIGHT, 90 );
+	topSizer->Add( m_list, 1, wxEXPAND, 0 );
+
+	SetSizer( topSizer );
+
+	m_record->Connect( wxEVT_COMMAND_CHECKBOX_CLICKED, wxCommandEventHandler( PerformancePanel::OnRecord ), NULL, this );
+	reset->Connect( wxEVT_COMMAND_BUTTON_CLICKED, wxCommandEventHandler( PerformancePanel::OnReset ), NULL, this );
+	exportTrace->Connect( wxEVT_COMMAND_BUTTON_CLICKED, wxCommandEventHandler( PerformancePanel::OnExport ), NULL, this );
+	Connect( wxEVT_TIMER, wxTimerEventHandler( PerformancePanel::OnTimer ) );
+
+	// Refresh the statistics while the user works in the designer
+	m_timer.Start( 1000 );
+}
+
+PerformancePanel::~PerformancePanel()
+{
+	m_timer.Stop();
+	Disconnect( wxEVT_TIMER, wxTimerEventHandler( PerformancePanel::OnTimer ) );
+}
+
+void PerformancePanel::UpdateList()
+{
+	std::vector< Profiler::Stats > stats = Profiler::GetStats();
+
+	m_list->Freeze();
+	m_list->DeleteAllItems();
+	for ( size_t i = 0; i < stats.size(); ++i )
+	{
+		const Profiler::Stats& row = stats[i];
+		long item = m_list->InsertItem( i, row.name );
+		m_list->SetItem( item, 1, row.category );
+		m_list->SetItem( item, 2, wxString::Format( wxT("%lu"), row.count ) );
+		m_list->SetItem( item, 3, FormatMs( row.total ) );
+		m_list->SetItem( item, 4, FormatMs( row.total / (long long)row.count ) );
+		m_list->SetItem( item, 5, FormatMs( row.max ) );
+	}
+	m_list->Thaw();
+}
+
+void PerformancePanel::OnRecord( wxCommandEvent& )
+{
+	Profiler::Enable( m_record->GetValue() );
+}
+
+void PerformancePanel::OnReset( wxCommandEvent& )
+{
+	Profiler::Clear();
+	UpdateList();
+}
+
+void PerformancePanel::OnExport( wxCommandEvent& )
+{
+	wxFileDialog dialog( this, _("Export Chrome Trace"), wxEmptyString, wxT("wxfb_trace.json"),
+						 _("Trace files (*.json)|*.json"), wxFD_SAVE | wxFD_OVERWRITE_PROMPT );
+	if ( dialog.ShowModal() != wxID_OK )
+	{
+		return;
+	}
+
+	if ( !Profiler::ExportChromeTrace( dialog.GetPath() ) )
+	{
+		wxLogError( _("Could not write the trace to %s"), dialog.GetPath() );
+	}
+}
+
+void PerformancePanel::OnTimer( wxTimerEvent& )
+{
+	if ( Profiler::IsEnabled() && IsShownOnScreen() )
+	{
+		UpdateList();
+	}
+}
@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PERF_PANEL__
+#define __PERF_PANEL__
+
+#include <wx/panel.h>
+#include <wx/timer.h>
+
+class wxCheckBox;
+class wxListCtrl;
+
+/**
+ * Live view of the profiler statistics, one row per scope and component class.
+ */
+class PerformancePanel : public wxPanel
+{
+private:
+	wxCheckBox* m_record;
+	wxListCtrl* m_list;
+	wxTimer m_timer;
+
+	void UpdateList();
+
+	void OnRecord( wxCommandEvent& event );
+	void OnReset( wxCommandEvent& event );
+	void OnExport( wxCommandEvent& event );
+	void OnTimer( wxTimerEvent& event );
+
+public:
+	PerformancePanel( wxWindow* parent, int id );
+	~PerformancePanel() override;
+};
+
+#endif //__PERF_PANEL__
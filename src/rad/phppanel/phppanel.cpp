@@ -51,6 +51,7 @@ BEGIN_EVENT_TABLE ( PHPPanel,  wxPanel )
 	EVT_FB_OBJECT_CREATED( PHPPanel::OnObjectChange )
 	EVT_FB_OBJECT_REMOVED( PHPPanel::OnObjectChange )
 	EVT_FB_OBJECT_SELECTED( PHPPanel::OnObjectChange )
+	EVT_FB_CHANGE_SET( PHPPanel::OnChangeSet )
 	EVT_FB_EVENT_HANDLER_MODIFIED( PHPPanel::OnEventHandlerModified )
 
 	EVT_FIND( wxID_ANY, PHPPanel::OnFind )
@@ -162,6 +163,13 @@ void PHPPanel::OnEventHandlerModified( wxFBEventHandlerEvent& event )
 	OnCodeGeneration( event );
 }
 
+void PHPPanel::OnChangeSet( wxFBChangeSetEvent& event )
+{
+	// Generate code to the panel only, once for the whole change set
+	event.SetId( 1 );
+	OnCodeGeneration( event );
+}
+
 void PHPPanel::OnCodeGeneration( wxFBEvent& event )
 {
     PObjectBase objectToGenerate;
@@ -51,6 +51,7 @@ class wxFindDialogEvent;
 class wxFBEvent;
 class wxFBPropertyEvent;
 class wxFBObjectEvent;
+class wxFBChangeSetEvent;
 class wxFBEventHandlerEvent;
 
 class PHPPanel : public wxPanel
@@ -69,6 +70,7 @@ public:
 	void OnProjectRefresh( wxFBEvent& event );
 	void OnCodeGeneration( wxFBEvent& event );
 	void OnObjectChange( wxFBObjectEvent& event );
+	void OnChangeSet( wxFBChangeSetEvent& event );
 	void OnEventHandlerModified( wxFBEventHandlerEvent& event );
 
 	void OnFind( wxFindDialogEvent& event );
@@ -51,6 +51,7 @@ BEGIN_EVENT_TABLE ( PythonPanel,  wxPanel )
 	EVT_FB_OBJECT_CREATED( PythonPanel::OnObjectChange )
 	EVT_FB_OBJECT_REMOVED( PythonPanel::OnObjectChange )
 	EVT_FB_OBJECT_SELECTED( PythonPanel::OnObjectChange )
+	EVT_FB_CHANGE_SET( PythonPanel::OnChangeSet )
 	EVT_FB_EVENT_HANDLER_MODIFIED( PythonPanel::OnEventHandlerModified )
 
 	EVT_FIND( wxID_ANY, PythonPanel::OnFind )
@@ -155,6 +156,13 @@ void PythonPanel::OnEventHandlerModified( wxFBEventHandlerEvent& event )
 	OnCodeGeneration( event );
 }
 
+void PythonPanel::OnChangeSet( wxFBChangeSetEvent& event )
+{
+	// Generate code to the panel only, once for the whole change set
+	event.SetId( 1 );
+	OnCodeGeneration( event );
+}
+
 void PythonPanel::OnCodeGeneration( wxFBEvent& event )
 {
     PObjectBase objectToGenerate;
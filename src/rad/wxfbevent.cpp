@@ -35,6 +35,7 @@ DEFINE_EVENT_TYPE( wxEVT_FB_PROPERTY_MODIFIED )
 DEFINE_EVENT_TYPE( wxEVT_FB_PROJECT_REFRESH )
 DEFINE_EVENT_TYPE( wxEVT_FB_CODE_GENERATION )
 DEFINE_EVENT_TYPE( wxEVT_FB_EVENT_HANDLER_MODIFIED )
+DEFINE_EVENT_TYPE( wxEVT_FB_CHANGE_SET )
 
 wxFBEvent::wxFBEvent( wxEventType commandType )
 :
@@ -79,6 +80,7 @@ wxString wxFBEvent::GetEventName()
 	CASE( wxEVT_FB_EVENT_HANDLER_MODIFIED )
 	CASE( wxEVT_FB_PROJECT_REFRESH )
 	CASE( wxEVT_FB_CODE_GENERATION )
+	CASE( wxEVT_FB_CHANGE_SET )
 
 	return wxT( "Unknown Type" );
 }
@@ -143,3 +145,57 @@ wxEvent* wxFBEventHandlerEvent::Clone() const
 {
 	return new wxFBEventHandlerEvent( *this );
 }
+
+wxFBChangeSetEvent::wxFBChangeSetEvent( wxEventType commandType )
+:
+wxFBEvent( commandType ),
+m_structureChanged( false )
+{
+}
+
+wxFBChangeSetEvent::wxFBChangeSetEvent( const wxFBChangeSetEvent& event )
+:
+wxFBEvent( event ),
+m_objects( event.m_objects ),
+m_properties( event.m_properties ),
+m_events( event.m_events ),
+m_structureChanged( event.m_structureChanged ),
+m_objectSet( event.m_objectSet ),
+m_propertySet( event.m_propertySet ),
+m_eventSet( event.m_eventSet )
+{
+}
+
+wxEvent* wxFBChangeSetEvent::Clone() const
+{
+	return new wxFBChangeSetEvent( *this );
+}
+
+void wxFBChangeSetEvent::AddFBObject( PObjectBase object )
+{
+	if ( object && m_objectSet.insert( object.get() ).second )
+	{
+		m_objects.push_back( object );
+	}
+}
+
+void wxFBChangeSetEvent::AddFBProperty( PProperty property )
+{
+	if ( property && m_propertySet.insert( property.get() ).second )
+	{
+		m_properties.push_back( property );
+	}
+}
+
+void wxFBChangeSetEvent::AddFBEventHandler( PEvent event )
+{
+	if ( event && m_eventSet.insert( event.get() ).second )
+	{
+		m_events.push_back( event );
+	}
+}
+
+bool wxFBChangeSetEvent::IsEmpty() const
+{
+	return !m_structureChanged && m_objects.empty() && m_properties.empty() && m_events.empty();
+}
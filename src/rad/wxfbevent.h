@@ -30,6 +30,8 @@
 
 #include <wx/event.h>
 
+#include <set>
+
 class wxFBEvent : public wxEvent
 {
 	private:
@@ -83,11 +85,49 @@ private:
   PObjectBase m_object;
 };
 
+/**
+ * Consolidated notification sent when an ApplicationData transaction is
+ * committed. It carries every object, property and event handler touched
+ * while the transaction was open, so handlers can refresh once.
+ */
+class wxFBChangeSetEvent : public wxFBEvent
+{
+public:
+  wxFBChangeSetEvent( wxEventType commandType = wxEVT_NULL );
+  wxFBChangeSetEvent( const wxFBChangeSetEvent& event );
+	wxEvent* Clone() const override;
+
+  void AddFBObject( PObjectBase object );
+  void AddFBProperty( PProperty property );
+  void AddFBEventHandler( PEvent event );
+  void SetStructureChanged( bool changed = true ) { m_structureChanged = changed; }
+
+  const ObjectBaseVector& GetFBObjects() const { return m_objects; }
+  const std::vector< PProperty >& GetFBProperties() const { return m_properties; }
+  const EventVector& GetFBEventHandlers() const { return m_events; }
+
+  /** True if objects were created, removed or moved, i.e. the tree must be rebuilt */
+  bool IsStructureChanged() const { return m_structureChanged; }
+  bool IsEmpty() const;
+
+private:
+  ObjectBaseVector m_objects;
+  std::vector< PProperty > m_properties;
+  EventVector m_events;
+  bool m_structureChanged;
+
+  // What is already in the vectors above, which keep the order of the notifications
+  std::set< ObjectBase* > m_objectSet;
+  std::set< Property* > m_propertySet;
+  std::set< Event* > m_eventSet;
+};
+
 
 typedef void (wxEvtHandler::*wxFBEventFunction)        (wxFBEvent&);
 typedef void (wxEvtHandler::*wxFBPropertyEventFunction)(wxFBPropertyEvent&);
 typedef void (wxEvtHandler::*wxFBObjectEventFunction)  (wxFBObjectEvent&);
 typedef void (wxEvtHandler::*wxFBEventHandlerEventFunction)  (wxFBEventHandlerEvent&);
+typedef void (wxEvtHandler::*wxFBChangeSetEventFunction)  (wxFBChangeSetEvent&);
 
 #define wxFBEventHandler(fn) \
   (wxObjectEventFunction)(wxEventFunction)wxStaticCastEvent(wxFBEventFunction, &fn)
@@ -101,6 +141,9 @@ typedef void (wxEvtHandler::*wxFBEventHandlerEventFunction)  (wxFBEventHandlerEv
 #define wxFBEventEventHandler(fn) \
   (wxObjectEventFunction)(wxEventFunction)wxStaticCastEvent(wxFBEventHandlerEventFunction, &fn)
 
+#define wxFBChangeSetEventHandler(fn) \
+  (wxObjectEventFunction)(wxEventFunction)wxStaticCastEvent(wxFBChangeSetEventFunction, &fn)
+
 
 BEGIN_DECLARE_EVENT_TYPES()
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_PROJECT_LOADED,    -1 )
@@ -113,6 +156,7 @@ BEGIN_DECLARE_EVENT_TYPES()
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_PROJECT_REFRESH,   -1 )
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_CODE_GENERATION,   -1 )
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_EVENT_HANDLER_MODIFIED, -1 )
+  DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_CHANGE_SET,        -1 )
 END_DECLARE_EVENT_TYPES()
 
 #define EVT_FB_PROJECT_LOADED(fn) \
@@ -145,4 +189,7 @@ END_DECLARE_EVENT_TYPES()
 #define EVT_FB_CODE_GENERATION(fn) \
     wx__DECLARE_EVT0(wxEVT_FB_CODE_GENERATION,wxFBEventHandler(fn))
 
+#define EVT_FB_CHANGE_SET(fn) \
+  wx__DECLARE_EVT0(wxEVT_FB_CHANGE_SET,wxFBChangeSetEventHandler(fn))
+
 #endif // __WXFBEVENT__
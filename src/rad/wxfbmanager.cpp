@@ -183,6 +183,12 @@ void wxFBManager::ModifyProperty( wxObject* wxobject, wxString property, wxStrin
 	{
 		prop->SetValue( value );
 	}
+
+	// Books report the page shown in the designer this way, it may not be built yet
+	if ( wxT("select") == property && wxT("1") == value )
+	{
+		m_visualEdit->ExpandDeferredPages( obj );
+	}
 }
 
 bool wxFBManager::SelectObject( wxObject* wxobject )
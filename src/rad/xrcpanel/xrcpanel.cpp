@@ -29,6 +29,8 @@
 
 #include "../../codegen/codewriter.h"
 #include "../../codegen/xrccg.h"
+#include "../../codegen/xrcloadercg.h"
+#include "../../codegen/xrsarchive.h"
 
 #include "../../model/objectbase.h"
 #include "../../utils/typeconv.h"
@@ -48,6 +50,7 @@ BEGIN_EVENT_TABLE( XrcPanel,  wxPanel )
 	EVT_FB_OBJECT_CREATED( XrcPanel::OnObjectChange )
 	EVT_FB_OBJECT_REMOVED( XrcPanel::OnObjectChange )
 	EVT_FB_OBJECT_SELECTED( XrcPanel::OnObjectChange )
+	EVT_FB_CHANGE_SET( XrcPanel::OnChangeSet )
 
 	EVT_FIND( wxID_ANY, XrcPanel::OnFind )
 	EVT_FIND_NEXT( wxID_ANY, XrcPanel::OnFind )
@@ -147,6 +150,13 @@ void XrcPanel::OnObjectChange( wxFBObjectEvent& event )
 	OnCodeGeneration( event );
 }
 
+void XrcPanel::OnChangeSet( wxFBChangeSetEvent& event )
+{
+	// Generate code to the panel only, once for the whole change set
+	event.SetId( 1 );
+	OnCodeGeneration( event );
+}
+
 void XrcPanel::OnCodeGeneration( wxFBEvent& event )
 {
     PObjectBase project;
@@ -235,13 +245,35 @@ void XrcPanel::OnCodeGeneration( wxFBEvent& event )
 				file = wxT( "noname" );
 			}
 
-			wxString filePath;
+			if ( project->GetPropertyAsString( wxT( "xrc_format" ) ) == wxT( "xrs" ) )
+			{
+				XrsArchive archive( AppData()->GetProjectPath() );
+				PStringCodeWriter cw( new StringCodeWriter );
 
-			filePath << path << file << wxT( ".xrc" );
-			PCodeWriter cw( new FileCodeWriter( filePath ) );
+				codegen.SetWriter( cw );
+				codegen.SetCompact( true );
+				codegen.SetArchive( &archive );
+				codegen.GenerateCode( project );
 
-			codegen.SetWriter( cw );
-			codegen.GenerateCode( project );
+				archive.Write( path + file + wxT( ".xrs" ), file + wxT( ".xrc" ), cw->GetString() );
+			}
+			else if ( project->GetPropertyAsString( wxT( "xrc_format" ) ) == wxT( "cpp" ) )
+			{
+				XrcLoaderCodeGenerator loader;
+				loader.SetHeaderWriter( PCodeWriter( new FileCodeWriter( path + file + wxT( "_xrc.h" ) ) ) );
+				loader.SetSourceWriter( PCodeWriter( new FileCodeWriter( path + file + wxT( "_xrc.cpp" ) ) ) );
+				loader.GenerateCode( project );
+			}
+			else
+			{
+				wxString filePath;
+
+				filePath << path << file << wxT( ".xrc" );
+				PCodeWriter cw( new FileCodeWriter( filePath ) );
+
+				codegen.SetWriter( cw );
+				codegen.GenerateCode( project );
+			}
 			wxLogStatus( wxT( "Code generated on \'%s\'." ), path.c_str() );
 		}
 		catch ( wxFBException& ex )
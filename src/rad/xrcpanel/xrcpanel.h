@@ -34,6 +34,7 @@
 class CodeEditor;
 class wxFBEvent;
 class wxFBObjectEvent;
+class wxFBChangeSetEvent;
 class wxFBPropertyEvent;
 class wxFindDialogEvent;
 
@@ -53,6 +54,7 @@ public:
 	void OnProjectRefresh( wxFBEvent& event );
 	void OnCodeGeneration( wxFBEvent& event );
 	void OnObjectChange( wxFBObjectEvent& event );
+	void OnChangeSet( wxFBChangeSetEvent& event );
 
 	void OnFind( wxFindDialogEvent& event );
 
@@ -27,15 +27,64 @@
 #include "../../codegen/xrccg.h"
 #include "../../model/objectbase.h"
 #include "../../utils/annoyingdialog.h"
-#include "../../utils/typeconv.h"
 #include "../../utils/wxfbexception.h"
 
-#include <wx/fs_mem.h>
 #include <wx/wizard.h>
 #include <wx/xrc/xmlres.h>
 
+#if wxCHECK_VERSION( 3, 1, 0 )
+	#include <wx/mstream.h>
+	#include <wx/xml/xml.h>
+#else
+	#include <wx/fs_mem.h>
+#endif
+
+#if wxVERSION_NUMBER >= 2905 && wxVERSION_NUMBER <= 3100
+#include <wx/xrc/xh_auinotbk.h>
+#elif wxVERSION_NUMBER > 3100
+#include <wx/xrc/xh_aui.h>
+#endif
+
+#include <map>
+#include <memory>
+
 #define MENU_DELETE 109
 
+namespace
+{
+	wxXmlResource* s_resource = NULL;
+
+	struct LoadedForm
+	{
+		std::weak_ptr< ObjectBase > form;
+		wxString xrc;
+	};
+
+	// Forms loaded in s_resource, by the name they had when they were loaded
+	std::map< wxString, LoadedForm > s_loadedForms;
+
+	// Name of the document of a form in s_resource
+	wxString GetDocumentName( const wxString& name )
+	{
+	#if wxCHECK_VERSION( 3, 1, 0 )
+		return wxT("xrcpreview_") + name;
+	#else
+		// wxXmlResource::LoadDocument is not available, the XRC is loaded through the memory file system
+		return wxT("xrcpreview_") + name + wxT(".xrc");
+	#endif
+	}
+
+	void UnloadDocument( const wxString& name )
+	{
+	#if wxCHECK_VERSION( 3, 1, 0 )
+		s_resource->Unload( GetDocumentName( name ) );
+	#else
+		s_resource->Unload( wxT("memory:") + GetDocumentName( name ) );
+		wxMemoryFSHandler::RemoveFile( GetDocumentName( name ) );
+	#endif
+	}
+}
+
 class XrcPreviewPopupMenu : public wxMenu
 {
 	DECLARE_EVENT_TABLE()
@@ -161,21 +210,22 @@ void XRCPreview::Show( PObjectBase form, const wxString& projectPath )
 		return;
 	}
 
+	wxString name = form->GetPropertyAsString( wxT( "name" ) );
+	if ( !LoadForm( form, cw->GetString() ) )
+	{
+		return;
+	}
+
 	wxString workingDir = ::wxGetCwd();
 	// We change the current directory so that the relative paths work properly
 	if( !projectPath.IsEmpty() ) ::wxSetWorkingDirectory( projectPath );
-	wxXmlResource *res = wxXmlResource::Get();
-	res->InitAllHandlers();
-
-	const std::string& data = _STDSTR( cw->GetString() );
-	wxMemoryFSHandler::AddFile(wxT("xrcpreview.xrc"), data.c_str(), data.size() );
-	res->Load( wxT("memory:xrcpreview.xrc") );
+	wxXmlResource *res = GetResource();
 
 	wxWindow* window = NULL;
 	if ( className == wxT( "Frame" ) )
 	{
 		wxFrame* frame = new wxFrame();
-		res->LoadFrame( frame, wxTheApp->GetTopWindow(), form->GetPropertyAsString( wxT( "name" ) ) );
+		res->LoadFrame( frame, wxTheApp->GetTopWindow(), name );
 		// Prevent events from propagating up to wxFB's frame
 		frame->SetExtraStyle( frame->GetExtraStyle() | wxWS_EX_BLOCK_EVENTS );
 		frame->Show();
@@ -184,7 +234,7 @@ void XRCPreview::Show( PObjectBase form, const wxString& projectPath )
 	else if ( className == wxT( "Dialog" ) )
 	{
 		wxDialog* dialog = new wxDialog;
-		res->LoadDialog( dialog, wxTheApp->GetTopWindow(), form->GetPropertyAsString( wxT( "name" ) ) );
+		res->LoadDialog( dialog, wxTheApp->GetTopWindow(), name );
 		// Prevent events from propagating up to wxFB's frame
 		dialog->SetExtraStyle( dialog->GetExtraStyle() | wxWS_EX_BLOCK_EVENTS );
 		dialog->Show();
@@ -192,7 +242,7 @@ void XRCPreview::Show( PObjectBase form, const wxString& projectPath )
 	}
 	else if ( className == wxT("Wizard") )
 	{
-        wxString            wizName = form->GetPropertyAsString( wxT("name") );
+        wxString            wizName = name;
         wxString            pgName;
         wxObject           *wizObj  = res->LoadObject( NULL, wizName, wxT("wxWizard") );
         wxWizard           *wizard  = wxDynamicCast( wizObj, wxWizard );
@@ -223,7 +273,7 @@ void XRCPreview::Show( PObjectBase form, const wxString& projectPath )
 		// Prevent events from propagating up to wxFB's frame
 		dialog->SetExtraStyle( wxWS_EX_BLOCK_EVENTS );
 		wxPanel *panel = new wxPanel();
-		res->LoadPanel( panel, dialog, form->GetPropertyAsString( wxT( "name" ) ) );
+		res->LoadPanel( panel, dialog, name );
 		dialog->SetClientSize( panel->GetSize() );
 		dialog->SetSize( form->GetPropertyAsSize( wxT( "size" ) ) );
 		dialog->CenterOnScreen();
@@ -232,20 +282,20 @@ void XRCPreview::Show( PObjectBase form, const wxString& projectPath )
 	}
 	else if ( className == wxT( "MenuBar" ) )
 	{
-		wxFrame* frame = new wxFrame( NULL, wxID_ANY, form->GetPropertyAsString( wxT( "name" ) ) );
+		wxFrame* frame = new wxFrame( NULL, wxID_ANY, name );
 		// Prevent events from propagating up to wxFB's frame
 		frame->SetExtraStyle( frame->GetExtraStyle() | wxWS_EX_BLOCK_EVENTS );
-		frame->SetMenuBar( res->LoadMenuBar( form->GetPropertyAsString( wxT( "name" ) ) ) );
+		frame->SetMenuBar( res->LoadMenuBar( name ) );
 		frame->CenterOnScreen();
 		frame->Show();
 		window = frame;
 	}
 	else if ( className == wxT( "ToolBar" ) )
 	{
-		wxFrame* frame = new wxFrame( NULL, wxID_ANY, form->GetPropertyAsString( wxT( "name" ) ) );
+		wxFrame* frame = new wxFrame( NULL, wxID_ANY, name );
 		// Prevent events from propagating up to wxFB's frame
 		frame->SetExtraStyle( frame->GetExtraStyle() | wxWS_EX_BLOCK_EVENTS );
-		frame->SetToolBar( res->LoadToolBar( frame, form->GetPropertyAsString( wxT( "name" ) ) ) );
+		frame->SetToolBar( res->LoadToolBar( frame, name ) );
 		frame->CenterOnScreen();
 		frame->Show();
 		window = frame;
@@ -257,10 +307,104 @@ void XRCPreview::Show( PObjectBase form, const wxString& projectPath )
 	}
 
 	::wxSetWorkingDirectory( workingDir );
+}
+
+wxXmlResource* XRCPreview::GetResource()
+{
+	if ( !s_resource )
+	{
+		s_resource = new wxXmlResource;
+		s_resource->InitAllHandlers();
+	#if wxVERSION_NUMBER >= 2905 && wxVERSION_NUMBER <= 3100
+		s_resource->AddHandler( new wxAuiNotebookXmlHandler );
+	#elif wxVERSION_NUMBER > 3100
+		s_resource->AddHandler( new wxAuiXmlHandler );
+	#endif
+	}
+	return s_resource;
+}
+
+bool XRCPreview::LoadForm( PObjectBase form, const wxString& xrc )
+{
+	wxString name = form->GetPropertyAsString( wxT("name") );
+	wxXmlResource* resource = GetResource();
 
-	res->Unload( wxT("memory:xrcpreview.xrc") );
+	// Forms renamed, removed or replaced by another form of the same name since they were loaded
+	std::map< wxString, LoadedForm >::iterator loaded = s_loadedForms.begin();
+	while ( loaded != s_loadedForms.end() )
+	{
+		PObjectBase loadedForm = loaded->second.form.lock();
+		if ( !loadedForm || !loadedForm->GetParent() || loadedForm->GetPropertyAsString( wxT("name") ) != loaded->first ||
+			( loaded->first == name && loadedForm != form ) )
+		{
+			UnloadDocument( loaded->first );
+			s_loadedForms.erase( loaded++ );
+		}
+		else
+		{
+			++loaded;
+		}
+	}
+
+	// Only the form previewed is reloaded, and only when its XRC changed
+	loaded = s_loadedForms.find( name );
+	if ( loaded != s_loadedForms.end() )
+	{
+		if ( loaded->second.xrc == xrc )
+		{
+			return true;
+		}
+
+		UnloadDocument( name );
+		s_loadedForms.erase( loaded );
+	}
+
+	const wxScopedCharBuffer data = xrc.utf8_str();
+
+#if wxCHECK_VERSION( 3, 1, 0 )
+	wxMemoryInputStream stream( data.data(), data.length() );
+	std::unique_ptr< wxXmlDocument > doc( new wxXmlDocument );
+	if ( !doc->Load( stream ) )
+	{
+		wxLogError( _("The XRC generated for \"%s\" is not valid XML"), name );
+		return false;
+	}
+
+	// The resource owns the document from now on
+	if ( !resource->LoadDocument( doc.release(), GetDocumentName( name ) ) )
+	{
+		wxLogError( _("Unable to load the XRC generated for \"%s\""), name );
+		return false;
+	}
+#else
+	wxMemoryFSHandler::AddFile( GetDocumentName( name ), data.data(), data.length() );
+	if ( !resource->Load( wxT("memory:") + GetDocumentName( name ) ) )
+	{
+		wxMemoryFSHandler::RemoveFile( GetDocumentName( name ) );
+		wxLogError( _("Unable to load the XRC generated for \"%s\""), name );
+		return false;
+	}
+#endif
+
+	LoadedForm& entry = s_loadedForms[ name ];
+	entry.form = form;
+	entry.xrc = xrc;
+	return true;
+}
+
+void XRCPreview::Destroy()
+{
+#if !wxCHECK_VERSION( 3, 1, 0 )
+	std::map< wxString, LoadedForm >::const_iterator loaded;
+	for ( loaded = s_loadedForms.begin(); loaded != s_loadedForms.end(); ++loaded )
+	{
+		wxMemoryFSHandler::RemoveFile( GetDocumentName( loaded->first ) );
+	}
+#endif
 
-	wxMemoryFSHandler::RemoveFile( wxT("xrcpreview.xrc") );
+	delete s_resource;
+	s_resource = NULL;
+	s_loadedForms.clear();
 }
 
 void XRCPreview::AddEventHandler( wxWindow* window, wxWindow* form )
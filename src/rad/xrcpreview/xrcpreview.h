@@ -26,11 +26,25 @@
 #include "../../utils/wxfbdefs.h"
 
 class wxWindow;
+class wxXmlResource;
 
 class XRCPreview
 {
 private:
 	static void AddEventHandler( wxWindow* window, wxWindow* form );
+
+	/// Resource of the previews, kept apart from the one of wxFormBuilder. Its handlers are created once.
+	static wxXmlResource* GetResource();
+
+	/**
+	 * Loads the XRC of the form in the preview resource, unless it is the same as the one already loaded.
+	 * The documents of forms renamed or removed since they were loaded are unloaded.
+	 */
+	static bool LoadForm( PObjectBase form, const wxString& xrc );
+
 public:
 	static void Show( PObjectBase form, const wxString& projectpath );
+
+	/// Destroys the preview resource and the forms loaded in it.
+	static void Destroy();
 };
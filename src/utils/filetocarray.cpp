@@ -2,14 +2,22 @@
 
 #include "../rad/appdata.h"
 #include "../model/objectbase.h"
-#include "../codegen/codewriter.h"
 #include "../codegen/cppcg.h"
+#include "../codegen/manifest.h"
+#include "../md5/md5.hh"
+#include "../rad/mainframe.h"
 #include "typeconv.h"
 #include "wxfbexception.h"
 
+#include <wx/file.h>
 #include <wx/filename.h>
 
-#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <set>
+#include <string>
+#include <thread>
 
 #define CASE_BITMAP_TYPE( x )	\
 	case x:						\
@@ -56,19 +64,396 @@ wxString GetBitmapType( const wxFileName& sourceFileName )
 	}
 }
 
-wxString FileToCArray::Generate( const wxString& sourcePath )
+namespace
 {
-	wxFileName sourceFileName( sourcePath );
+	const size_t BYTES_PER_LINE = 10;
+	const size_t STRING_LINE_LENGTH = 100;
+	const size_t ARCHIVE_ALIGNMENT = 16;
+
+	const unsigned char MICROSOFT_BOM[3] = { 0xEF, 0xBB, 0xBF };
+
+	/// Value of the project property "embedded_files_format"
+	enum EmbedFormat
+	{
+		EMBED_ARRAY,	// unsigned char array of hex bytes
+		EMBED_STRING,	// string literal with octal escapes
+		EMBED_INCBIN,	// assembler stub including the file, the header only declares it
+		EMBED_ARCHIVE	// all files of the project packed into one blob with an offset index
+	};
+
+	// The text "0xNN, " of every byte value, so encoding is a copy per byte
+	struct HexTable
+	{
+		char entries[256][6];
+
+		HexTable()
+		{
+			static const char digits[] = "0123456789ABCDEF";
+			for ( int i = 0; i < 256; ++i )
+			{
+				char* entry = entries[i];
+				entry[0] = '0';
+				entry[1] = 'x';
+				entry[2] = digits[ i >> 4 ];
+				entry[3] = digits[ i & 0x0F ];
+				entry[4] = ',';
+				entry[5] = ' ';
+			}
+		}
+	};
+
+	const HexTable s_hexTable;
+
+	// Every byte as it appears inside a string literal, printable characters as is and the rest as octal escapes.
+	// Octal escapes are always three digits so a following digit can never extend them, '?' is escaped to avoid trigraphs
+	struct StringTable
+	{
+		char entries[256][4];
+		unsigned char lengths[256];
+
+		StringTable()
+		{
+			for ( int i = 0; i < 256; ++i )
+			{
+				char* entry = entries[i];
+				if ( i >= 0x20 && i < 0x7F && i != '"' && i != '\\' && i != '?' )
+				{
+					entry[0] = static_cast< char >( i );
+					lengths[i] = 1;
+				}
+				else
+				{
+					entry[0] = '\\';
+					entry[1] = static_cast< char >( '0' + ( ( i >> 6 ) & 7 ) );
+					entry[2] = static_cast< char >( '0' + ( ( i >> 3 ) & 7 ) );
+					entry[3] = static_cast< char >( '0' + ( i & 7 ) );
+					lengths[i] = 4;
+				}
+			}
+		}
+	};
+
+	const StringTable s_stringTable;
+
+	/// Everything a worker thread needs to write one header, prepared on the main thread
+	struct EmbedJob
+	{
+		wxString sourcePath;
+		wxString targetPath;
+		EmbedFormat format;
+		std::string stampPrefix;
+		// Version and output options the header depends on besides its head and tail
+		std::string generator;
+		std::string head;
+		std::string tail;
+		bool useMicrosoftBOM;
+		// Archive entries are written on the main thread once all files are read
+		wxString arrayName;
+		wxString bitmapType;
+		std::vector< unsigned char > data;
+		bool readFailed;
+		bool writeFailed;
+	};
+
+	bool ReadBinaryFile( const wxString& path, std::vector< unsigned char >& data )
+	{
+		wxFile file;
+		if ( !file.Open( path ) )
+		{
+			return false;
+		}
+
+		wxFileOffset length = file.Length();
+		if ( length < 0 )
+		{
+			return false;
+		}
+
+		data.resize( static_cast< size_t >( length ) );
+		return data.empty() || file.Read( &data[0], data.size() ) == static_cast< ssize_t >( data.size() );
+	}
+
+	/// Writes content unless the file already holds exactly that
+	bool WriteIfChanged( const wxString& path, const std::string& content )
+	{
+		GenerationManifest::AddOutput( path );
+
+		if ( wxFileExists( path ) && wxFileName::GetSize( path ) == wxULongLong( content.size() ) )
+		{
+			std::vector< unsigned char > current;
+			if ( ReadBinaryFile( path, current ) && ( content.empty() || 0 == std::memcmp( &current[0], content.data(), content.size() ) ) )
+			{
+				return true;
+			}
+		}
+
+		wxFile file;
+		return file.Create( path, true ) && file.Write( content.data(), content.size() ) == content.size();
+	}
+
+	/// Returns the first line of an existing header, which holds the stamp of the file it was generated from
+	std::string ReadStamp( const wxString& path, bool useMicrosoftBOM )
+	{
+		wxFile file;
+		if ( !wxFileExists( path ) || !file.Open( path ) )
+		{
+			return std::string();
+		}
+
+		char buffer[1024];
+		ssize_t count = file.Read( buffer, sizeof( buffer ) );
+		if ( count <= 0 )
+		{
+			return std::string();
+		}
+
+		std::string text( buffer, static_cast< size_t >( count ) );
+		size_t start = 0;
+		if ( useMicrosoftBOM )
+		{
+			if ( 0 != text.compare( 0, 3, reinterpret_cast< const char* >( MICROSOFT_BOM ), 3 ) )
+			{
+				return std::string();
+			}
+			start = 3;
+		}
+
+		size_t end = text.find( '\n', start );
+		return ( end == std::string::npos ? std::string() : text.substr( start, end - start ) );
+	}
+
+	bool StartsWith( const std::string& text, const std::string& prefix )
+	{
+		return 0 == text.compare( 0, prefix.size(), prefix );
+	}
+
+	bool EndsWith( const std::string& text, const std::string& suffix )
+	{
+		return text.size() >= suffix.size() && 0 == text.compare( text.size() - suffix.size(), suffix.size(), suffix );
+	}
+
+	void EncodeArray( const std::vector< unsigned char >& data, std::string& out )
+	{
+		for ( size_t offset = 0; offset < data.size(); offset += BYTES_PER_LINE )
+		{
+			const size_t end = std::min( offset + BYTES_PER_LINE, data.size() );
+			out += '\t';
+			for ( size_t i = offset; i < end; ++i )
+			{
+				out.append( s_hexTable.entries[ data[i] ], 6 );
+			}
+			// Replace the trailing space of the last entry
+			out.back() = '\n';
+		}
+	}
+
+	void EncodeString( const std::vector< unsigned char >& data, std::string& out )
+	{
+		if ( data.empty() )
+		{
+			out += "\t\"\"\n";
+			return;
+		}
+
+		size_t lineStart = out.size();
+		out += "\t\"";
+		for ( size_t i = 0; i < data.size(); ++i )
+		{
+			if ( out.size() - lineStart >= STRING_LINE_LENGTH )
+			{
+				out += "\"\n";
+				lineStart = out.size();
+				out += "\t\"";
+			}
+			out.append( s_stringTable.entries[ data[i] ], s_stringTable.lengths[ data[i] ] );
+		}
+		out += "\"\n";
+	}
+
+	void Encode( EmbedJob& job )
+	{
+		if ( EMBED_ARCHIVE == job.format )
+		{
+			job.readFailed = !ReadBinaryFile( job.sourcePath, job.data );
+			return;
+		}
+
+		wxULongLong size = wxFileName::GetSize( job.sourcePath );
+		if ( size == wxInvalidSize )
+		{
+			job.readFailed = true;
+			return;
+		}
+
+		// Everything but the data of the source, a new version or template rewrites the header
+		const std::string layout = job.generator + '\n' + job.head + '\n' + job.tail;
+		MD5 layoutMd5( reinterpret_cast< const unsigned char* >( layout.data() ), static_cast< uint32_t >( layout.size() ) );
+		char* layoutDigest = layoutMd5.hex_digest();
+		const std::string templateStamp = " template=" + std::string( layoutDigest );
+		delete [] layoutDigest;
+
+		// The stamp holds no time, so the header of the same source is the same on every machine
+		const std::string sizeStamp = job.stampPrefix + " size=" + std::to_string( size.GetValue() ) + " md5=";
+		const std::string stamp = ReadStamp( job.targetPath, job.useMicrosoftBOM );
+		const bool sameLayout = StartsWith( stamp, sizeStamp ) && EndsWith( stamp, templateStamp );
+
+		// Header generated the same way after the last change of its source, nothing to do
+		if ( sameLayout && wxFileModificationTime( job.targetPath ) >= wxFileModificationTime( job.sourcePath ) )
+		{
+			return;
+		}
+
+		std::vector< unsigned char > data;
+		if ( !ReadBinaryFile( job.sourcePath, data ) )
+		{
+			job.readFailed = true;
+			return;
+		}
+
+		const unsigned char empty = 0;
+		MD5 md5( data.empty() ? &empty : &data[0], static_cast< uint32_t >( data.size() ) );
+		char* digest = md5.hex_digest();
+		const std::string hash( digest );
+		delete [] digest;
+
+		// Touched but identical source (e.g. a fresh checkout), the header is still current,
+		// only its time is updated so the next generation does not read the source again
+		const std::string newStamp = sizeStamp + hash + templateStamp;
+		if ( sameLayout && stamp == newStamp )
+		{
+			wxFileName( job.targetPath ).Touch();
+			return;
+		}
+
+		const size_t lines = ( data.size() + BYTES_PER_LINE - 1 ) / BYTES_PER_LINE;
+		std::string out;
+		out.reserve( sizeof( MICROSOFT_BOM ) + newStamp.size() + 1 + job.head.size() + data.size() * 6 + lines * 2 + job.tail.size() );
+
+		if ( job.useMicrosoftBOM )
+		{
+			out.append( reinterpret_cast< const char* >( MICROSOFT_BOM ), sizeof( MICROSOFT_BOM ) );
+		}
+		out += newStamp;
+		out += '\n';
+		out += job.head;
 
-	const wxString& sourceFullName = sourceFileName.GetFullName();
-	const wxString targetFullName = sourceFullName + wxT(".h");
-	wxString arrayName = CppCodeGenerator::ConvertEmbeddedBitmapName( sourcePath );
+		if ( EMBED_STRING == job.format )
+		{
+			EncodeString( data, out );
+		}
+		else
+		{
+			EncodeArray( data, out );
+		}
+
+		out += job.tail;
+
+		wxFile file;
+		if ( !file.Create( job.targetPath, true ) || file.Write( out.data(), out.size() ) != out.size() )
+		{
+			job.writeFailed = true;
+		}
+	}
+
+	EmbedFormat GetEmbedFormat( PObjectBase project )
+	{
+		PProperty pFormat = project->GetProperty( wxT("embedded_files_format") );
+		wxString format = ( pFormat ? pFormat->GetValueAsString() : wxString() );
+		if ( format == wxT("string") )
+		{
+			return EMBED_STRING;
+		}
+		else if ( format == wxT("incbin") )
+		{
+			return EMBED_INCBIN;
+		}
+		else if ( format == wxT("archive") )
+		{
+			return EMBED_ARCHIVE;
+		}
+		return EMBED_ARRAY;
+	}
+
+	wxString GetHeaderIncludes()
+	{
+		return wxT("#include <wx/mstream.h>\n#include <wx/image.h>\n#include <wx/bitmap.h>\n");
+	}
+
+	wxString GetBitmapAccessor( const wxString& arrayName, const wxString& data, const wxString& size, const wxString& bitmapType )
+	{
+		wxString accessor;
+		accessor << wxT("wxBitmap& ") << arrayName << wxT("_to_wx_bitmap()\n")
+				 << wxT("{\n")
+				 << wxT("\tstatic wxMemoryInputStream memIStream( ") << data << wxT(", ") << size << wxT(" );\n")
+				 << wxT("\tstatic wxImage image( memIStream, ") << bitmapType << wxT(" );\n")
+				 << wxT("\tstatic wxBitmap bmp( image );\n")
+				 << wxT("\treturn bmp;\n")
+				 << wxT("}\n");
+		return accessor;
+	}
+
+	/**
+	Assembler stub defining the symbols name and name_end around an included binary file.
+	GNU as and clang resolve a relative .incbin path through the assembler's include path,
+	so the stub has to be assembled with its own directory on it (e.g. -Wa,-I<dir>).
+	*/
+	wxString GetIncbinStub( const wxString& name, const wxString& file )
+	{
+		wxString stub;
+		stub << wxT("/* Assemble with the directory of this file on the include path, e.g. -Wa,-I<dir> */\n")
+			 << wxT("#if defined(__APPLE__) || ( defined(_WIN32) && !defined(_WIN64) )\n")
+			 << wxT("#define WXFB_SYMBOL(name) _##name\n")
+			 << wxT("#else\n")
+			 << wxT("#define WXFB_SYMBOL(name) name\n")
+			 << wxT("#endif\n")
+			 << wxT("\n")
+			 << wxT("#if defined(__APPLE__)\n")
+			 << wxT("\t.const_data\n")
+			 << wxT("#elif defined(_WIN32)\n")
+			 << wxT("\t.section .rdata,\"dr\"\n")
+			 << wxT("#else\n")
+			 << wxT("\t.section .rodata\n")
+			 << wxT("#endif\n")
+			 << wxT("\n")
+			 << wxT("\t.globl WXFB_SYMBOL(") << name << wxT(")\n")
+			 << wxT("\t.globl WXFB_SYMBOL(") << name << wxT("_end)\n")
+			 << wxT("\t.balign 16\n")
+			 << wxT("WXFB_SYMBOL(") << name << wxT("):\n")
+			 << wxT("\t.incbin \"") << file << wxT("\"\n")
+			 << wxT("WXFB_SYMBOL(") << name << wxT("_end):\n")
+			 << wxT("\t.byte 0\n")
+			 << wxT("\n")
+			 << wxT("#if defined(__ELF__)\n")
+			 << wxT("#if defined(__arm__)\n")
+			 << wxT("\t.section .note.GNU-stack,\"\",%progbits\n")
+			 << wxT("#else\n")
+			 << wxT("\t.section .note.GNU-stack,\"\",@progbits\n")
+			 << wxT("#endif\n")
+			 << wxT("#endif\n");
+		return stub;
+	}
 
-	if ( !sourceFileName.FileExists() )
+	std::string ToOutputEncoding( const wxString& text, bool useUtf8, bool useMicrosoftBOM )
 	{
-		wxLogWarning( sourcePath + wxT(" does not exist") );
-		return targetFullName;
+		std::string result;
+		if ( useMicrosoftBOM )
+		{
+			result.append( reinterpret_cast< const char* >( MICROSOFT_BOM ), sizeof( MICROSOFT_BOM ) );
+		}
+		result += ( useUtf8 ? _STDSTR( text ) : _ANSISTR( text ) );
+		return result;
 	}
+}
+
+wxString FileToCArray::Generate( const wxString& sourcePath )
+{
+	return Generate( std::vector< wxString >( 1, sourcePath ) ).front();
+}
+
+std::vector< wxString > FileToCArray::Generate( const std::vector< wxString >& sourcePaths, bool writeFiles )
+{
+	std::vector< wxString > includePaths;
+	includePaths.reserve( sourcePaths.size() );
 
 	PObjectBase project = AppData()->GetProjectData();
 
@@ -83,7 +468,11 @@ wxString FileToCArray::Generate( const wxString& sourcePath )
 	catch ( wxFBException& ex )
 	{
 		wxLogWarning( ex.what() );
-		return targetFullName;
+		for ( std::vector< wxString >::const_iterator sourcePath = sourcePaths.begin(); sourcePath != sourcePaths.end(); ++sourcePath )
+		{
+			includePaths.push_back( wxFileName( *sourcePath ).GetFullName() + wxT(".h") );
+		}
+		return includePaths;
 	}
 
 	// Determin if Microsoft BOM should be used
@@ -103,57 +492,234 @@ wxString FileToCArray::Generate( const wxString& sourcePath )
 		useUtf8 = ( pUseUtf8->GetValueAsString() != wxT("ANSI") );
 	}
 
-	// setup output file
-	PCodeWriter arrayCodeWriter( new FileCodeWriter( embeddedFilesOutputPath + targetFullName, useMicrosoftBOM, useUtf8 ) );
+	const EmbedFormat format = GetEmbedFormat( project );
+
+	// All files of the project share one archive, named after the generated files
+	wxString archiveName = project->GetPropertyAsString( wxT("file") );
+	if ( archiveName.empty() )
+	{
+		archiveName = project->GetPropertyAsString( wxT("name") );
+	}
+	archiveName = CppCodeGenerator::ConvertEmbeddedBitmapName( archiveName ) + wxT("_resources");
+	const wxString archiveHeader = archiveName + wxT(".h");
+
+	// Everything that touches wxWidgets' global state is done here, the workers only do file I/O and formatting
+	std::vector< EmbedJob > jobs;
+	std::set< wxString > targets;
+	for ( std::vector< wxString >::const_iterator sourcePath = sourcePaths.begin(); sourcePath != sourcePaths.end(); ++sourcePath )
+	{
+		wxFileName sourceFileName( *sourcePath );
+
+		const wxString& sourceFullName = sourceFileName.GetFullName();
+		const wxString targetFullName = ( EMBED_ARCHIVE == format ? archiveHeader : sourceFullName + wxT(".h") );
+
+		if ( !sourceFileName.FileExists() )
+		{
+			wxLogWarning( *sourcePath + wxT(" does not exist") );
+			includePaths.push_back( targetFullName );
+			continue;
+		}
+
+		const wxString targetPath = embeddedFilesOutputPath + targetFullName;
+		includePaths.push_back( TypeConv::MakeRelativePath( targetPath, outputPath ) );
+		if ( !writeFiles )
+		{
+			continue;
+		}
+
+		// Files with the same name share their header, the first one wins
+		const wxString arrayName = CppCodeGenerator::ConvertEmbeddedBitmapName( *sourcePath );
+		if ( !targets.insert( EMBED_ARCHIVE == format ? arrayName : targetPath ).second )
+		{
+			continue;
+		}
+
+		const wxString bitmapType = GetBitmapType( sourceFileName );
+		const wxString headerGuardName = arrayName.Upper() + wxT("_H");
+
+		if ( EMBED_INCBIN == format )
+		{
+			// The header does not depend on the contents of the file, the assembler includes it at build time
+			wxFileName incbinFile( *sourcePath );
+			incbinFile.MakeRelativeTo( embeddedFilesOutputPath );
 
-	const wxString headerGuardName = arrayName.Upper() + wxT("_H");
-	arrayCodeWriter->WriteLn( wxT("#ifndef ") + headerGuardName );
-	arrayCodeWriter->WriteLn( wxT("#define ") + headerGuardName );
-	arrayCodeWriter->WriteLn();
+			wxString header;
+			header << wxT("#ifndef ") << headerGuardName << wxT("\n")
+				   << wxT("#define ") << headerGuardName << wxT("\n")
+				   << wxT("\n")
+				   << GetHeaderIncludes()
+				   << wxT("\n")
+				   << wxT("// Defined in ") << sourceFullName << wxT(".S, which has to be assembled and linked with the application\n")
+				   << wxT("extern \"C\" const unsigned char ") << arrayName << wxT("[];\n")
+				   << wxT("extern \"C\" const unsigned char ") << arrayName << wxT("_end[];\n")
+				   << wxT("\n")
+				   << GetBitmapAccessor( arrayName, arrayName, wxT("static_cast< size_t >( ") + arrayName + wxT("_end - ") + arrayName + wxT(" )"), bitmapType )
+				   << wxT("\n")
+				   << wxT("#endif //") << headerGuardName << wxT("\n");
 
-	arrayCodeWriter->WriteLn( wxT("#include <wx/mstream.h>") );
-	arrayCodeWriter->WriteLn( wxT("#include <wx/image.h>") );
-	arrayCodeWriter->WriteLn( wxT("#include <wx/bitmap.h>") );
-	arrayCodeWriter->WriteLn();
+			const wxString stubPath = embeddedFilesOutputPath + sourceFullName + wxT(".S");
+			if ( !WriteIfChanged( targetPath, ToOutputEncoding( header, useUtf8, useMicrosoftBOM ) ) )
+			{
+				wxLogError( _("Unable to write file: %s"), targetPath );
+			}
+			if ( !WriteIfChanged( stubPath, ToOutputEncoding( GetIncbinStub( arrayName, incbinFile.GetFullPath( wxPATH_UNIX ) ), useUtf8, false ) ) )
+			{
+				wxLogError( _("Unable to write file: %s"), stubPath );
+			}
+			continue;
+		}
 
-	arrayCodeWriter->WriteLn( wxT("static const unsigned char ") + arrayName + wxT("[] = ") );
-	arrayCodeWriter->WriteLn( wxT("{") );
-	arrayCodeWriter->Indent();
+		EmbedJob job;
+		job.sourcePath = *sourcePath;
+		job.targetPath = targetPath;
+		job.format = format;
+		job.useMicrosoftBOM = useMicrosoftBOM;
+		job.readFailed = false;
+		job.writeFailed = false;
 
-	unsigned int count = 1;
-	const unsigned int bytesPerLine = 10;
-	std::ifstream binFile( static_cast< const char* >( sourcePath.mb_str( wxConvFile ) ), std::ios::binary );
-	for ( std::istreambuf_iterator< char > byte( binFile ), end; byte != end; ++byte, ++count )
+		if ( EMBED_ARCHIVE != format )
+		{
+			wxString head;
+			head << wxT("#ifndef ") << headerGuardName << wxT("\n")
+				 << wxT("#define ") << headerGuardName << wxT("\n")
+				 << wxT("\n")
+				 << GetHeaderIncludes()
+				 << wxT("\n");
+
+			wxString tail;
+			if ( EMBED_STRING == format )
+			{
+				head << wxT("static const char ") << arrayName << wxT("[] =\n");
+				tail << wxT(";\n")
+					 << wxT("\n")
+					 << GetBitmapAccessor( arrayName, arrayName, wxT("sizeof( ") + arrayName + wxT(" ) - 1"), bitmapType );
+			}
+			else
+			{
+				head << wxT("static const unsigned char ") << arrayName << wxT("[] =\n")
+					 << wxT("{\n");
+				tail << wxT("};\n")
+					 << wxT("\n")
+					 << GetBitmapAccessor( arrayName, arrayName, wxT("sizeof( ") + arrayName + wxT(" )"), bitmapType );
+			}
+			tail << wxT("\n")
+				 << wxT("\n")
+				 << wxT("#endif //") << headerGuardName << wxT("\n");
+
+			const wxString stampPrefix = wxT("// Embedded file ") + sourceFullName + wxT(" ") + bitmapType + ( EMBED_STRING == format ? wxT(" string") : wxT("") );
+			job.stampPrefix = ( useUtf8 ? _STDSTR( stampPrefix ) : _ANSISTR( stampPrefix ) );
+			job.generator = std::string( VERSION ) + ( useUtf8 ? " utf8" : " ansi" ) + ( useMicrosoftBOM ? " bom" : "" ) + ( EMBED_STRING == format ? " string" : " array" );
+			job.head = ( useUtf8 ? _STDSTR( head ) : _ANSISTR( head ) );
+			job.tail = ( useUtf8 ? _STDSTR( tail ) : _ANSISTR( tail ) );
+		}
+		else
+		{
+			job.arrayName = arrayName;
+			job.bitmapType = bitmapType;
+		}
+
+		jobs.push_back( job );
+	}
+
+	// Encode the files in parallel
+	std::atomic< size_t > next( 0 );
+	auto worker = [ &jobs, &next ]()
 	{
-		arrayCodeWriter->Write( wxString::Format( wxT("0x%02X, "), static_cast< unsigned int >( static_cast< unsigned char >( *byte ) ) ) );
-		if ( count >= bytesPerLine )
+		for ( size_t i = next++; i < jobs.size(); i = next++ )
 		{
-			arrayCodeWriter->WriteLn();
-			count = 0;
+			Encode( jobs[i] );
 		}
+	};
+
+	const size_t threadCount = std::min< size_t >( jobs.size(), std::max( 1u, std::thread::hardware_concurrency() ) );
+	std::vector< std::thread > threads;
+	for ( size_t i = 1; i < threadCount; ++i )
+	{
+		threads.push_back( std::thread( worker ) );
 	}
-	if ( (count < bytesPerLine) && (count != 1) )
+	worker();
+	for ( std::vector< std::thread >::iterator thread = threads.begin(); thread != threads.end(); ++thread )
 	{
-		arrayCodeWriter->WriteLn();
+		thread->join();
 	}
-	arrayCodeWriter->Unindent();
-	arrayCodeWriter->WriteLn( wxT("};") );
-	arrayCodeWriter->WriteLn();
 
-	arrayCodeWriter->WriteLn( wxT("wxBitmap& ") + arrayName + wxT("_to_wx_bitmap()") );
-	arrayCodeWriter->WriteLn( wxT("{") );
-	arrayCodeWriter->Indent();
-	arrayCodeWriter->WriteLn( wxT("static wxMemoryInputStream memIStream( ") + arrayName + wxT(", sizeof( ") + arrayName + wxT(" ) );") );
-	arrayCodeWriter->WriteLn( wxT("static wxImage image( memIStream, ") + GetBitmapType( sourceFileName ) + wxT(" );") );
-	arrayCodeWriter->WriteLn( wxT("static wxBitmap bmp( image );") );
-	arrayCodeWriter->WriteLn( wxT("return bmp;") );
-	arrayCodeWriter->Unindent();
-	arrayCodeWriter->WriteLn( wxT("}") );
-	arrayCodeWriter->WriteLn();
+	for ( std::vector< EmbedJob >::const_iterator job = jobs.begin(); job != jobs.end(); ++job )
+	{
+		if ( job->readFailed )
+		{
+			wxLogError( _("Unable to read file: %s"), job->sourcePath );
+		}
+		else if ( job->writeFailed )
+		{
+			wxLogError( _("Unable to write file: %s"), job->targetPath );
+		}
+		else if ( EMBED_ARCHIVE != format )
+		{
+			GenerationManifest::AddOutput( job->targetPath );
+		}
+	}
 
-	arrayCodeWriter->WriteLn();
-	arrayCodeWriter->WriteLn( wxT("#endif //") + headerGuardName );
+	if ( EMBED_ARCHIVE == format && std::any_of( jobs.begin(), jobs.end(), []( const EmbedJob& job ) { return !job.readFailed; } ) )
+	{
+		// Pack the files into one blob, each one aligned, and describe them in the header
+		std::string archive;
+		wxString index;
+		wxString accessors;
+		size_t entry = 0;
+		for ( std::vector< EmbedJob >::const_iterator job = jobs.begin(); job != jobs.end(); ++job )
+		{
+			if ( job->readFailed )
+			{
+				continue;
+			}
 
-	return TypeConv::MakeRelativePath( embeddedFilesOutputPath + targetFullName, outputPath );
-}
+			archive.resize( ( archive.size() + ARCHIVE_ALIGNMENT - 1 ) / ARCHIVE_ALIGNMENT * ARCHIVE_ALIGNMENT, '\0' );
+			const size_t offset = archive.size();
+			archive.append( job->data.begin(), job->data.end() );
 
+			const wxString indexEntry = wxString::Format( wxT("%s_index[%lu]"), archiveName, static_cast< unsigned long >( entry++ ) );
+			index << wxString::Format( wxT("\t{ %lu, %lu },\t// "), static_cast< unsigned long >( offset ), static_cast< unsigned long >( job->data.size() ) )
+				  << wxFileName( job->sourcePath ).GetFullName() << wxT("\n");
+			accessors << GetBitmapAccessor( job->arrayName, archiveName + wxT(" + ") + indexEntry + wxT("[0]"), indexEntry + wxT("[1]"), job->bitmapType )
+					  << wxT("\n");
+		}
+
+		const wxString headerGuardName = archiveName.Upper() + wxT("_H");
+		wxString header;
+		header << wxT("#ifndef ") << headerGuardName << wxT("\n")
+			   << wxT("#define ") << headerGuardName << wxT("\n")
+			   << wxT("\n")
+			   << GetHeaderIncludes()
+			   << wxT("\n")
+			   << wxT("// Defined in ") << archiveName << wxT(".S, which has to be assembled and linked with the application\n")
+			   << wxT("extern \"C\" const unsigned char ") << archiveName << wxT("[];\n")
+			   << wxT("\n")
+			   << wxT("// Offset and size of each file in ") << archiveName << wxT(".bin\n")
+			   << wxT("static const size_t ") << archiveName << wxT("_index[][2] =\n")
+			   << wxT("{\n")
+			   << index
+			   << wxT("};\n")
+			   << wxT("\n")
+			   << accessors
+			   << wxT("\n")
+			   << wxT("#endif //") << headerGuardName << wxT("\n");
+
+		const wxString binPath = embeddedFilesOutputPath + archiveName + wxT(".bin");
+		const wxString stubPath = embeddedFilesOutputPath + archiveName + wxT(".S");
+		const wxString headerPath = embeddedFilesOutputPath + archiveHeader;
+		if ( !WriteIfChanged( binPath, archive ) )
+		{
+			wxLogError( _("Unable to write file: %s"), binPath );
+		}
+		if ( !WriteIfChanged( stubPath, ToOutputEncoding( GetIncbinStub( archiveName, archiveName + wxT(".bin") ), useUtf8, false ) ) )
+		{
+			wxLogError( _("Unable to write file: %s"), stubPath );
+		}
+		if ( !WriteIfChanged( headerPath, ToOutputEncoding( header, useUtf8, useMicrosoftBOM ) ) )
+		{
+			wxLogError( _("Unable to write file: %s"), headerPath );
+		}
+	}
+
+	return includePaths;
+}
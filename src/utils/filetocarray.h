@@ -3,10 +3,21 @@
 
 #include <wx/string.h>
 
+#include <vector>
+
 class FileToCArray
 {
 public:
 	static wxString Generate( const wxString& sourcepath );
+
+	/**
+	Generates the headers of several embedded files, encoding them in parallel.
+	Headers whose stamp (source size and MD5, and how the header was generated) is current are left untouched.
+	@param writeFiles False to only get the include paths, e.g. for a preview of part of the project,
+	which must not replace the headers or the archive of the whole project.
+	@return The include path of each header, in the order of sourcePaths.
+	*/
+	static std::vector< wxString > Generate( const std::vector< wxString >& sourcePaths, bool writeFiles = true );
 };
 
 #endif // FILE_TO_C_ARRAY_H
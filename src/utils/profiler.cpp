@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "profiler.h"
+
+#include <wx/ffile.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	// Keep traces of long sessions bounded, statistics are still aggregated past this
+	const size_t MAX_SAMPLES = 500000;
+
+	struct Sample
+	{
+		wxString name;
+		wxString category;
+		long long start;
+		long long duration;
+		unsigned int thread;
+	};
+
+	struct ProfilerData
+	{
+		std::mutex mutex;
+		std::vector< Sample > samples;
+		std::map< std::pair< wxString, wxString >, Profiler::Stats > stats;
+		std::map< std::thread::id, unsigned int > threads;
+		std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+	};
+
+	std::atomic< bool > s_enabled( false );
+
+	ProfilerData& GetData()
+	{
+		static ProfilerData data;
+		return data;
+	}
+
+	wxString EscapeJSON( const wxString& value )
+	{
+		wxString result;
+		result.reserve( value.length() );
+		for ( wxString::const_iterator c = value.begin(); c != value.end(); ++c )
+		{
+			switch ( (wxChar)*c )
+			{
+				case wxT('"'):  result << wxT("\\\""); break;
+				case wxT('\\'): result << wxT("\\\\"); break;
+				case wxT('\n'): result << wxT("\\n");  break;
+				case wxT('\t'): result << wxT("\\t");  break;
+				default:        result << *c;          break;
+			}
+		}
+		return result;
+	}
+}
+
+void Profiler::Enable( bool enable )
+{
+	s_enabled = enable;
+}
+
+bool Profiler::IsEnabled()
+{
+	return s_enabled;
+}
+
+void Profiler::Clear()
+{
+	ProfilerData& data = GetData();
+	std::lock_guard< std::mutex > lock( data.mutex );
+	data.samples.clear();
+	data.stats.clear();
+}
+
+long long Profiler::Now()
+{
+	return std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - GetData().epoch ).count();
+}
+
+void Profiler::Record( const wxString& name, const wxString& category, long long start, long long duration )
+{
+	ProfilerData& data = GetData();
+	std::lock_guard< std::mutex > lock( data.mutex );
+
+	Stats& stats = data.stats[ std::make_pair( name, category ) ];
+	if ( 0 == stats.count )
+	{
+		stats.name = name;
+		stats.category = category;
+		stats.total = 0;
+		stats.max = 0;
+	}
+	stats.count++;
+	stats.total += duration;
+	stats.max = std::max( stats.max, duration );
+
+	if ( data.samples.size() < MAX_SAMPLES )
+	{
+		std::map< std::thread::id, unsigned int >::iterator thread = data.threads.find( std::this_thread::get_id() );
+		if ( thread == data.threads.end() )
+		{
+			thread = data.threads.insert( std::make_pair( std::this_thread::get_id(), (unsigned int)data.threads.size() + 1 ) ).first;
+		}
+
+		Sample sample = { name, category, start, duration, thread->second };
+		data.samples.push_back( sample );
+	}
+}
+
+std::vector< Profiler::Stats > Profiler::GetStats()
+{
+	std::vector< Stats > result;
+	{
+		ProfilerData& data = GetData();
+		std::lock_guard< std::mutex > lock( data.mutex );
+		result.reserve( data.stats.size() );
+		for ( std::map< std::pair< wxString, wxString >, Stats >::const_iterator it = data.stats.begin(); it != data.stats.end(); ++it )
+		{
+			result.push_back( it->second );
+		}
+	}
+
+	std::sort( result.begin(), result.end(), []( const Stats& a, const Stats& b ) { return a.total > b.total; } );
+	return result;
+}
+
+bool Profiler::ExportChromeTrace( const wxString& path )
+{
+	wxFFile file( path, wxT("w") );
+	if ( !file.IsOpened() )
+	{
+		return false;
+	}
+
+	wxString json = wxT("{\"traceEvents\":[\n");
+	{
+		ProfilerData& data = GetData();
+		std::lock_guard< std::mutex > lock( data.mutex );
+		for ( size_t i = 0; i < data.samples.size(); ++i )
+		{
+			const Sample& sample = data.samples[i];
+			wxString name = sample.name;
+			if ( !sample.category.empty() )
+			{
+				name << wxT(" [") << sample.category << wxT("]");
+			}
+
+			json << ( i > 0 ? wxT(",\n") : wxT("") )
+				 << wxT("{\"name\":\"") << EscapeJSON( name )
+				 << wxT("\",\"cat\":\"") << EscapeJSON( sample.category.empty() ? sample.name : sample.category )
+				 << wxT("\",\"ph\":\"X\",\"ts\":") << wxString::Format( wxT("%lld"), sample.start )
+				 << wxT(",\"dur\":") << wxString::Format( wxT("%lld"), sample.duration )
+				 << wxT(",\"pid\":1,\"tid\":") << sample.thread << wxT("}");
+		}
+	}
+	json << wxT("\n],\"displayTimeUnit\":\"ms\"}\n");
+
+	return file.Write( json, wxConvUTF8 ) && file.Close();
+}
@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include <wx/string.h>
+
+#include <vector>
+
+/**
+ * Optional instrumentation of designer rebuilds and code generation.
+ *
+ * Timings are only collected while the profiler is enabled, a disabled ProfileScope
+ * costs a single flag test. Samples are aggregated per scope and per category (the
+ * component class for plugin calls) and can be exported as Chrome trace JSON, which
+ * chrome://tracing and Perfetto load directly.
+ */
+class Profiler
+{
+public:
+	/// Aggregated timings of one scope/category pair, durations in microseconds
+	struct Stats
+	{
+		wxString name;
+		wxString category;
+		unsigned long count;
+		long long total;
+		long long max;
+	};
+
+	static void Enable( bool enable = true );
+	static bool IsEnabled();
+
+	/// Drops all samples and statistics
+	static void Clear();
+
+	/// Microseconds since the profiler was first used
+	static long long Now();
+
+	static void Record( const wxString& name, const wxString& category, long long start, long long duration );
+
+	/// Statistics sorted by descending total time
+	static std::vector< Stats > GetStats();
+
+	/// Writes the recorded samples in Chrome trace event format
+	static bool ExportChromeTrace( const wxString& path );
+};
+
+/**
+ * Times the enclosing scope and records it with the profiler.
+ */
+class ProfileScope
+{
+private:
+	const wxChar* m_name;
+	wxString m_category;
+	long long m_start;
+	bool m_active;
+
+	ProfileScope( const ProfileScope& );
+	ProfileScope& operator=( const ProfileScope& );
+
+public:
+	explicit ProfileScope( const wxChar* name )
+	:
+	m_name( name ),
+	m_start( 0 ),
+	m_active( Profiler::IsEnabled() )
+	{
+		if ( m_active )
+		{
+			m_start = Profiler::Now();
+		}
+	}
+
+	ProfileScope( const wxChar* name, const wxString& category )
+	:
+	m_name( name ),
+	m_start( 0 ),
+	m_active( Profiler::IsEnabled() )
+	{
+		if ( m_active )
+		{
+			m_category = category;
+			m_start = Profiler::Now();
+		}
+	}
+
+	~ProfileScope()
+	{
+		if ( m_active )
+		{
+			Profiler::Record( m_name, m_category, m_start, Profiler::Now() - m_start );
+		}
+	}
+};
+
+#endif //__PROFILER_H__
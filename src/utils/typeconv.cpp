@@ -29,6 +29,8 @@
 #include "../rad/bitmaps.h"
 #include "../rad/inspector/objinspect.h"
 
+#include <algorithm>
+
 #include <wx/artprov.h>
 #include <wx/filesys.h>
 
@@ -215,15 +217,20 @@ wxSize TypeConv::StringToSize (const wxString &val)
 int TypeConv::BitlistToInt (const wxString &str)
 {
 	int result = 0;
-	wxStringTokenizer tkz(str, wxT("|"));
-	while (tkz.HasMoreTokens())
+	wxString::const_iterator start = str.begin();
+	while ( start != str.end() )
 	{
-		wxString token;
-		token = tkz.GetNextToken();
+		wxString::const_iterator end = std::find( start, str.end(), wxT('|') );
+
+		wxString token( start, end );
 		token.Trim(true);
 		token.Trim(false);
+		if ( !token.empty() )
+		{
+			result |= GetMacroValue(token);
+		}
 
-		result |= GetMacroValue(token);
+		start = ( end == str.end() ? end : end + 1 );
 	}
 
 	return result;
@@ -245,8 +252,7 @@ int TypeConv::GetMacroValue(const wxString &str)
 {
 	int value = 0;
 
-	PMacroDictionary dic = MacroDictionary::GetInstance();
-	dic->SearchMacro( str, &value );
+	MacroDictionary::GetInstance()->SearchMacro( str, &value );
 
 	return value;
 }
@@ -1073,17 +1079,54 @@ void MacroDictionary::Destroy()
 	s_instance = 0;
 }
 
-bool MacroDictionary::SearchMacro(wxString name, int *result)
+namespace
 {
-	bool found = false;
-	MacroMap::iterator it = m_map.find(name);
-	if (it != m_map.end())
+	bool MacroNameLess( const std::pair< wxString, int >& macro, const wxString& name )
 	{
-		found = true;
-		*result = it->second;
+		return macro.first < name;
 	}
 
-	return found;
+	bool MacroLess( const std::pair< wxString, int >& a, const std::pair< wxString, int >& b )
+	{
+		return a.first < b.first;
+	}
+
+	bool MacroNameEqual( const std::pair< wxString, int >& a, const std::pair< wxString, int >& b )
+	{
+		return a.first == b.first;
+	}
+}
+
+bool MacroDictionary::SearchMacro(const wxString& name, int *result)
+{
+	if ( !m_sorted )
+	{
+		Build();
+	}
+
+	MacroTable::const_iterator it = std::lower_bound( m_macros.begin(), m_macros.end(), name, MacroNameLess );
+	if ( it == m_macros.end() || it->first != name )
+	{
+		if ( !m_missingMacroHandler || !m_missingMacroHandler( name ) )
+		{
+			return false;
+		}
+
+		// The handler registered new macros
+		if ( !m_sorted )
+		{
+			Build();
+		}
+
+		it = std::lower_bound( m_macros.begin(), m_macros.end(), name, MacroNameLess );
+		if ( it == m_macros.end() || it->first != name )
+		{
+			return false;
+		}
+	}
+
+	*result = it->second;
+	return true;
 }
 
 bool MacroDictionary::SearchSynonymous(wxString synName, wxString& result)
@@ -1102,9 +1145,19 @@ bool MacroDictionary::SearchSynonymous(wxString synName, wxString& result)
 #define MACRO(x) m_map.insert(MacroMap::value_type(#x,x))
 #define MACRO2(x,y) m_map.insert(MacroMap::value_type(#x,y))*/
 
-void MacroDictionary::AddMacro(wxString name, int value)
+void MacroDictionary::AddMacro(const wxString& name, int value)
+{
+	m_macros.push_back( MacroTable::value_type( name, value ) );
+	m_sorted = false;
+	++m_revision;
+}
+
+void MacroDictionary::Build()
 {
-	m_map.insert(MacroMap::value_type(name,value));
+	// A stable sort keeps the first registration of a name in front, as the first one wins
+	std::stable_sort( m_macros.begin(), m_macros.end(), MacroLess );
+	m_macros.erase( std::unique( m_macros.begin(), m_macros.end(), MacroNameEqual ), m_macros.end() );
+	m_sorted = true;
 }
 
 void MacroDictionary::AddSynonymous(wxString synName, wxString name)
@@ -1113,6 +1166,9 @@ void MacroDictionary::AddSynonymous(wxString synName, wxString name)
 }
 
 MacroDictionary::MacroDictionary()
+:
+m_sorted( true ),
+m_revision( 1 )
 {
 	// Las macros serán incluidas en las bibliotecas de componentes...
 	// Sizers macros
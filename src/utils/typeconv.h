@@ -29,6 +29,8 @@
 #include "../model/types.h"
 #include "fontcontainer.h"
 
+#include <functional>
+
 // macros para la conversión entre wxString <-> wxString
 #define _WXSTR(x)  TypeConv::_StringToWxString(x)
 #define _STDSTR(x) TypeConv::_WxStringToString(x)
@@ -114,23 +116,44 @@ typedef MacroDictionary* PMacroDictionary;
 class MacroDictionary
 {
 private:
-	typedef std::map<wxString, int> MacroMap;
+	typedef std::vector< std::pair< wxString, int > > MacroTable;
 	static PMacroDictionary s_instance;
 
 	typedef std::map<wxString, wxString> SynMap;
 
-	MacroMap m_map;
+public:
+	/// Returns true if it registered macros that may include the given one
+	typedef std::function< bool ( const wxString& name ) > MissingMacroHandler;
+
+private:
+	// Sorted by name for binary search once Build() ran, new macros are appended until then
+	MacroTable m_macros;
+	bool m_sorted;
+	unsigned long m_revision;
 	SynMap m_synMap;
+	MissingMacroHandler m_missingMacroHandler;
 
 	MacroDictionary();
 
 public:
 	static PMacroDictionary GetInstance();
 	static void Destroy();
-	bool SearchMacro( wxString name, int *result );
-	void AddMacro( wxString name, int value );
+	bool SearchMacro( const wxString& name, int *result );
+	void AddMacro( const wxString& name, int value );
 	void AddSynonymous( wxString synName, wxString name );
 	bool SearchSynonymous( wxString synName, wxString& result );
+
+	/// Lets SearchMacro import the macros it does not know yet, e.g. from a component library not loaded yet
+	void SetMissingMacroHandler( MissingMacroHandler handler ) { m_missingMacroHandler = handler; }
+
+	/**
+	* Sorts the macros into the lookup table. Called once all the component libraries
+	* registered their macros, later additions rebuild the table on the next search.
+	*/
+	void Build();
+
+	/// Changes whenever a macro is added, values converted with older revisions may be stale
+	unsigned long GetRevision() const { return m_revision; }
 };
 
 #endif //__TYPE_UTILS__
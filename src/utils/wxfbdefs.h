@@ -44,6 +44,8 @@ class CodeWriter;
 class TemplateParser;
 class TCCodeWriter;
 class StringCodeWriter;
+class ProjectAnalysis;
+class ConstructionNode;
 
 // Let's go with a few typedefs for frequently used types,
 // please use it, code will be cleaner and easier to read.
@@ -77,6 +79,7 @@ typedef std::shared_ptr<CodeWriter> PCodeWriter;
 typedef std::shared_ptr<TemplateParser> PTemplateParser;
 typedef std::shared_ptr<TCCodeWriter> PTCCodeWriter;
 typedef std::shared_ptr<StringCodeWriter> PStringCodeWriter;
+typedef std::shared_ptr<const ProjectAnalysis> PProjectAnalysis;
 
 // Flatnotebook styles are stored in config, if style #defines change, or config is manually modified, these style overrides still apply
 #define FNB_STYLE_OVERRIDES( x ) ( x | wxFNB_CUSTOM_DLG | wxFNB_NO_X_BUTTON ) & ( ~wxFNB_X_ON_TAB & ~wxFNB_MOUSE_MIDDLE_CLOSES_TABS & ~wxFNB_DCLICK_CLOSES_TABS & ~wxFNB_ALLOW_FOREIGN_DND )
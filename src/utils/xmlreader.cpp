@@ -0,0 +1,432 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "xmlreader.h"
+
+#include "wxfbexception.h"
+
+#include <wx/intl.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	bool IsWhiteSpace( char c )
+	{
+		return ' ' == c || '\t' == c || '\n' == c || '\r' == c;
+	}
+
+	bool StartsWith( const char* pos, const char* end, const char* token )
+	{
+		size_t length = strlen( token );
+		return (size_t)( end - pos ) >= length && 0 == strncmp( pos, token, length );
+	}
+
+	void AppendUTF8( unsigned long code, std::string* result )
+	{
+		if ( code < 0x80 )
+		{
+			*result += (char)code;
+		}
+		else if ( code < 0x800 )
+		{
+			*result += (char)( 0xC0 | ( code >> 6 ) );
+			*result += (char)( 0x80 | ( code & 0x3F ) );
+		}
+		else if ( code < 0x10000 )
+		{
+			*result += (char)( 0xE0 | ( code >> 12 ) );
+			*result += (char)( 0x80 | ( ( code >> 6 ) & 0x3F ) );
+			*result += (char)( 0x80 | ( code & 0x3F ) );
+		}
+		else
+		{
+			*result += (char)( 0xF0 | ( code >> 18 ) );
+			*result += (char)( 0x80 | ( ( code >> 12 ) & 0x3F ) );
+			*result += (char)( 0x80 | ( ( code >> 6 ) & 0x3F ) );
+			*result += (char)( 0x80 | ( code & 0x3F ) );
+		}
+	}
+}
+
+XmlReader::XmlReader( const char* begin, const char* end )
+:
+m_pos( begin ),
+m_end( end ),
+m_rowPos( begin ),
+m_row( 1 ),
+m_pendingEnd( false ),
+m_hasDeclaration( false )
+{
+	// Skip the UTF-8 byte order mark
+	if ( StartsWith( m_pos, m_end, "\xEF\xBB\xBF" ) )
+	{
+		m_pos += 3;
+		m_rowPos = m_pos;
+	}
+}
+
+void XmlReader::UpdateRow( const char* pos )
+{
+	for ( ; m_rowPos < pos; ++m_rowPos )
+	{
+		if ( '\n' == *m_rowPos )
+		{
+			++m_row;
+		}
+	}
+}
+
+const char* XmlReader::Find( const char* token )
+{
+	size_t length = strlen( token );
+	for ( const char* pos = m_pos; pos + length <= m_end; ++pos )
+	{
+		if ( *pos == *token && 0 == strncmp( pos, token, length ) )
+		{
+			return pos;
+		}
+	}
+
+	UpdateRow( m_end );
+	THROW_WXFBEX( _("Unterminated XML markup, missing \"") << wxString::FromUTF8( token ) << _("\" at the end of the file") )
+}
+
+std::string XmlReader::ReadName()
+{
+	const char* begin = m_pos;
+	while ( m_pos < m_end && !IsWhiteSpace( *m_pos ) && '/' != *m_pos && '>' != *m_pos && '=' != *m_pos && '?' != *m_pos )
+	{
+		++m_pos;
+	}
+	return std::string( begin, m_pos );
+}
+
+void XmlReader::SkipWhiteSpace()
+{
+	while ( m_pos < m_end && IsWhiteSpace( *m_pos ) )
+	{
+		++m_pos;
+	}
+}
+
+void XmlReader::Decode( const char* begin, const char* end, std::string* result ) const
+{
+	result->clear();
+	result->reserve( end - begin );
+
+	for ( const char* pos = begin; pos < end; ++pos )
+	{
+		if ( '\r' == *pos )
+		{
+			// "\r\n" and a lone "\r" are both line breaks
+			*result += '\n';
+			if ( pos + 1 < end && '\n' == pos[1] )
+			{
+				++pos;
+			}
+		}
+		else if ( '&' == *pos )
+		{
+			const char* semicolon = pos + 1;
+			while ( semicolon < end && semicolon - pos < 12 && ';' != *semicolon )
+			{
+				++semicolon;
+			}
+
+			std::string entity( pos + 1, semicolon < end ? semicolon : pos + 1 );
+			if ( semicolon >= end || ';' != *semicolon || entity.empty() )
+			{
+				*result += '&';
+			}
+			else if ( "amp" == entity )		{ *result += '&'; pos = semicolon; }
+			else if ( "lt" == entity )		{ *result += '<'; pos = semicolon; }
+			else if ( "gt" == entity )		{ *result += '>'; pos = semicolon; }
+			else if ( "quot" == entity )	{ *result += '"'; pos = semicolon; }
+			else if ( "apos" == entity )	{ *result += '\''; pos = semicolon; }
+			else if ( '#' == entity[0] && entity.size() > 1 )
+			{
+				bool hex = ( 'x' == entity[1] || 'X' == entity[1] );
+				unsigned long code = strtoul( entity.c_str() + ( hex ? 2 : 1 ), NULL, hex ? 16 : 10 );
+				if ( 0 == code || code > 0x10FFFF || ( code >= 0xD800 && code <= 0xDFFF ) )
+				{
+					THROW_WXFBEX( _("Invalid XML character reference \"&") << wxString::FromUTF8( entity.c_str() ) << _(";\" on line ") << m_row )
+				}
+				AppendUTF8( code, result );
+				pos = semicolon;
+			}
+			else
+			{
+				// Unknown entities are kept as they are
+				*result += '&';
+			}
+		}
+		else
+		{
+			*result += *pos;
+		}
+	}
+}
+
+void XmlReader::ReadAttributes( const char* end, bool declaration )
+{
+	m_attributes.clear();
+	while ( true )
+	{
+		SkipWhiteSpace();
+		if ( m_pos >= end || '/' == *m_pos || '?' == *m_pos )
+		{
+			return;
+		}
+
+		std::string name = ReadName();
+		SkipWhiteSpace();
+		if ( name.empty() || m_pos >= end || '=' != *m_pos )
+		{
+			UpdateRow( m_pos );
+			THROW_WXFBEX( _("Malformed XML attribute on line ") << m_row )
+		}
+		++m_pos;
+		SkipWhiteSpace();
+
+		char quote = ( m_pos < end ? *m_pos : 0 );
+		if ( '"' != quote && '\'' != quote )
+		{
+			UpdateRow( m_pos );
+			THROW_WXFBEX( _("Unquoted XML attribute value on line ") << m_row )
+		}
+
+		const char* value = ++m_pos;
+		while ( m_pos < end && quote != *m_pos )
+		{
+			++m_pos;
+		}
+
+		std::string decoded;
+		Decode( value, m_pos, &decoded );
+		++m_pos;
+
+		if ( declaration )
+		{
+			if ( "encoding" == name )
+			{
+				m_encoding = decoded;
+			}
+		}
+		else
+		{
+			m_attributes.push_back( std::make_pair( name, decoded ) );
+		}
+	}
+}
+
+void XmlReader::ReadDeclaration( const char* end )
+{
+	m_hasDeclaration = true;
+	m_pos += 5;
+	ReadAttributes( end, true );
+}
+
+XmlReader::NodeType XmlReader::Next()
+{
+	if ( m_pendingEnd )
+	{
+		m_pendingEnd = false;
+		m_open.pop_back();
+		return NODE_END;
+	}
+
+	while ( m_pos < m_end )
+	{
+		UpdateRow( m_pos );
+
+		if ( '<' != *m_pos )
+		{
+			const char* begin = m_pos;
+			while ( m_pos < m_end && '<' != *m_pos )
+			{
+				++m_pos;
+			}
+			Decode( begin, m_pos, &m_text );
+			return NODE_TEXT;
+		}
+
+		if ( StartsWith( m_pos, m_end, "<!--" ) )
+		{
+			m_pos = Find( "-->" ) + 3;
+		}
+		else if ( StartsWith( m_pos, m_end, "<![CDATA[" ) )
+		{
+			m_pos += 9;
+			const char* end = Find( "]]>" );
+
+			// Only line breaks are normalized in CDATA sections
+			m_text.clear();
+			for ( const char* pos = m_pos; pos < end; ++pos )
+			{
+				if ( '\r' != *pos )
+				{
+					m_text += *pos;
+				}
+				else if ( pos + 1 >= end || '\n' != pos[1] )
+				{
+					m_text += '\n';
+				}
+			}
+			m_pos = end + 3;
+			return NODE_TEXT;
+		}
+		else if ( StartsWith( m_pos, m_end, "<!" ) )
+		{
+			// DOCTYPE, possibly with an internal subset between brackets
+			int brackets = 0;
+			for ( ++m_pos; m_pos < m_end; ++m_pos )
+			{
+				if ( '[' == *m_pos )
+				{
+					++brackets;
+				}
+				else if ( ']' == *m_pos )
+				{
+					--brackets;
+				}
+				else if ( '>' == *m_pos && brackets <= 0 )
+				{
+					break;
+				}
+			}
+			++m_pos;
+		}
+		else if ( StartsWith( m_pos, m_end, "<?" ) )
+		{
+			const char* end = Find( "?>" );
+			if ( StartsWith( m_pos, end, "<?xml" ) && m_pos + 5 < end && IsWhiteSpace( m_pos[5] ) )
+			{
+				ReadDeclaration( end );
+			}
+			m_pos = end + 2;
+		}
+		else if ( StartsWith( m_pos, m_end, "</" ) )
+		{
+			m_pos += 2;
+			m_name = ReadName();
+			SkipWhiteSpace();
+			if ( m_name.empty() || m_pos >= m_end || '>' != *m_pos )
+			{
+				THROW_WXFBEX( _("Malformed XML end tag on line ") << m_row )
+			}
+			if ( m_open.empty() )
+			{
+				THROW_WXFBEX( _("Unexpected XML end tag \"</") << wxString::FromUTF8( m_name.c_str() ) << _(">\" on line ") << m_row )
+			}
+			if ( m_open.back() != m_name )
+			{
+				THROW_WXFBEX( _("Mismatched XML end tag \"</") << wxString::FromUTF8( m_name.c_str() ) << _(">\" on line ") << m_row
+								<< _(", expected \"</") << wxString::FromUTF8( m_open.back().c_str() ) << _(">\"") )
+			}
+			m_open.pop_back();
+			++m_pos;
+			return NODE_END;
+		}
+		else
+		{
+			++m_pos;
+			m_name = ReadName();
+			if ( m_name.empty() )
+			{
+				THROW_WXFBEX( _("Malformed XML start tag on line ") << m_row )
+			}
+
+			// The tag ends at the first '>' out of the attribute values
+			const char* end = m_pos;
+			char quote = 0;
+			for ( ; end < m_end; ++end )
+			{
+				if ( quote )
+				{
+					if ( quote == *end )
+					{
+						quote = 0;
+					}
+				}
+				else if ( '"' == *end || '\'' == *end )
+				{
+					quote = *end;
+				}
+				else if ( '>' == *end )
+				{
+					break;
+				}
+			}
+			if ( end >= m_end )
+			{
+				THROW_WXFBEX( _("Unterminated XML start tag on line ") << m_row )
+			}
+
+			ReadAttributes( end, false );
+			m_open.push_back( m_name );
+			m_pendingEnd = ( '/' == *( end - 1 ) );
+			m_pos = end + 1;
+			return NODE_START;
+		}
+	}
+
+	if ( !m_open.empty() )
+	{
+		UpdateRow( m_end );
+		THROW_WXFBEX( _("Unexpected end of the XML document, element \"") << wxString::FromUTF8( m_open.back().c_str() ) << _("\" is not closed") )
+	}
+
+	return NODE_END_OF_DOCUMENT;
+}
+
+const std::string* XmlReader::FindAttribute( const char* name ) const
+{
+	for ( Attributes::const_iterator it = m_attributes.begin(); it != m_attributes.end(); ++it )
+	{
+		if ( it->first == name )
+		{
+			return &it->second;
+		}
+	}
+	return NULL;
+}
+
+void XmlReader::SkipElement()
+{
+	int depth = 1;
+	while ( depth > 0 )
+	{
+		switch ( Next() )
+		{
+			case NODE_START:
+				++depth;
+				break;
+			case NODE_END:
+				--depth;
+				break;
+			case NODE_TEXT:
+				break;
+			case NODE_END_OF_DOCUMENT:
+				THROW_WXFBEX( _("Unexpected end of the XML document, an element is not closed") )
+		}
+	}
+}
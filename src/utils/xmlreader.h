@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __XML_READER_H__
+#define __XML_READER_H__
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Forward only reader of an XML document held in memory, which never builds a tree.
+ *
+ * Text is decoded as TinyXML does: entities are replaced, line breaks are normalized
+ * to '\n' and whitespace is kept. Comments, processing instructions and DOCTYPE are
+ * skipped, an empty element is read as a start node followed by an end node.
+ * Malformed documents throw wxFBException, including end tags that do not match their
+ * start tag and elements left open at the end of the document.
+ */
+class XmlReader
+{
+public:
+	enum NodeType
+	{
+		NODE_START,
+		NODE_END,
+		NODE_TEXT,
+		NODE_END_OF_DOCUMENT
+	};
+
+	typedef std::vector< std::pair< std::string, std::string > > Attributes;
+
+	/// The document must outlive the reader
+	XmlReader( const char* begin, const char* end );
+
+	NodeType Next();
+
+	/// Name of the element of the last start or end node
+	const std::string& GetName() const { return m_name; }
+
+	/// Attributes of the last start node, in document order
+	const Attributes& GetAttributes() const { return m_attributes; }
+
+	/// Value of an attribute of the last start node, NULL if it does not have it
+	const std::string* FindAttribute( const char* name ) const;
+
+	/// Text of the last text node, CDATA sections included
+	const std::string& GetText() const { return m_text; }
+
+	/// Line of the last node read, starting at 1
+	int GetRow() const { return m_row; }
+
+	/// Encoding of the XML declaration, empty if the document has no declaration before its root
+	const std::string& GetEncoding() const { return m_encoding; }
+	bool HasDeclaration() const { return m_hasDeclaration; }
+
+	/// Skips the content of the element whose start node was just read, up to its end node
+	void SkipElement();
+
+private:
+	const char* m_pos;
+	const char* m_end;
+	const char* m_rowPos;
+	int m_row;
+	bool m_pendingEnd;
+	bool m_hasDeclaration;
+
+	std::string m_name;
+	Attributes m_attributes;
+	std::string m_text;
+	std::string m_encoding;
+
+	// Names of the elements started and not ended yet, innermost last
+	std::vector< std::string > m_open;
+
+	void UpdateRow( const char* pos );
+	const char* Find( const char* token );
+	std::string ReadName();
+	void SkipWhiteSpace();
+	void ReadDeclaration( const char* end );
+	void ReadAttributes( const char* end, bool declaration );
+	void Decode( const char* begin, const char* end, std::string* result ) const;
+};
+
+#endif //__XML_READER_H__